@@ -0,0 +1,149 @@
+#include <chrono>
+#include <print>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "doca-cpp/core/device.hpp"
+#include "doca-cpp/core/memory_allocator.hpp"
+#include "doca-cpp/rdma/rdma_endpoint.hpp"
+
+///
+/// Endpoint startup benchmark measures how long endpoint memory mapping delays Serve() and Connect():
+///   serial            — one thread, no prefault (previous behaviour)
+///   parallel          — all hardware threads, no prefault
+///   parallel-prefault — all hardware threads, pages prefaulted before registration
+///
+/// Every run maps freshly allocated untouched memory, so page faults are part of measured time.
+///
+/// Usage:
+///   bench_endpoint_startup <ib-device> [endpoint-counts] [size-MiB]
+///
+/// Endpoint counts are comma separated, e.g. 16,64,256
+///
+
+namespace constants
+{
+constexpr std::size_t mebibyte = 1024 * 1024;
+constexpr std::size_t defaultSizeMiB = 64;
+const std::string defaultEndpointCounts = "16,64,256";
+}  // namespace constants
+
+/// @brief Benchmarked mapping mode
+struct Mode {
+    std::string name;
+    doca::rdma::RdmaEndpointStorage::MappingConfig config;
+};
+
+/// @brief Service that does nothing; endpoints are never processed in this benchmark
+class NoopService : public doca::rdma::IRdmaService
+{
+public:
+    error Handle(doca::rdma::RdmaBufferPtr buffer) override
+    {
+        return nullptr;
+    }
+};
+
+/// @brief Parses comma separated endpoint counts
+std::vector<std::size_t> ParseCounts(const std::string & list)
+{
+    std::vector<std::size_t> counts;
+    std::stringstream stream(list);
+    std::string item;
+    while (std::getline(stream, item, ',')) {
+        counts.push_back(std::stoull(item));
+    }
+    return counts;
+}
+
+/// @brief Creates storage with given number of write endpoints, each with its own untouched buffer
+std::tuple<doca::rdma::RdmaEndpointStoragePtr, error> MakeStorage(doca::DevicePtr device, std::size_t count,
+                                                                  std::size_t size)
+{
+    auto [allocator, err] = doca::AlignedMemoryAllocator::Create({});
+    if (err) {
+        return { nullptr, err };
+    }
+
+    auto service = std::make_shared<NoopService>();
+    auto storage = doca::rdma::RdmaEndpointStorage::Create();
+    for (std::size_t index = 0; index < count; index++) {
+        auto [buffer, bufErr] = doca::rdma::RdmaBuffer::FromAllocator(allocator, size);
+        if (bufErr) {
+            return { nullptr, bufErr };
+        }
+        auto [endpoint, epErr] = doca::rdma::RdmaEndpoint::Create()
+                                     .SetDevice(device)
+                                     .SetPath("/bench/startup/" + std::to_string(index))
+                                     .SetType(doca::rdma::RdmaEndpointType::write)
+                                     .SetBuffer(buffer)
+                                     .Build();
+        if (epErr) {
+            return { nullptr, epErr };
+        }
+        auto srvErr = endpoint->RegisterService(service);
+        if (srvErr) {
+            return { nullptr, srvErr };
+        }
+        auto regErr = storage->RegisterEndpoint(endpoint);
+        if (regErr) {
+            return { nullptr, regErr };
+        }
+    }
+    return { storage, nullptr };
+}
+
+int main(int argc, char ** argv)
+{
+    using Clock = std::chrono::steady_clock;
+    using Milliseconds = std::chrono::duration<double, std::milli>;
+
+    if (argc < 2) {
+        std::println("Usage: {} <ib-device> [endpoint-counts] [size-MiB]", argv[0]);
+        return 1;
+    }
+
+    const auto deviceName = std::string(argv[1]);
+    const auto counts = ParseCounts(argc > 2 ? argv[2] : constants::defaultEndpointCounts);
+    const auto size = (argc > 3 ? std::stoull(argv[3]) : constants::defaultSizeMiB) * constants::mebibyte;
+
+    auto [device, err] = doca::OpenIbDevice(deviceName);
+    if (err) {
+        std::println("[Endpoint Startup Benchmark] Failed to open device {}: {}", deviceName, err->What());
+        return 1;
+    }
+
+    const auto modes = std::vector<Mode>{
+        { .name = "serial", .config = { .numThreads = 1, .prefault = false } },
+        { .name = "parallel", .config = { .numThreads = 0, .prefault = false } },
+        { .name = "parallel-prefault", .config = { .numThreads = 0, .prefault = true } },
+    };
+
+    std::println("[Endpoint Startup Benchmark] Endpoint size: {} MiB", size / constants::mebibyte);
+    std::println("{:>10} {:<18} {:>8} {:>14} {:>18}", "endpoints", "mode", "threads", "startup, ms",
+                 "per endpoint, ms");
+
+    for (const auto count : counts) {
+        for (const auto & mode : modes) {
+            auto [storage, storageErr] = MakeStorage(device, count, size);
+            if (storageErr) {
+                std::println("{:>10} {:<18} skipped: {}", count, mode.name, storageErr->What());
+                continue;
+            }
+
+            const auto start = Clock::now();
+            auto mapErr = storage->MapEndpointsMemory(device, mode.config);
+            const auto startupTime = Milliseconds(Clock::now() - start).count();
+            if (mapErr) {
+                std::println("{:>10} {:<18} skipped: {}", count, mode.name, mapErr->What());
+                continue;
+            }
+
+            const auto report = storage->GetMappingReport();
+            std::println("{:>10} {:<18} {:>8} {:>14.2f} {:>18.3f}", count, mode.name, report.numThreads, startupTime,
+                         startupTime / static_cast<double>(count));
+        }
+    }
+    return 0;
+}
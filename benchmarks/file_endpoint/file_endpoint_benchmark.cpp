@@ -0,0 +1,129 @@
+#include <chrono>
+#include <fstream>
+#include <print>
+#include <string>
+
+#include "doca-cpp/core/device.hpp"
+#include "doca-cpp/core/mapped_file.hpp"
+#include "doca-cpp/rdma/rdma_buffer.hpp"
+
+///
+/// File endpoint benchmark compares startup cost of serving on-disk data:
+///   copy          — file is read into std::vector which is then registered (previous approach)
+///   mmap          — file is mapped read-only and registered without copying
+///   mmap-populate — same as mmap but mapping is prefaulted with MAP_POPULATE
+///
+/// Every variant should be run in separate process so resident memory figures are not mixed up.
+///
+/// Usage:
+///   bench_file_endpoint <ib-device> <file> <copy|mmap|mmap-populate>
+///
+
+namespace constants
+{
+constexpr double mebibyte = 1024.0 * 1024.0;
+}  // namespace constants
+
+/// @brief Reads value of given field in kB from /proc/self/status
+std::size_t ReadProcStatusKb(const std::string & field)
+{
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line)) {
+        if (line.starts_with(field + ":")) {
+            return std::stoull(line.substr(field.size() + 1));
+        }
+    }
+    return 0;
+}
+
+/// @brief Loads file into RDMA buffer with given method
+std::tuple<doca::rdma::RdmaBufferPtr, error> LoadFile(const std::string & path, const std::string & method)
+{
+    if (method == "copy") {
+        std::ifstream file(path, std::ios::binary | std::ios::ate);
+        if (!file) {
+            return { nullptr, errors::New("Failed to open file " + path) };
+        }
+        auto data = std::make_shared<doca::MemoryRange>(static_cast<std::size_t>(file.tellg()));
+        file.seekg(0);
+        if (!file.read(reinterpret_cast<char *>(data->data()), static_cast<std::streamsize>(data->size()))) {
+            return { nullptr, errors::New("Failed to read file " + path) };
+        }
+        return doca::rdma::RdmaBuffer::FromMemoryRange(data);
+    }
+
+    if (method == "mmap" || method == "mmap-populate") {
+        auto config = doca::MappedFile::Config{
+            .mode = doca::MappedFile::Mode::readOnly,
+            .populate = method == "mmap-populate",
+        };
+        auto [file, err] = doca::MappedFile::Open(path, config);
+        if (err) {
+            return { nullptr, err };
+        }
+        return doca::rdma::RdmaBuffer::FromMappedFile(file);
+    }
+
+    return { nullptr, errors::New("Unknown method: " + method) };
+}
+
+int main(int argc, char ** argv)
+{
+    using Clock = std::chrono::steady_clock;
+    using Milliseconds = std::chrono::duration<double, std::milli>;
+
+    if (argc < 4) {
+        std::println("Usage: {} <ib-device> <file> <copy|mmap|mmap-populate>", argv[0]);
+        return 1;
+    }
+
+    const auto deviceName = std::string(argv[1]);
+    const auto path = std::string(argv[2]);
+    const auto method = std::string(argv[3]);
+
+    auto [device, err] = doca::OpenIbDevice(deviceName);
+    if (err) {
+        std::println("[File Endpoint Benchmark] Failed to open device {}: {}", deviceName, err->What());
+        return 1;
+    }
+
+    const auto rssBefore = ReadProcStatusKb("VmRSS");
+
+    const auto loadStart = Clock::now();
+    auto [buffer, loadErr] = LoadFile(path, method);
+    const auto loadEnd = Clock::now();
+    if (loadErr) {
+        std::println("[File Endpoint Benchmark] Failed to load file: {}", loadErr->What());
+        return 1;
+    }
+
+    // Same permissions as endpoint storage uses for read-only and writable memory
+    const auto permissions = buffer->IsReadOnly()
+                                 ? doca::AccessFlags::localReadOnly | doca::AccessFlags::rdmaRead
+                                 : doca::AccessFlags::localReadWrite | doca::AccessFlags::rdmaRead;
+    auto mapErr = buffer->MapMemory(device, permissions);
+    const auto mapEnd = Clock::now();
+    if (mapErr) {
+        std::println("[File Endpoint Benchmark] Failed to map memory: {}", mapErr->What());
+        return 1;
+    }
+
+    const auto rssAfter = ReadProcStatusKb("VmRSS");
+    const auto rssPeak = ReadProcStatusKb("VmHWM");
+
+    const auto loadTime = Milliseconds(loadEnd - loadStart).count();
+    const auto mapTime = Milliseconds(mapEnd - loadEnd).count();
+
+    const auto fileSize = static_cast<double>(buffer->MemoryRangeSize()) / constants::mebibyte;
+    const auto rssGrowth = (static_cast<double>(rssAfter) - static_cast<double>(rssBefore)) / 1024.0;
+
+    std::println("[File Endpoint Benchmark] Method:            {}", method);
+    std::println("[File Endpoint Benchmark] File size:         {:.1f} MiB", fileSize);
+    std::println("[File Endpoint Benchmark] Load time:         {:.2f} ms", loadTime);
+    std::println("[File Endpoint Benchmark] Registration time: {:.2f} ms", mapTime);
+    std::println("[File Endpoint Benchmark] Startup time:      {:.2f} ms", loadTime + mapTime);
+    std::println("[File Endpoint Benchmark] RSS growth:        {:.1f} MiB", rssGrowth);
+    std::println("[File Endpoint Benchmark] Peak RSS:          {:.1f} MiB", rssPeak / 1024.0);
+    return 0;
+}
@@ -0,0 +1,326 @@
+#include <atomic>
+#include <chrono>
+#include <csignal>
+#include <cstdlib>
+#include <print>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "doca-cpp/core/device.hpp"
+#include "doca-cpp/core/memory_allocator.hpp"
+#include "doca-cpp/rdma/rdma_client.hpp"
+#include "doca-cpp/rdma/rdma_server.hpp"
+
+///
+/// Memory allocator benchmark compares memory backings of RDMA buffers:
+///   registration — allocation and memory map registration time of every allocator on local device
+///   server       — serves write and read endpoints backed by chosen allocator
+///   client       — requests endpoints of server and measures transfer bandwidth with chosen allocator
+///
+/// Usage:
+///   bench_memory_allocator <ib-device> registration [size-MiB]
+///   bench_memory_allocator <ib-device> server <allocator> [size-MiB] [port]
+///   bench_memory_allocator <ib-device> client <allocator> <server-address> [size-MiB] [iterations] [port]
+///
+/// Allocators: vector, aligned, aligned-touch, hugepage-2mb, hugepage-2mb-memfd, hugepage-1gb
+///
+
+namespace global
+{
+std::atomic_bool shutdownSignalReceived = false;
+}
+
+namespace constants
+{
+constexpr std::size_t mebibyte = 1024 * 1024;
+constexpr std::size_t defaultSizeMiB = 1024;
+constexpr std::size_t defaultIterations = 100;
+constexpr uint16_t defaultPort = 12345;
+const std::string endpointPath = "/bench/memory";
+const std::vector<std::string> allocatorNames = {
+    "vector", "aligned", "aligned-touch", "hugepage-2mb", "hugepage-2mb-memfd", "hugepage-1gb",
+};
+}  // namespace constants
+
+void SignalHandler(int signum)
+{
+    global::shutdownSignalReceived.store(true);
+}
+
+/// @brief Service that does nothing so that only transfer is measured
+class NoopService : public doca::rdma::IRdmaService
+{
+public:
+    error Handle(doca::rdma::RdmaBufferPtr buffer) override
+    {
+        return nullptr;
+    }
+};
+
+/// @brief Creates allocator by its benchmark name
+std::tuple<doca::MemoryAllocatorPtr, error> MakeAllocator(const std::string & name)
+{
+    const auto firstTouchThreads = std::max(1u, std::thread::hardware_concurrency());
+
+    if (name == "vector") {
+        return { doca::VectorMemoryAllocator::Create(), nullptr };
+    }
+    if (name == "aligned" || name == "aligned-touch") {
+        auto config = doca::AlignedMemoryAllocator::Config{
+            .alignment = 4096,
+            .firstTouchThreads = name == "aligned-touch" ? firstTouchThreads : 0,
+        };
+        return doca::AlignedMemoryAllocator::Create(config);
+    }
+    if (name == "hugepage-2mb" || name == "hugepage-2mb-memfd" || name == "hugepage-1gb") {
+        using HugePage = doca::HugePageMemoryAllocator;
+        auto config = HugePage::Config{
+            .pageSize = name == "hugepage-1gb" ? HugePage::PageSize::size1GB : HugePage::PageSize::size2MB,
+            .source = name == "hugepage-2mb-memfd" ? HugePage::Source::memfd : HugePage::Source::anonymous,
+            .firstTouchThreads = firstTouchThreads,
+        };
+        return HugePage::Create(config);
+    }
+    return { nullptr, errors::New("Unknown allocator: " + name) };
+}
+
+/// @brief Creates write and read endpoints sharing one buffer backed by given allocator
+std::tuple<std::vector<doca::rdma::RdmaEndpointPtr>, error> MakeEndpoints(doca::DevicePtr device,
+                                                                          doca::MemoryAllocatorPtr allocator,
+                                                                          std::size_t size)
+{
+    auto [buffer, err] = doca::rdma::RdmaBuffer::FromAllocator(allocator, size);
+    if (err) {
+        return { {}, err };
+    }
+
+    auto service = std::make_shared<NoopService>();
+
+    std::vector<doca::rdma::RdmaEndpointPtr> endpoints;
+    for (auto type : { doca::rdma::RdmaEndpointType::write, doca::rdma::RdmaEndpointType::read }) {
+        auto [endpoint, epErr] = doca::rdma::RdmaEndpoint::Create()
+                                     .SetDevice(device)
+                                     .SetPath(constants::endpointPath)
+                                     .SetType(type)
+                                     .SetBuffer(buffer)
+                                     .Build();
+        if (epErr) {
+            return { {}, epErr };
+        }
+        auto srvErr = endpoint->RegisterService(service);
+        if (srvErr) {
+            return { {}, srvErr };
+        }
+        endpoints.emplace_back(std::move(endpoint));
+    }
+    return { endpoints, nullptr };
+}
+
+/// @brief Measures allocation and registration time of every allocator
+int RunRegistration(doca::DevicePtr device, std::size_t size)
+{
+    using Clock = std::chrono::steady_clock;
+    using Milliseconds = std::chrono::duration<double, std::milli>;
+
+    const auto permissions =
+        doca::AccessFlags::localReadWrite | doca::AccessFlags::rdmaRead | doca::AccessFlags::rdmaWrite;
+
+    std::println("{:<22} {:>14} {:>14} {:>14}", "allocator", "allocate, ms", "register, ms", "total, ms");
+
+    for (const auto & name : constants::allocatorNames) {
+        auto [allocator, err] = MakeAllocator(name);
+        if (err) {
+            std::println("{:<22} skipped: {}", name, err->What());
+            continue;
+        }
+
+        const auto allocStart = Clock::now();
+        auto [buffer, allocErr] = doca::rdma::RdmaBuffer::FromAllocator(allocator, size);
+        const auto allocEnd = Clock::now();
+        if (allocErr) {
+            std::println("{:<22} skipped: {}", name, allocErr->What());
+            continue;
+        }
+
+        auto mapErr = buffer->MapMemory(device, permissions);
+        const auto mapEnd = Clock::now();
+        if (mapErr) {
+            std::println("{:<22} skipped: {}", name, mapErr->What());
+            continue;
+        }
+
+        const auto allocTime = Milliseconds(allocEnd - allocStart).count();
+        const auto mapTime = Milliseconds(mapEnd - allocEnd).count();
+        std::println("{:<22} {:>14.2f} {:>14.2f} {:>14.2f}", name, allocTime, mapTime, allocTime + mapTime);
+    }
+    return 0;
+}
+
+/// @brief Serves benchmark endpoints until signal is received
+int RunServer(doca::DevicePtr device, doca::MemoryAllocatorPtr allocator, std::size_t size, uint16_t port)
+{
+    auto [server, err] = doca::rdma::RdmaServer::Create().SetDevice(device).SetListenPort(port).Build();
+    if (err) {
+        std::println("[Allocator Benchmark] Failed to create server: {}", err->What());
+        return 1;
+    }
+
+    auto [endpoints, epErr] = MakeEndpoints(device, allocator, size);
+    if (epErr) {
+        std::println("[Allocator Benchmark] Failed to create endpoints: {}", epErr->What());
+        return 1;
+    }
+
+    err = server->RegisterEndpoints(endpoints);
+    if (err) {
+        std::println("[Allocator Benchmark] Failed to register endpoints: {}", err->What());
+        return 1;
+    }
+
+    std::thread serverThread([&server]() {
+        auto serveErr = server->Serve();
+        if (serveErr) {
+            std::println("[Allocator Benchmark] Failed to serve: {}", serveErr->What());
+            std::exit(1);
+        }
+    });
+
+    std::signal(SIGINT, SignalHandler);
+    std::signal(SIGTERM, SignalHandler);
+
+    std::println("[Allocator Benchmark] Serving {} MiB endpoints backed by {}", size / constants::mebibyte,
+                 allocator->Description());
+
+    while (!global::shutdownSignalReceived.load()) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }
+
+    err = server->Shutdown(std::chrono::milliseconds(5000));
+    if (err) {
+        std::println("[Allocator Benchmark] Shutdown error: {}", err->What());
+    }
+    serverThread.join();
+    return 0;
+}
+
+/// @brief Requests benchmark endpoints and reports transfer bandwidth
+int RunClient(doca::DevicePtr device, doca::MemoryAllocatorPtr allocator, const std::string & serverAddress,
+              std::size_t size, std::size_t iterations, uint16_t port)
+{
+    using Clock = std::chrono::steady_clock;
+    using Seconds = std::chrono::duration<double>;
+
+    auto [client, err] = doca::rdma::RdmaClient::Create(device);
+    if (err) {
+        std::println("[Allocator Benchmark] Failed to create client: {}", err->What());
+        return 1;
+    }
+
+    auto [endpoints, epErr] = MakeEndpoints(device, allocator, size);
+    if (epErr) {
+        std::println("[Allocator Benchmark] Failed to create endpoints: {}", epErr->What());
+        return 1;
+    }
+
+    err = client->RegisterEndpoints(endpoints);
+    if (err) {
+        std::println("[Allocator Benchmark] Failed to register endpoints: {}", err->What());
+        return 1;
+    }
+
+    const auto connectStart = Clock::now();
+    err = client->Connect(serverAddress, port);
+    if (err) {
+        std::println("[Allocator Benchmark] Failed to connect: {}", err->What());
+        return 1;
+    }
+    const auto connectTime = Seconds(Clock::now() - connectStart).count();
+
+    std::println("[Allocator Benchmark] Client memory: {}", allocator->Description());
+    std::println("[Allocator Benchmark] Connect (includes registration): {:.3f} s", connectTime);
+
+    for (const auto & endpoint : endpoints) {
+        const auto endpointId = doca::rdma::MakeEndpointId(endpoint);
+
+        // Warm up caches before measuring
+        err = client->RequestEndpointProcessing(endpointId);
+        if (err) {
+            std::println("[Allocator Benchmark] Warm-up request failed: {}", err->What());
+            return 1;
+        }
+
+        const auto start = Clock::now();
+        for (std::size_t i = 0; i < iterations; i++) {
+            err = client->RequestEndpointProcessing(endpointId);
+            if (err) {
+                std::println("[Allocator Benchmark] Request failed: {}", err->What());
+                return 1;
+            }
+        }
+        const auto elapsed = Seconds(Clock::now() - start).count();
+
+        const auto gibPerSecond = static_cast<double>(size * iterations) / elapsed / (1024.0 * constants::mebibyte);
+        std::println("[Allocator Benchmark] {:<24} {:>8} requests {:>10.3f} s {:>10.3f} GiB/s", endpointId,
+                     iterations, elapsed, gibPerSecond);
+    }
+    return 0;
+}
+
+int main(int argc, char ** argv)
+{
+    if (argc < 3) {
+        std::println("Usage:");
+        std::println("  {} <ib-device> registration [size-MiB]", argv[0]);
+        std::println("  {} <ib-device> server <allocator> [size-MiB] [port]", argv[0]);
+        std::println("  {} <ib-device> client <allocator> <server-address> [size-MiB] [iterations] [port]", argv[0]);
+        return 1;
+    }
+
+    const auto deviceName = std::string(argv[1]);
+    const auto mode = std::string(argv[2]);
+    auto argument = [argc, argv](int index, std::size_t defaultValue) -> std::size_t {
+        return index < argc ? std::stoull(argv[index]) : defaultValue;
+    };
+
+    auto [device, err] = doca::OpenIbDevice(deviceName);
+    if (err) {
+        std::println("[Allocator Benchmark] Failed to open device {}: {}", deviceName, err->What());
+        return 1;
+    }
+
+    if (mode == "registration") {
+        const auto size = argument(3, constants::defaultSizeMiB) * constants::mebibyte;
+        return RunRegistration(device, size);
+    }
+
+    if (argc < 4) {
+        std::println("[Allocator Benchmark] Allocator is required for mode {}", mode);
+        return 1;
+    }
+    auto [allocator, allocErr] = MakeAllocator(argv[3]);
+    if (allocErr) {
+        std::println("[Allocator Benchmark] {}", allocErr->What());
+        return 1;
+    }
+
+    if (mode == "server") {
+        const auto size = argument(4, constants::defaultSizeMiB) * constants::mebibyte;
+        const auto port = static_cast<uint16_t>(argument(5, constants::defaultPort));
+        return RunServer(device, allocator, size, port);
+    }
+
+    if (mode == "client") {
+        if (argc < 5) {
+            std::println("[Allocator Benchmark] Server address is required for client mode");
+            return 1;
+        }
+        const auto size = argument(5, constants::defaultSizeMiB) * constants::mebibyte;
+        const auto iterations = argument(6, constants::defaultIterations);
+        const auto port = static_cast<uint16_t>(argument(7, constants::defaultPort));
+        return RunClient(device, allocator, argv[4], size, iterations, port);
+    }
+
+    std::println("[Allocator Benchmark] Unknown mode {}", mode);
+    return 1;
+}
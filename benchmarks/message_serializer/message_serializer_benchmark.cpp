@@ -0,0 +1,115 @@
+#include <chrono>
+#include <cstdint>
+#include <algorithm>
+#include <print>
+#include <string>
+#include <vector>
+
+#include "doca-cpp/rdma/internal/rdma_communication.hpp"
+
+///
+/// Message serializer benchmark measures cost of serializing control messages into reused buffer and parsing them back
+/// for every message type. Control session pays it for every message in both directions, so it bounds request rate
+/// together with socket round trip.
+///
+/// Usage:
+///   bench_message_serializer [iterations]
+///
+
+namespace constants
+{
+constexpr std::size_t defaultIterations = 1000000;
+constexpr std::size_t descriptorSize = 160;
+constexpr std::size_t catalogEndpoints = 64;
+}  // namespace constants
+
+namespace communication = doca::rdma::communication;
+using communication::MessageSerializer;
+
+/// @brief Prevents compiler from removing benchmarked work
+std::size_t sink = 0;
+
+/// @brief Runs serialization and parsing of message and prints time per message
+template <typename Message, typename Parse>
+void RunMessage(const std::string & name, const Message & message, Parse parse, std::size_t iterations)
+{
+    using Clock = std::chrono::steady_clock;
+    using Nanoseconds = std::chrono::duration<double, std::nano>;
+
+    std::vector<std::uint8_t> buffer(MessageSerializer::SerializedSize(message));
+
+    const auto serializeStart = Clock::now();
+    for (std::size_t index = 0; index < iterations; index++) {
+        auto [size, err] = MessageSerializer::Serialize(message, buffer);
+        sink += err ? 0 : size;
+    }
+    const auto serializeTime = Nanoseconds(Clock::now() - serializeStart).count() / static_cast<double>(iterations);
+
+    const auto parseStart = Clock::now();
+    for (std::size_t index = 0; index < iterations; index++) {
+        auto [parsed, err] = parse(std::span<const std::uint8_t>(buffer));
+        sink += err ? 0 : parsed.requestId;
+    }
+    const auto parseTime = Nanoseconds(Clock::now() - parseStart).count() / static_cast<double>(iterations);
+
+    std::println("{:<16} {:>8} {:>16.1f} {:>12.1f}", name, buffer.size(), serializeTime, parseTime);
+}
+
+int main(int argc, char ** argv)
+{
+    const auto iterations = argc > 1 ? std::stoull(argv[1]) : constants::defaultIterations;
+
+    auto descriptor = std::make_shared<const doca::rdma::RdmaMemoryDescriptor>(constants::descriptorSize, 0xAB);
+
+    communication::Request requestByPath;
+    requestByPath.requestId = 1;
+    requestByPath.endpointPath = "/bench/serializer/endpoint";
+
+    communication::Request requestByNumber;
+    requestByNumber.requestId = 2;
+    requestByNumber.endpointNumber = 7;
+
+    communication::Responce responce;
+    responce.requestId = 3;
+    responce.responceCode = communication::Responce::Code::operationPermitted;
+    responce.descriptorGeneration = 42;
+    responce.memoryLength = 4096;
+
+    auto responceWithDescriptor = responce;
+    responceWithDescriptor.memoryDescriptor = descriptor;
+
+    communication::Acknowledge ack;
+    ack.requestId = 4;
+    ack.ackCode = communication::Acknowledge::Code::operationCompleted;
+
+    communication::CatalogRequest catalogRequest;
+    catalogRequest.requestId = 5;
+
+    communication::Catalog catalog;
+    catalog.requestId = 6;
+    catalog.regions.push_back({ .descriptorGeneration = 42, .memoryDescriptor = descriptor });
+    for (std::uint32_t index = 0; index < constants::catalogEndpoints; index++) {
+        catalog.endpoints.push_back({
+            .endpointNumber = index + 1,
+            .endpointType = doca::rdma::RdmaEndpointType::write,
+            .endpointPath = "/bench/serializer/" + std::to_string(index),
+            .slots = { { .descriptorGeneration = 42, .memoryOffset = index * 4096ull, .memoryLength = 4096 } },
+        });
+    }
+
+    std::println("[Message Serializer Benchmark] Iterations: {}", iterations);
+    std::println("{:<16} {:>8} {:>16} {:>12}", "message", "bytes", "serialize, ns", "parse, ns");
+
+    RunMessage("request (path)", requestByPath, MessageSerializer::DeserializeRequest, iterations);
+    RunMessage("request (number)", requestByNumber, MessageSerializer::DeserializeRequest, iterations);
+    RunMessage("responce", responce, MessageSerializer::DeserializeResponse, iterations);
+    RunMessage("responce + desc", responceWithDescriptor, MessageSerializer::DeserializeResponse, iterations);
+    RunMessage("acknowledge", ack, MessageSerializer::DeserializeAcknowledge, iterations);
+    RunMessage("catalog request", catalogRequest, MessageSerializer::DeserializeCatalogRequest, iterations);
+    // Catalog is sent once per session and is much larger, so it is run fewer times
+    const auto catalogIterations = std::max<std::size_t>(1, iterations / constants::catalogEndpoints);
+    RunMessage("catalog", catalog, MessageSerializer::DeserializeCatalog, catalogIterations);
+
+    std::println("[Message Serializer Benchmark] Checksum: {}", sink);
+    return 0;
+}
@@ -0,0 +1,179 @@
+#include <chrono>
+#include <print>
+#include <string>
+#include <vector>
+
+#include "doca-cpp/core/device.hpp"
+#include "doca-cpp/core/memory_allocator.hpp"
+#include "doca-cpp/rdma/rdma_client.hpp"
+#include "doca-cpp/rdma/rdma_endpoint.hpp"
+#include "doca-cpp/rdma/rdma_server.hpp"
+
+///
+/// Request rate benchmark measures how many small endpoint requests client issues per second. Per-request cost is
+/// dominated by control channel, so the figure shows overhead of opening control session for every request compared
+/// to reusing one session.
+///
+/// Benchmark uses only public client and server API, so it can be built against previous library versions to get
+/// figures before and after a change.
+///
+/// Usage:
+///   bench_request_rate server <ib-device> <port>
+///   bench_request_rate client <ib-device> <server-ipv4> <port> [requests]
+///
+
+namespace constants
+{
+constexpr std::size_t bufferSize = 4096;
+constexpr std::size_t defaultRequests = 10000;
+constexpr std::size_t warmupRequests = 100;
+const std::string endpointPath = "/bench/rate";
+}  // namespace constants
+
+/// @brief Service that does nothing, so only request overhead is measured
+class NoopService : public doca::rdma::IRdmaService
+{
+public:
+    error Handle(doca::rdma::RdmaBufferPtr buffer) override
+    {
+        return nullptr;
+    }
+};
+
+/// @brief Creates small write endpoint with no-op service
+std::tuple<doca::rdma::RdmaEndpointPtr, error> MakeEndpoint(doca::DevicePtr device)
+{
+    auto [allocator, err] = doca::AlignedMemoryAllocator::Create({});
+    if (err) {
+        return { nullptr, err };
+    }
+    auto [buffer, bufErr] = doca::rdma::RdmaBuffer::FromAllocator(allocator, constants::bufferSize);
+    if (bufErr) {
+        return { nullptr, bufErr };
+    }
+    auto [endpoint, epErr] = doca::rdma::RdmaEndpoint::Create()
+                                 .SetDevice(device)
+                                 .SetPath(constants::endpointPath)
+                                 .SetType(doca::rdma::RdmaEndpointType::write)
+                                 .SetBuffer(buffer)
+                                 .Build();
+    if (epErr) {
+        return { nullptr, epErr };
+    }
+    auto srvErr = endpoint->RegisterService(std::make_shared<NoopService>());
+    if (srvErr) {
+        return { nullptr, srvErr };
+    }
+    return { endpoint, nullptr };
+}
+
+/// @brief Serves benchmark endpoint until process is stopped
+int RunServer(doca::DevicePtr device, uint16_t port)
+{
+    auto [server, err] = doca::rdma::RdmaServer::Create().SetDevice(device).SetListenPort(port).Build();
+    if (err) {
+        std::println("[Request Rate Benchmark] Failed to create server: {}", err->What());
+        return 1;
+    }
+
+    auto [endpoint, epErr] = MakeEndpoint(device);
+    if (epErr) {
+        std::println("[Request Rate Benchmark] Failed to create endpoint: {}", epErr->What());
+        return 1;
+    }
+    auto endpoints = std::vector<doca::rdma::RdmaEndpointPtr>{ endpoint };
+    err = server->RegisterEndpoints(endpoints);
+    if (err) {
+        std::println("[Request Rate Benchmark] Failed to register endpoint: {}", err->What());
+        return 1;
+    }
+
+    std::println("[Request Rate Benchmark] Serving on port {}; stop with Ctrl+C", port);
+    err = server->Serve();
+    if (err) {
+        std::println("[Request Rate Benchmark] Failed to serve: {}", err->What());
+        return 1;
+    }
+    return 0;
+}
+
+/// @brief Issues requests one after another and reports request rate
+int RunClient(doca::DevicePtr device, const std::string & serverAddress, uint16_t port, std::size_t requests)
+{
+    using Clock = std::chrono::steady_clock;
+    using Seconds = std::chrono::duration<double>;
+
+    auto [client, err] = doca::rdma::RdmaClient::Create(device);
+    if (err) {
+        std::println("[Request Rate Benchmark] Failed to create client: {}", err->What());
+        return 1;
+    }
+
+    auto [endpoint, epErr] = MakeEndpoint(device);
+    if (epErr) {
+        std::println("[Request Rate Benchmark] Failed to create endpoint: {}", epErr->What());
+        return 1;
+    }
+    auto endpoints = std::vector<doca::rdma::RdmaEndpointPtr>{ endpoint };
+    err = client->RegisterEndpoints(endpoints);
+    if (err) {
+        std::println("[Request Rate Benchmark] Failed to register endpoint: {}", err->What());
+        return 1;
+    }
+
+    err = client->Connect(serverAddress, port);
+    if (err) {
+        std::println("[Request Rate Benchmark] Failed to connect: {}", err->What());
+        return 1;
+    }
+
+    const auto endpointId = doca::rdma::MakeEndpointId(endpoint);
+
+    // Warm up so that remote memory import is not measured
+    for (std::size_t index = 0; index < constants::warmupRequests; index++) {
+        err = client->RequestEndpointProcessing(endpointId);
+        if (err) {
+            std::println("[Request Rate Benchmark] Warmup request failed: {}", err->What());
+            return 1;
+        }
+    }
+
+    const auto start = Clock::now();
+    for (std::size_t index = 0; index < requests; index++) {
+        err = client->RequestEndpointProcessing(endpointId);
+        if (err) {
+            std::println("[Request Rate Benchmark] Request {} failed: {}", index, err->What());
+            return 1;
+        }
+    }
+    const auto elapsed = Seconds(Clock::now() - start).count();
+
+    std::println("{:>10} {:>12} {:>16} {:>14}", "requests", "elapsed, s", "requests per s", "latency, us");
+    std::println("{:>10} {:>12.3f} {:>16.0f} {:>14.1f}", requests, elapsed, static_cast<double>(requests) / elapsed,
+                 elapsed * 1e6 / static_cast<double>(requests));
+    return 0;
+}
+
+int main(int argc, char ** argv)
+{
+    const auto mode = argc > 1 ? std::string(argv[1]) : std::string();
+    if ((mode != "server" || argc < 4) && (mode != "client" || argc < 5)) {
+        std::println("Usage: {} server <ib-device> <port>", argv[0]);
+        std::println("       {} client <ib-device> <server-ipv4> <port> [requests]", argv[0]);
+        return 1;
+    }
+
+    const auto deviceName = std::string(argv[2]);
+    auto [device, err] = doca::OpenIbDevice(deviceName);
+    if (err) {
+        std::println("[Request Rate Benchmark] Failed to open device {}: {}", deviceName, err->What());
+        return 1;
+    }
+
+    if (mode == "server") {
+        return RunServer(device, static_cast<uint16_t>(std::stoul(argv[3])));
+    }
+
+    const auto requests = argc > 5 ? std::stoull(argv[5]) : constants::defaultRequests;
+    return RunClient(device, argv[3], static_cast<uint16_t>(std::stoul(argv[4])), requests);
+}
@@ -3,8 +3,11 @@
 #include <doca_buf.h>
 #include <doca_buf_inventory.h>
 
+#include <algorithm>
 #include <cstddef>
+#include <cstdint>
 #include <memory>
+#include <mutex>
 #include <span>
 #include <tuple>
 #include <vector>
@@ -19,9 +22,17 @@ namespace doca
 // Forward declarations
 class Buffer;
 class BufferInventory;
+class ElasticBufferInventory;
 
 using BufferPtr = std::shared_ptr<Buffer>;
 using BufferInventoryPtr = std::shared_ptr<BufferInventory>;
+using ElasticBufferInventoryPtr = std::shared_ptr<ElasticBufferInventory>;
+
+/// @brief Errors enumeration that can occur in buffer inventories
+namespace ErrorTypes
+{
+inline const auto BufferInventoryExhausted = errors::New("Buffer inventory exhausted");
+}  // namespace ErrorTypes
 
 #pragma region Buffer
 
@@ -62,15 +73,15 @@ public:
     /// [Property Setters]
 
     /// @brief Sets memory region which buffer will point to
-    /// @warning Scenario when this method is needed is unknown. This library does not use this method
+    /// @details Used to reuse cached buffer as source of next operation
     error SetData(void * data, size_t dataLen);
 
     /// @brief Sets memory region which buffer will point to
     /// @warning Scenario when this method is needed is unknown. This library does not use this method
     error SetData(std::vector<std::byte> data);
 
-    /// @brief Detaches memory region which buffer points to
-    /// @warning Scenario when this method is needed is unknown. This library does not use this method
+    /// @brief Resets data length of buffer to zero
+    /// @details Used to reuse cached buffer as destination of next operation
     error ResetData();
 
     /// [Resource Management]
@@ -163,6 +174,14 @@ public:
     /// This overload is used to create remote host source Buffer (e.g. for RDMA read operation)
     std::tuple<BufferPtr, error> AllocBufferByData(RemoteMemoryMapPtr mmap, void * data, size_t length);
 
+    /// [Capacity]
+
+    /// @brief Gets total number of elements in inventory
+    std::tuple<std::uint32_t, error> GetNumElements() const;
+
+    /// @brief Gets number of elements in inventory that are not taken by buffers
+    std::tuple<std::uint32_t, error> GetNumFreeElements() const;
+
     /// [Management]
 
     /// @brief Stops BufferInventory so no more Buffer can be retrieved
@@ -235,4 +254,138 @@ private:
 
 #pragma endregion
 
+#pragma region ElasticBufferInventory
+
+///
+/// @brief
+/// ElasticBufferInventory is a chain of BufferInventory instances that grows on demand. When all chained inventories
+/// are exhausted, new inventory is started and appended to chain until maximum number of elements is reached.
+/// Keeps usage statistics to help sizing inventory for workload.
+///
+class ElasticBufferInventory
+{
+public:
+    /// [Nested Types]
+
+    /// @brief Sizing of elastic inventory
+    struct Config {
+        /// @brief Number of elements in first inventory of chain
+        std::size_t initialElements = 0;
+        /// @brief Number of elements in every inventory appended to chain
+        std::size_t growthElements = 0;
+        /// @brief Maximum number of elements in all chained inventories
+        std::size_t maxElements = 0;
+    };
+
+    /// @brief Usage statistics
+    struct Statistics {
+        /// @brief Number of elements in all chained inventories
+        std::size_t capacity = 0;
+        /// @brief Number of elements taken by buffers at the moment
+        std::size_t inUse = 0;
+        /// @brief Maximum number of elements that were taken by buffers at the same time
+        std::size_t highWaterMark = 0;
+        /// @brief Number of times all chained inventories were exhausted
+        std::size_t exhaustionCount = 0;
+        /// @brief Number of times allocation failed since maximum number of elements was reached
+        std::size_t failureCount = 0;
+        /// @brief Number of inventories in chain
+        std::size_t numInventories = 0;
+    };
+
+    /// [Fabric Methods]
+
+    /// @brief Creates and starts elastic inventory with first inventory of chain
+    static std::tuple<ElasticBufferInventoryPtr, error> Create(const Config & config);
+
+    /// [Buffer Fabric Methods]
+
+    /// @brief Creates Buffer instance
+    /// This overload is used to create local host destination Buffer (e.g. for RDMA read operation)
+    std::tuple<BufferPtr, error> AllocBufferByAddress(MemoryMapPtr mmap, void * address, size_t length);
+
+    /// @brief Creates Buffer instance
+    /// This overload is used to create local host source Buffer (e.g. for RDMA write operation)
+    std::tuple<BufferPtr, error> AllocBufferByData(MemoryMapPtr mmap, void * data, size_t length);
+
+    /// @brief Creates Buffer instance
+    /// This overload is used to create remote host destination Buffer (e.g. for RDMA write operation)
+    std::tuple<BufferPtr, error> AllocBufferByAddress(RemoteMemoryMapPtr mmap, void * address, size_t length);
+
+    /// @brief Creates Buffer instance
+    /// This overload is used to create remote host source Buffer (e.g. for RDMA read operation)
+    std::tuple<BufferPtr, error> AllocBufferByData(RemoteMemoryMapPtr mmap, void * data, size_t length);
+
+    /// [Statistics]
+
+    /// @brief Gets usage statistics of all chained inventories
+    Statistics GetStatistics() const;
+
+    /// [Management]
+
+    /// @brief Stops all chained inventories so no more Buffer can be retrieved
+    error Stop();
+
+    /// [Construction & Destruction]
+
+    /// @brief Copy constructor is deleted
+    ElasticBufferInventory(const ElasticBufferInventory &) = delete;
+
+    /// @brief Copy operator is deleted
+    ElasticBufferInventory & operator=(const ElasticBufferInventory &) = delete;
+
+    /// @brief Move constructor is deleted
+    ElasticBufferInventory(ElasticBufferInventory && other) noexcept = delete;
+
+    /// @brief Move operator is deleted
+    ElasticBufferInventory & operator=(ElasticBufferInventory && other) noexcept = delete;
+
+    /// @brief Constructor
+    /// @warning Avoid using this constructor since class has static fabric methods
+    explicit ElasticBufferInventory(const Config & initialConfig);
+
+    /// @brief Destructor
+    ~ElasticBufferInventory() = default;
+
+private:
+    /// [Private Methods]
+
+    /// @brief Takes buffer from first inventory of chain that has free elements, grows chain if there is none
+    template <typename AllocFunction>
+    std::tuple<BufferPtr, error> allocate(AllocFunction allocFunction);
+
+    /// @brief Starts new inventory and appends it to chain
+    /// @warning Must be called with inventory mutex held
+    error grow(std::size_t numElements);
+
+    /// @brief Gets number of elements taken by buffers in all chained inventories
+    /// @warning Must be called with inventory mutex held
+    std::size_t countInUse() const;
+
+    /// [Properties]
+
+    /// @brief Sizing of elastic inventory
+    Config config;
+
+    /// @brief Chained inventories
+    std::vector<BufferInventoryPtr> inventories;
+
+    /// @brief Number of elements in all chained inventories
+    std::size_t capacity = 0;
+
+    /// @brief Maximum number of elements that were taken by buffers at the same time
+    std::size_t highWaterMark = 0;
+
+    /// @brief Number of times all chained inventories were exhausted
+    std::size_t exhaustionCount = 0;
+
+    /// @brief Number of times allocation failed since maximum number of elements was reached
+    std::size_t failureCount = 0;
+
+    /// @brief Guards chain of inventories and statistics
+    mutable std::mutex inventoryMutex;
+};
+
+#pragma endregion
+
 }  // namespace doca
@@ -0,0 +1,136 @@
+#pragma once
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <errors/errors.hpp>
+#include <format>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <tuple>
+
+#include "doca-cpp/core/error.hpp"
+#include "doca-cpp/core/mmap.hpp"
+
+namespace doca
+{
+
+// Forward declarations
+class MappedFile;
+
+// Type aliases
+using MappedFilePtr = std::shared_ptr<MappedFile>;
+
+///
+/// @brief
+/// MappedFile maps file into process memory so it can be registered for RDMA without reading it into buffer first.
+/// RDMA reads are served straight from page cache. Writable files are flushed to disk with msync in batches: every
+/// modification is counted and asynchronous flush is issued once configured number of modifications is reached.
+///
+class MappedFile
+{
+public:
+    /// [Nested Types]
+
+    /// @brief File access mode
+    enum class Mode : std::uint8_t {
+        readOnly,
+        readWrite,
+    };
+
+    /// @brief Configuration of file mapping
+    struct Config {
+        /// @brief File access mode
+        Mode mode = Mode::readOnly;
+        /// @brief Size of file in bytes; non-zero value creates or resizes writable file, zero maps file as is
+        std::size_t size = 0;
+        /// @brief Prefault mapping with MAP_POPULATE so first RDMA operations do not take page faults
+        bool populate = false;
+        /// @brief Number of modifications after which asynchronous flush is issued; zero flushes only on Flush call
+        /// and on unmapping
+        std::size_t flushBatchSize = 0;
+    };
+
+    /// [Fabric Methods]
+
+    /// @brief Opens and maps file with given configuration
+    static std::tuple<MappedFilePtr, error> Open(const std::string & path, const Config & config);
+
+    /// [Accessors]
+
+    /// @brief Gets mapped memory region
+    MemoryRangeHandle Memory() const;
+
+    /// @brief Gets size of mapped file in bytes
+    std::size_t Size() const;
+
+    /// @brief Gets path of mapped file
+    const std::string & Path() const;
+
+    /// @brief Gets file access mode
+    Mode AccessMode() const;
+
+    /// [Flushing]
+
+    /// @brief Records modification of mapped memory and issues asynchronous flush when batch is full
+    error MarkModified();
+
+    /// @brief Flushes modified pages to file; synchronous flush waits for write-back to complete
+    error Flush(bool synchronous = true);
+
+    /// [Construction & Destruction]
+
+#pragma region MappedFile::Construct
+
+    /// @brief Copy constructor is deleted
+    MappedFile(const MappedFile &) = delete;
+
+    /// @brief Copy operator is deleted
+    MappedFile & operator=(const MappedFile &) = delete;
+
+    /// @brief Move constructor is deleted
+    MappedFile(MappedFile && other) noexcept = delete;
+
+    /// @brief Move operator is deleted
+    MappedFile & operator=(MappedFile && other) noexcept = delete;
+
+    /// @brief Constructor
+    /// @warning Avoid using this constructor since class has static fabric methods
+    explicit MappedFile(const std::string & initialPath, const Config & initialConfig, int initialFd,
+                        MemoryRangeHandle initialMemory);
+
+    /// @brief Destructor synchronously flushes writable file and unmaps it
+    ~MappedFile();
+
+#pragma endregion
+
+private:
+    /// [Properties]
+
+    /// @brief Path of mapped file
+    std::string path;
+
+    /// @brief Configuration of file mapping
+    Config config;
+
+    /// @brief File descriptor
+    int fd = -1;
+
+    /// @brief Mapped memory region
+    MemoryRangeHandle memory;
+
+    /// @brief Number of modifications since last flush
+    std::size_t pendingModifications = 0;
+
+    /// @brief Guards modification counter
+    std::mutex flushMutex;
+};
+
+}  // namespace doca
@@ -0,0 +1,293 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <errors/errors.hpp>
+#include <format>
+#include <functional>
+#include <memory>
+#include <span>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+#include "doca-cpp/core/error.hpp"
+#include "doca-cpp/core/mmap.hpp"
+
+namespace doca
+{
+
+// Forward declarations
+class MemoryAllocation;
+class IMemoryAllocator;
+class VectorMemoryAllocator;
+class AlignedMemoryAllocator;
+class HugePageMemoryAllocator;
+
+// Type aliases
+using MemoryAllocationPtr = std::shared_ptr<MemoryAllocation>;
+using MemoryAllocatorPtr = std::shared_ptr<IMemoryAllocator>;
+using VectorMemoryAllocatorPtr = std::shared_ptr<VectorMemoryAllocator>;
+using AlignedMemoryAllocatorPtr = std::shared_ptr<AlignedMemoryAllocator>;
+using HugePageMemoryAllocatorPtr = std::shared_ptr<HugePageMemoryAllocator>;
+
+#pragma region MemoryAllocation
+
+///
+/// @brief
+/// MemoryAllocation owns memory region returned by memory allocator. Memory is released by allocator specific
+/// routine when allocation is destroyed.
+///
+class MemoryAllocation
+{
+public:
+    /// [Nested Types]
+
+    /// @brief Routine that gives memory region back to its allocator
+    using Releaser = std::function<void(MemoryRangeHandle memory)>;
+
+    /// [Fabric Methods]
+
+    /// @brief Creates allocation owning given memory region
+    static MemoryAllocationPtr Create(MemoryRangeHandle memory, Releaser releaser);
+
+    /// [Accessors]
+
+    /// @brief Gets allocated memory region
+    MemoryRangeHandle Memory() const;
+
+    /// @brief Gets size of allocated memory region in bytes
+    std::size_t Size() const;
+
+    /// [Construction & Destruction]
+
+#pragma region MemoryAllocation::Construct
+
+    /// @brief Copy constructor is deleted
+    MemoryAllocation(const MemoryAllocation &) = delete;
+
+    /// @brief Copy operator is deleted
+    MemoryAllocation & operator=(const MemoryAllocation &) = delete;
+
+    /// @brief Move constructor is deleted
+    MemoryAllocation(MemoryAllocation && other) noexcept = delete;
+
+    /// @brief Move operator is deleted
+    MemoryAllocation & operator=(MemoryAllocation && other) noexcept = delete;
+
+    /// @brief Constructor
+    /// @warning Avoid using this constructor since class has static fabric methods
+    explicit MemoryAllocation(MemoryRangeHandle initialMemory, Releaser initialReleaser);
+
+    /// @brief Destructor
+    ~MemoryAllocation();
+
+#pragma endregion
+
+private:
+    /// [Properties]
+
+    /// @brief Allocated memory region
+    MemoryRangeHandle memory;
+
+    /// @brief Routine that gives memory region back to its allocator
+    Releaser releaser = nullptr;
+};
+
+#pragma endregion
+
+#pragma region IMemoryAllocator
+
+///
+/// @brief
+/// Abstract interface for memory allocators backing RDMA buffers. Implementations decide how memory is obtained:
+/// zero-filled vector, uninitialized aligned memory or hugepages.
+///
+class IMemoryAllocator
+{
+public:
+    /// [Allocation]
+
+    /// @brief Allocates memory region of at least given size in bytes
+    virtual std::tuple<MemoryAllocationPtr, error> Allocate(std::size_t size) = 0;
+
+    /// @brief Gets human readable allocator description
+    virtual std::string Description() const = 0;
+
+    /// [Construction & Destruction]
+
+#pragma region IMemoryAllocator::Construct
+
+    /// @brief Copy constructor
+    IMemoryAllocator(const IMemoryAllocator &) = default;
+
+    /// @brief Copy operator
+    IMemoryAllocator & operator=(const IMemoryAllocator &) = default;
+
+    /// @brief Move constructor
+    IMemoryAllocator(IMemoryAllocator && other) noexcept = default;
+
+    /// @brief Move operator
+    IMemoryAllocator & operator=(IMemoryAllocator && other) noexcept = default;
+
+    /// @brief Default constructor
+    IMemoryAllocator() = default;
+
+    /// @brief Virtual destructor
+    virtual ~IMemoryAllocator() = default;
+
+#pragma endregion
+};
+
+#pragma endregion
+
+#pragma region VectorMemoryAllocator
+
+///
+/// @brief
+/// Default allocator that backs memory with zero-filled std::vector. Memory is touched page by page on allocating
+/// thread and is backed by regular pages.
+///
+class VectorMemoryAllocator : public IMemoryAllocator
+{
+public:
+    /// [Fabric Methods]
+
+    /// @brief Creates vector allocator
+    static VectorMemoryAllocatorPtr Create();
+
+    /// [Allocation]
+
+    /// @brief Allocates zero-filled memory region
+    std::tuple<MemoryAllocationPtr, error> Allocate(std::size_t size) override;
+
+    /// @brief Gets human readable allocator description
+    std::string Description() const override;
+};
+
+#pragma endregion
+
+#pragma region AlignedMemoryAllocator
+
+///
+/// @brief
+/// Allocator of uninitialized memory with configurable alignment. Memory can optionally be first-touched by several
+/// threads so that page faults are spread across cores instead of being taken by the thread that maps memory.
+///
+class AlignedMemoryAllocator : public IMemoryAllocator
+{
+public:
+    /// [Nested Types]
+
+    /// @brief Configuration of aligned allocator
+    struct Config {
+        /// @brief Alignment of memory region in bytes; must be power of two
+        std::size_t alignment = 4096;
+        /// @brief Number of threads touching memory after allocation; zero leaves memory untouched
+        std::size_t firstTouchThreads = 0;
+    };
+
+    /// [Fabric Methods]
+
+    /// @brief Creates aligned allocator
+    static std::tuple<AlignedMemoryAllocatorPtr, error> Create(const Config & config);
+
+    /// [Allocation]
+
+    /// @brief Allocates uninitialized memory region; size is rounded up to alignment
+    std::tuple<MemoryAllocationPtr, error> Allocate(std::size_t size) override;
+
+    /// @brief Gets human readable allocator description
+    std::string Description() const override;
+
+    /// [Construction & Destruction]
+
+    /// @brief Constructor
+    /// @warning Avoid using this constructor since class has static fabric methods
+    explicit AlignedMemoryAllocator(const Config & initialConfig);
+
+private:
+    /// @brief Configuration of aligned allocator
+    Config config;
+};
+
+#pragma endregion
+
+#pragma region HugePageMemoryAllocator
+
+///
+/// @brief
+/// Allocator backing memory with 2 MB or 1 GB hugepages. Hugepages shrink page tables and take less translation
+/// entries on the NIC. Hugepages must be reserved in system beforehand (e.g. via /proc/sys/vm/nr_hugepages).
+///
+class HugePageMemoryAllocator : public IMemoryAllocator
+{
+public:
+    /// [Nested Types]
+
+    /// @brief Hugepage size
+    enum class PageSize : std::uint8_t {
+        size2MB,
+        size1GB,
+    };
+
+    /// @brief Source of hugepages
+    enum class Source : std::uint8_t {
+        /// @brief Private anonymous mapping with MAP_HUGETLB
+        anonymous,
+        /// @brief Shared mapping of memfd created with MFD_HUGETLB
+        memfd,
+    };
+
+    /// @brief Configuration of hugepage allocator
+    struct Config {
+        PageSize pageSize = PageSize::size2MB;
+        Source source = Source::anonymous;
+        /// @brief Number of threads touching memory after allocation; zero leaves memory untouched
+        std::size_t firstTouchThreads = 0;
+    };
+
+    /// [Fabric Methods]
+
+    /// @brief Creates hugepage allocator
+    static std::tuple<HugePageMemoryAllocatorPtr, error> Create(const Config & config);
+
+    /// [Allocation]
+
+    /// @brief Allocates hugepage backed memory region; size is rounded up to hugepage size
+    std::tuple<MemoryAllocationPtr, error> Allocate(std::size_t size) override;
+
+    /// @brief Gets human readable allocator description
+    std::string Description() const override;
+
+    /// @brief Gets hugepage size in bytes
+    std::size_t PageSizeBytes() const;
+
+    /// [Construction & Destruction]
+
+    /// @brief Constructor
+    /// @warning Avoid using this constructor since class has static fabric methods
+    explicit HugePageMemoryAllocator(const Config & initialConfig);
+
+private:
+    /// @brief Configuration of hugepage allocator
+    Config config;
+};
+
+#pragma endregion
+
+/// @brief Touches every page of memory region from given number of threads so pages get faulted in parallel
+void FirstTouchMemory(MemoryRangeHandle memory, std::size_t pageSize, std::size_t numThreads);
+
+/// @brief Faults in every page of memory region from given number of threads without changing its contents. Pages of
+/// writable memory are populated for writing where kernel supports it (Linux 5.14+), otherwise they are only read
+void PrefaultMemory(MemoryRangeHandle memory, bool writable, std::size_t numThreads);
+
+}  // namespace doca
@@ -3,7 +3,11 @@
 #include <doca_mmap.h>
 
 #include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <tuple>
 #include <vector>
 
@@ -28,6 +32,40 @@ using MemoryMapPtr = std::shared_ptr<MemoryMap>;
 using RemoteMemoryMapPtr = std::shared_ptr<RemoteMemoryMap>;
 using DmaBufDescriptor = int;
 
+/// @brief Callback invoked right before memory map is stopped or destroyed
+using MemoryMapStopCallback = std::function<void()>;
+/// @brief Identifier of registered memory map stop callback
+using MemoryMapStopCallbackId = std::uint64_t;
+
+///
+/// @brief
+/// MemoryMapStopNotifier keeps callbacks that must run before memory map is stopped or destroyed. It lets owners of
+/// DOCA buffers referencing memory map (e.g. buffer caches) release them in time. Callbacks are one-shot.
+///
+class MemoryMapStopNotifier
+{
+public:
+    /// @brief Registers callback and returns its identifier
+    MemoryMapStopCallbackId Add(MemoryMapStopCallback callback);
+
+    /// @brief Removes callback by its identifier
+    void Remove(MemoryMapStopCallbackId callbackId);
+
+    /// @brief Invokes and removes all registered callbacks
+    void NotifyAll();
+
+private:
+    /// @brief Guards callbacks storage
+    std::mutex callbacksMutex;
+
+    /// @brief Registered callbacks
+    std::map<MemoryMapStopCallbackId, MemoryMapStopCallback> callbacks;
+
+    /// @brief Next callback identifier
+    MemoryMapStopCallbackId nextCallbackId = 0;
+};
+using MemoryMapStopNotifierPtr = std::shared_ptr<MemoryMapStopNotifier>;
+
 ///
 /// @brief
 /// MemoryMap is instance that maps application allocated memory to DOCA device
@@ -59,6 +97,14 @@ public:
     /// @brief Gets memory region mapped in memory map
     std::tuple<std::span<std::uint8_t>, error> GetMemoryRange();
 
+    /// [Stop Notification]
+
+    /// @brief Registers callback invoked before memory map is stopped or destroyed
+    MemoryMapStopCallbackId AddStopCallback(MemoryMapStopCallback callback);
+
+    /// @brief Removes previously registered stop callback
+    void RemoveStopCallback(MemoryMapStopCallbackId callbackId);
+
     /// [Unsafe]
 
     /// @brief Gets native pointer to DOCA structure
@@ -82,6 +128,9 @@ public:
         /// @brief Sets memory region
         Builder & SetMemoryRange(MemoryRangePtr memoryRange);
 
+        /// @brief Sets memory region not owned by std::vector (e.g. hugepage or externally allocated memory)
+        Builder & SetMemoryRange(MemoryRangeHandle memoryRange);
+
         /// @brief Sets DMA buf memory region
         Builder & SetDmaBufMemoryRange(MemoryRangeHandle memoryRange, DmaBufDescriptor dmaBufDescriptor);
 
@@ -141,6 +190,9 @@ private:
 
     /// @brief Native DOCA structure deleter
     DeleterPtr deleter = nullptr;
+
+    /// @brief Callbacks to run before memory map is stopped or destroyed
+    MemoryMapStopNotifierPtr stopNotifier = std::make_shared<MemoryMapStopNotifier>();
 };
 
 ///
@@ -153,7 +205,7 @@ public:
     /// [Fabric Methods]
 
     /// @brief Creates remote memory map instance
-    static std::tuple<RemoteMemoryMapPtr, error> CreateFromExport(std::vector<std::uint8_t> & exportDesc,
+    static std::tuple<RemoteMemoryMapPtr, error> CreateFromExport(const std::vector<std::uint8_t> & exportDesc,
                                                                   DevicePtr device);
 
     /// [Functionality]
@@ -167,6 +219,14 @@ public:
     /// @brief Gets memory region mapped in memory map
     std::tuple<RemoteMemoryRangeHandle, error> GetRemoteMemoryRange();
 
+    /// [Stop Notification]
+
+    /// @brief Registers callback invoked before memory map is stopped or destroyed
+    MemoryMapStopCallbackId AddStopCallback(MemoryMapStopCallback callback);
+
+    /// @brief Removes previously registered stop callback
+    void RemoveStopCallback(MemoryMapStopCallbackId callbackId);
+
     /// [Unsafe]
 
     /// @brief Gets native pointer to DOCA structure
@@ -213,6 +273,9 @@ private:
 
     /// @brief Native DOCA structure deleter
     DeleterPtr deleter = nullptr;
+
+    /// @brief Callbacks to run before memory map is stopped or destroyed
+    MemoryMapStopNotifierPtr stopNotifier = std::make_shared<MemoryMapStopNotifier>();
 };
 
 }  // namespace doca
@@ -60,6 +60,17 @@ public:
     /// @brief Gets number of all inflight tasks in this ProgressEngine
     std::tuple<std::size_t, error> GetNumInflightTasks() const;
 
+    /// [Notification]
+
+    /// @brief Gets handle (file descriptor) that becomes readable on next event once notification is requested
+    std::tuple<doca_notification_handle_t, error> GetNotificationHandle() const;
+
+    /// @brief Arms notification handle; progress once more afterwards, events that came before arming do not notify
+    error RequestNotification();
+
+    /// @brief Clears notification handle after it became readable
+    error ClearNotification(doca_notification_handle_t handle);
+
     /// [Unsafe]
 
     /// @brief Gets native pointer to DOCA structure
@@ -0,0 +1,246 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <errors/errors.hpp>
+#include <functional>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <tuple>
+#include <vector>
+
+#include "doca-cpp/core/device.hpp"
+#include "doca-cpp/core/error.hpp"
+#include "doca-cpp/core/mmap.hpp"
+#include "doca-cpp/core/types.hpp"
+
+namespace doca
+{
+
+// Forward declarations
+class MemoryRegistration;
+class MemoryRegistrationCache;
+
+// Type aliases
+using MemoryRegistrationPtr = std::shared_ptr<MemoryRegistration>;
+using MemoryRegistrationCachePtr = std::shared_ptr<MemoryRegistrationCache>;
+
+///
+/// @brief
+/// MemoryRegistration is lease of memory map taken from registration cache. Registered memory covers at least leased
+/// range. Registration can not be evicted from cache while lease is alive.
+///
+class MemoryRegistration
+{
+public:
+    /// [Accessors]
+
+    /// @brief Gets memory map covering leased range
+    MemoryMapPtr GetMemoryMap() const;
+
+    /// @brief Gets whole memory range registered in memory map; it may be wider than leased range
+    MemoryRangeHandle GetRegisteredRange() const;
+
+    /// [Construction & Destruction]
+
+#pragma region MemoryRegistration::Construct
+
+    /// @brief Copy constructor is deleted
+    MemoryRegistration(const MemoryRegistration &) = delete;
+
+    /// @brief Copy operator is deleted
+    MemoryRegistration & operator=(const MemoryRegistration &) = delete;
+
+    /// @brief Move constructor is deleted
+    MemoryRegistration(MemoryRegistration && other) noexcept = delete;
+
+    /// @brief Move operator is deleted
+    MemoryRegistration & operator=(MemoryRegistration && other) noexcept = delete;
+
+    /// @brief Constructor
+    /// @warning Avoid using this constructor; registrations are created by registration cache
+    explicit MemoryRegistration(MemoryMapPtr initialMemoryMap, MemoryRangeHandle initialRange,
+                                std::function<void()> initialRelease);
+
+    /// @brief Destructor returns lease to cache
+    ~MemoryRegistration();
+
+#pragma endregion
+
+private:
+    /// [Properties]
+
+    /// @brief Memory map covering leased range
+    MemoryMapPtr memoryMap = nullptr;
+
+    /// @brief Memory range registered in memory map
+    MemoryRangeHandle registeredRange;
+
+    /// @brief Routine returning lease to cache
+    std::function<void()> release = nullptr;
+};
+
+///
+/// @brief
+/// MemoryRegistrationCache keeps started memory maps keyed by address range so short-lived buffers over the same
+/// memory do not pay for pinning and NIC translation setup on every use. Range is served from cache when registered
+/// range contains it with sufficient permissions. On miss, unused registrations overlapping requested range are merged
+/// into one wider registration. Unused registrations are evicted in least recently used order to keep pinned bytes
+/// within budget.
+///
+/// Every registration is tied to owners of memory it covers. Once any owner is destroyed, memory may be freed and
+/// its address reused by other allocation, so registration is never served or merged again and is released as soon
+/// as it is unused.
+///
+class MemoryRegistrationCache : public std::enable_shared_from_this<MemoryRegistrationCache>
+{
+public:
+    /// [Nested Types]
+
+    /// @brief Configuration of registration cache
+    struct Config {
+        /// @brief Budget of bytes pinned by unused registrations; leased registrations may exceed it
+        std::size_t maxPinnedBytes = 1024ull * 1024 * 1024;
+    };
+
+    /// @brief Registration cache counters
+    struct Statistics {
+        std::uint64_t hits = 0;
+        std::uint64_t misses = 0;
+        std::uint64_t merges = 0;
+        std::uint64_t evictions = 0;
+        std::size_t entries = 0;
+        std::size_t pinnedBytes = 0;
+
+        /// @brief Gets share of lookups served from cache
+        double HitRate() const;
+    };
+
+    /// [Fabric Methods]
+
+    /// @brief Creates registration cache mapping memory to given device
+    static std::tuple<MemoryRegistrationCachePtr, error> Create(DevicePtr device, const Config & config);
+
+    /// [Registration]
+
+    /// @brief Leases registration covering given memory range with at least given permissions. Owner is object keeping
+    /// memory alive, such as its memory allocation; registration is not reused once owner is destroyed
+    /// @note Registrations exposed for remote access (RDMA read or write) are never merged, since their exported
+    /// descriptor must describe exactly requested range
+    std::tuple<MemoryRegistrationPtr, error> Acquire(MemoryRangeHandle memoryRange, AccessFlags permissions,
+                                                     std::weak_ptr<const void> owner);
+
+    /// [Management]
+
+    /// @brief Releases all unused registrations
+    void Clear();
+
+    /// @brief Gets cache counters
+    Statistics GetStatistics() const;
+
+    /// [Construction & Destruction]
+
+#pragma region MemoryRegistrationCache::Construct
+
+    /// @brief Copy constructor is deleted
+    MemoryRegistrationCache(const MemoryRegistrationCache &) = delete;
+
+    /// @brief Copy operator is deleted
+    MemoryRegistrationCache & operator=(const MemoryRegistrationCache &) = delete;
+
+    /// @brief Move constructor is deleted
+    MemoryRegistrationCache(MemoryRegistrationCache && other) noexcept = delete;
+
+    /// @brief Move operator is deleted
+    MemoryRegistrationCache & operator=(MemoryRegistrationCache && other) noexcept = delete;
+
+    /// @brief Constructor
+    /// @warning Avoid using this constructor since class has static fabric methods
+    explicit MemoryRegistrationCache(DevicePtr initialDevice, const Config & initialConfig);
+
+    /// @brief Destructor
+    ~MemoryRegistrationCache();
+
+#pragma endregion
+
+private:
+    /// [Nested Types]
+
+    /// @brief Cache entry identifier
+    using EntryId = std::uint64_t;
+
+    /// @brief Cached registration
+    struct Entry {
+        MemoryMapPtr memoryMap = nullptr;
+        MemoryRangeHandle range;
+        AccessFlags permissions = AccessFlags::localReadWrite;
+        std::size_t leases = 0;
+        std::list<EntryId>::iterator usage;
+        /// @brief Owners of memory covered by registration; merged registration covers memory of several owners
+        std::vector<std::weak_ptr<const void>> owners;
+
+        /// @brief Checks if memory of any owner may have been freed
+        bool IsStale() const;
+    };
+
+    /// [Private Methods]
+
+    /// @brief Finds entry containing given range with sufficient permissions; unused stale entries met on the way are
+    /// moved out of cache
+    /// @warning Must be called with cache mutex held
+    Entry * findContaining(std::uintptr_t begin, std::uintptr_t end, AccessFlags permissions, EntryId & entryId,
+                           std::vector<MemoryMapPtr> & evicted);
+
+    /// @brief Creates lease of entry
+    /// @warning Must be called with cache mutex held
+    MemoryRegistrationPtr lease(EntryId entryId, Entry & entry);
+
+    /// @brief Returns lease of entry to cache
+    void returnLease(EntryId entryId);
+
+    /// @brief Moves unused entries whose memory may have been freed out of cache
+    /// @warning Must be called with cache mutex held
+    void removeStale(const std::vector<EntryId> & candidates, std::vector<MemoryMapPtr> & evicted);
+
+    /// @brief Moves unused entries out of cache until pinned bytes fit budget
+    /// @warning Must be called with cache mutex held
+    void evictOverBudget(std::vector<MemoryMapPtr> & evicted);
+
+    /// @brief Moves entry out of cache and gives its memory map to caller to release after unlocking cache
+    /// @warning Must be called with cache mutex held
+    MemoryMapPtr remove(EntryId entryId);
+
+    /// [Properties]
+
+    /// @brief Device memory is mapped to
+    DevicePtr device = nullptr;
+
+    /// @brief Configuration of registration cache
+    Config config;
+
+    /// @brief Cached entries by identifier
+    std::map<EntryId, Entry> entries;
+
+    /// @brief Entry identifiers by start address; registrations of leased ranges may overlap
+    std::multimap<std::uintptr_t, EntryId> entriesByAddress;
+
+    /// @brief Entry identifiers ordered from most to least recently used
+    std::list<EntryId> usageOrder;
+
+    /// @brief Length of longest cached range; bounds backward search of containing entry
+    std::size_t maxRangeLength = 0;
+
+    /// @brief Next entry identifier
+    EntryId nextEntryId = 0;
+
+    /// @brief Cache counters
+    Statistics statistics;
+
+    /// @brief Guards cache storage
+    mutable std::mutex cacheMutex;
+};
+
+}  // namespace doca
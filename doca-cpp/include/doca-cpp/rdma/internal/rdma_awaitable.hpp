@@ -32,6 +32,9 @@ public:
     /// @brief Blocking await method for RDMA operation result retrieval with timeout
     RdmaOperationResponce AwaitWithTimeout(const std::chrono::milliseconds timeout);
 
+    /// @brief Checks without blocking if RDMA operation result is ready
+    bool IsReady() const;
+
     /// [Construction & Destruction]
 
 #pragma region RdmaAwaitable::Construct
@@ -0,0 +1,227 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <errors/errors.hpp>
+#include <functional>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <tuple>
+#include <vector>
+
+#include "doca-cpp/core/buffer.hpp"
+#include "doca-cpp/core/mmap.hpp"
+
+namespace doca::rdma
+{
+
+// Forward declarations
+class RdmaBufferCache;
+class RdmaBufferLease;
+
+// Type aliases
+using RdmaBufferCachePtr = std::shared_ptr<RdmaBufferCache>;
+using RdmaBufferLeasePtr = std::shared_ptr<RdmaBufferLease>;
+
+///
+/// @brief
+/// RdmaBufferLease is DOCA buffer taken from buffer cache for one RDMA operation. Cached buffer is in use while lease
+/// is alive, so it is neither reset for other operation nor given back to inventory while RDMA task uses it.
+///
+class RdmaBufferLease
+{
+public:
+    /// [Accessors]
+
+    /// @brief Gets leased DOCA buffer
+    doca::BufferPtr GetBuffer() const;
+
+    /// [Construction & Destruction]
+
+#pragma region RdmaBufferLease::Construct
+
+    /// @brief Copy constructor is deleted
+    RdmaBufferLease(const RdmaBufferLease &) = delete;
+
+    /// @brief Copy operator is deleted
+    RdmaBufferLease & operator=(const RdmaBufferLease &) = delete;
+
+    /// @brief Move constructor is deleted
+    RdmaBufferLease(RdmaBufferLease && other) noexcept = delete;
+
+    /// @brief Move operator is deleted
+    RdmaBufferLease & operator=(RdmaBufferLease && other) noexcept = delete;
+
+    /// @brief Constructor
+    /// @warning Avoid using this constructor; leases are created by buffer cache
+    explicit RdmaBufferLease(doca::BufferPtr initialBuffer, std::function<void()> initialRelease);
+
+    /// @brief Destructor returns buffer to cache
+    ~RdmaBufferLease();
+
+#pragma endregion
+
+private:
+    /// [Properties]
+
+    /// @brief Leased DOCA buffer
+    doca::BufferPtr buffer = nullptr;
+
+    /// @brief Routine returning buffer to cache
+    std::function<void()> release = nullptr;
+};
+
+///
+/// @brief
+/// RDMA buffer cache keeps prepared DOCA buffers keyed by memory map and memory range. Endpoint buffers are used for
+/// many operations, so DOCA buffer is taken from inventory once and its data section is reset on every next use.
+/// Cached buffer is leased to one operation at a time: operation over the same memory started meanwhile gets its own
+/// buffer from inventory, and buffers in use are never evicted. Cached buffers are released when their memory map is
+/// stopped or destroyed, or once operations using them complete.
+///
+class RdmaBufferCache : public std::enable_shared_from_this<RdmaBufferCache>
+{
+public:
+    /// [Nested Types]
+
+    /// @brief Role of cached buffer in RDMA operation
+    enum class Direction : std::uint8_t {
+        source,
+        destination,
+    };
+
+    /// [Fabric Methods]
+
+    /// @brief Creates buffer cache taking buffers from given inventory
+    static RdmaBufferCachePtr Create(doca::ElasticBufferInventoryPtr inventory, std::size_t maxEntries);
+
+    /// [Buffer Retrieval]
+
+    /// @brief Leases local DOCA buffer for memory range mapped in given memory map; lease must be held until RDMA task
+    /// using buffer completes
+    std::tuple<RdmaBufferLeasePtr, error> GetBuffer(doca::MemoryMapPtr memoryMap, std::span<std::uint8_t> memoryRange,
+                                                    Direction direction);
+
+    /// @brief Leases remote DOCA buffer for memory range mapped in given remote memory map; lease must be held until
+    /// RDMA task using buffer completes
+    std::tuple<RdmaBufferLeasePtr, error> GetBuffer(doca::RemoteMemoryMapPtr memoryMap,
+                                                    std::span<std::uint8_t> memoryRange, Direction direction);
+
+    /// [Management]
+
+    /// @brief Releases all cached buffers back to inventory
+    void Clear();
+
+    /// @brief Gets number of cached buffers
+    std::size_t Size() const;
+
+    /// [Construction & Destruction]
+
+#pragma region RdmaBufferCache::Construct
+
+    /// @brief Copy constructor is deleted
+    RdmaBufferCache(const RdmaBufferCache &) = delete;
+
+    /// @brief Copy operator is deleted
+    RdmaBufferCache & operator=(const RdmaBufferCache &) = delete;
+
+    /// @brief Move constructor is deleted
+    RdmaBufferCache(RdmaBufferCache && other) noexcept = delete;
+
+    /// @brief Move operator is deleted
+    RdmaBufferCache & operator=(RdmaBufferCache && other) noexcept = delete;
+
+    /// @brief Constructor
+    /// @warning Avoid using this constructor since class has static fabric methods
+    explicit RdmaBufferCache(doca::ElasticBufferInventoryPtr initialInventory, std::size_t maxEntries);
+
+    /// @brief Destructor
+    ~RdmaBufferCache();
+
+#pragma endregion
+
+private:
+    /// [Nested Types]
+
+    /// @brief Cache key: memory map object, memory range and buffer role
+    struct Key {
+        const void * memoryMap = nullptr;
+        const void * address = nullptr;
+        std::size_t length = 0;
+        Direction direction = Direction::source;
+
+        auto operator<=>(const Key & other) const = default;
+    };
+
+    /// @brief Cached buffer with callback unregistration routine
+    struct Entry {
+        doca::BufferPtr buffer = nullptr;
+        std::function<void()> removeStopCallback = nullptr;
+        std::list<Key>::iterator usage;
+        /// @brief Number of leases of buffer; buffer in use is not reset, evicted or released
+        std::size_t inUse = 0;
+        /// @brief Buffer was already given back to inventory
+        bool bufferReturned = false;
+    };
+
+    /// [Private Methods]
+
+    /// @brief Leases cached buffer or allocates new one from inventory
+    template <typename MemoryMapType>
+    std::tuple<RdmaBufferLeasePtr, error> getBuffer(std::shared_ptr<MemoryMapType> memoryMap,
+                                                    std::span<std::uint8_t> memoryRange, Direction direction);
+
+    /// @brief Allocates buffer from inventory; when inventory is exhausted, unused cached buffers are evicted until
+    /// one is free
+    /// @warning Must be called with cache mutex held
+    template <typename MemoryMapType>
+    std::tuple<doca::BufferPtr, error> allocateBuffer(std::shared_ptr<MemoryMapType> memoryMap,
+                                                      std::span<std::uint8_t> memoryRange, Direction direction,
+                                                      std::vector<Entry> & evicted);
+
+    /// @brief Makes lease of cached buffer
+    RdmaBufferLeasePtr lease(const Key & key, doca::BufferPtr buffer);
+
+    /// @brief Returns lease of cached buffer; buffer of entry invalidated while in use is released with last lease
+    void returnLease(const Key & key, doca::BufferPtr buffer);
+
+    /// @brief Prepares cached buffer data section for next operation
+    static error resetBuffer(doca::BufferPtr buffer, std::span<std::uint8_t> memoryRange, Direction direction);
+
+    /// @brief Releases all buffers cached for given memory map
+    void invalidate(const void * memoryMap);
+
+    /// @brief Moves least recently used entry not in use out of cache and gives its buffer back to inventory; caller
+    /// releases rest of entry after unlocking cache. Returns false when every cached buffer is in use
+    /// @warning Must be called with cache mutex held
+    bool evictLeastRecentlyUsed(std::vector<Entry> & evicted);
+
+    /// @brief Releases buffer back to inventory
+    static void release(Entry & entry);
+
+    /// [Properties]
+
+    /// @brief Inventory buffers are taken from
+    doca::ElasticBufferInventoryPtr inventory = nullptr;
+
+    /// @brief Maximum number of cached buffers
+    std::size_t maxEntries = 0;
+
+    /// @brief Cached buffers
+    std::map<Key, Entry> entries;
+
+    /// @brief Keys ordered from most to least recently used
+    std::list<Key> usageOrder;
+
+    /// @brief Entries invalidated while in use; released when their last lease is returned
+    std::list<Entry> retiredEntries;
+
+    /// @brief Guards cache storage since memory maps may be stopped from any thread
+    mutable std::mutex cacheMutex;
+};
+
+}  // namespace doca::rdma
@@ -1,9 +1,15 @@
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include <cstring>
+#include <errors/errors.hpp>
 #include <iostream>
 #include <memory>
+#include <span>
+#include <string>
+#include <tuple>
+#include <type_traits>
 #include <vector>
 
 #include "doca-cpp/rdma/internal/rdma_connection.hpp"
@@ -20,13 +26,44 @@ namespace doca::rdma::communication
 /// Port where out-of-band communication is handled
 inline constexpr uint16_t Port = 41007;
 
+/// @brief Largest message accepted from peer, so that corrupted frame length does not make session allocate memory
+inline constexpr std::size_t MaxMessageSize = 64 * 1024 * 1024;
+
+/// @brief Error types of communication messages
+namespace ErrorTypes
+{
+/// @brief Caller buffer can not hold serialized message; serializer returns size message needs along with it
+inline const auto MessageBufferTooSmall = errors::New("Message buffer is too small");
+/// @brief Received message is shorter than its fields
+inline const auto MessageTruncated = errors::New("Message is truncated");
+}  // namespace ErrorTypes
+
+/// @brief Identifier of request within session; responce and acknowledge carry ID of request they belong to, so
+/// several requests may be outstanding in one session and be answered out of order
+using RequestId = std::uint64_t;
+
+/// @brief Type of message; every serialized message starts with it, so one session carries messages of all types
+enum class MessageType : std::uint8_t {
+    request = 0x01,
+    responce,
+    acknowledge,
+    catalogRequest,
+    catalog,
+    groupRequest,
+    groupResponce,
+};
+
 ///
 /// @brief RDMA operation request message format
 ///
 /// This message must be sent by client to server to request RDMA operation over specified RDMA endpoint.
 ///
 struct Request {
+    RequestId requestId = 0;
     RdmaEndpointType endpointType = RdmaEndpointType::write;
+    /// @brief Number of endpoint from server catalog; zero means endpoint is addressed by path and type
+    std::uint32_t endpointNumber = 0;
+    /// @brief Path of endpoint; empty when endpoint is addressed by number
     RdmaEndpointPath endpointPath;
 };
 
@@ -35,7 +72,9 @@ struct Request {
 ///
 /// This message will be sent by server to client to allow or reject RDMA operation over specified RDMA endpoint. It
 /// also contains optional endpoint's buffer memory descriptor to allow client map remote memory and perform RDMA write
-/// or read.
+/// or read. Descriptor generation changes only when endpoint's buffer is remapped, so client may reuse remote memory
+/// imported from descriptor with the same generation. Memory offset and length address endpoint's buffer within
+/// memory region described by descriptor, since several buffers may share one descriptor.
 ///
 struct Responce {
     enum class Code : std::uint8_t {
@@ -49,10 +88,20 @@ struct Responce {
 
     static std::string CodeDescription(const Code & code);
 
-    using RemoteMemoryDescriptor = std::vector<std::uint8_t>;
+    using RemoteMemoryDescriptor = RdmaMemoryDescriptor;
+    using RemoteMemoryDescriptorPtr = RdmaMemoryDescriptorPtr;
 
+    RequestId requestId = 0;
     Code responceCode = Code::operationRejected;
-    RemoteMemoryDescriptor memoryDescriptor;
+    std::uint64_t descriptorGeneration = 0;
+    std::uint64_t memoryOffset = 0;
+    /// @brief Length of endpoint's buffer; zero means whole region after offset
+    std::uint64_t memoryLength = 0;
+    /// @brief Buffer slot of endpoint handed out for this operation
+    std::uint32_t slotIndex = 0;
+    /// @brief Descriptor is shared with endpoint's buffer to avoid copying it into every responce. Descriptor is not
+    /// sent again if client already got descriptor of the same generation in this session (e.g. from catalog)
+    RemoteMemoryDescriptorPtr memoryDescriptor = nullptr;
 };
 
 ///
@@ -70,35 +119,155 @@ struct Acknowledge {
         operationCompleted,
     };
 
+    RequestId requestId = 0;
     Code ackCode = Code::operationCanceled;
 };
 
+///
+/// @brief Endpoint catalog request message format
+///
+/// This message is sent by client once at session start to get server endpoint catalog.
+///
+struct CatalogRequest {
+    RequestId requestId = 0;
+};
+
+///
+/// @brief Endpoint catalog message format
+///
+/// This message is sent by server in reply to catalog request. It lists every server endpoint with compact number,
+/// type, path and location of every buffer slot, and carries descriptors of mapped memory regions once per region.
+/// Client imports descriptors once per session and then addresses endpoints by number; responces to such requests
+/// carry no descriptor unless memory was remapped since catalog was sent.
+///
+struct Catalog {
+    /// @brief Memory region described by exported descriptor
+    struct Region {
+        std::uint64_t descriptorGeneration = 0;
+        RdmaMemoryDescriptorPtr memoryDescriptor = nullptr;
+    };
+
+    /// @brief Location of endpoint's buffer slot within memory region; zero generation means memory is not mapped yet
+    struct Slot {
+        std::uint64_t descriptorGeneration = 0;
+        std::uint64_t memoryOffset = 0;
+        std::uint64_t memoryLength = 0;
+    };
+
+    /// @brief Catalog entry of endpoint
+    struct Endpoint {
+        std::uint32_t endpointNumber = 0;
+        RdmaEndpointType endpointType = RdmaEndpointType::write;
+        RdmaEndpointPath endpointPath;
+        std::vector<Slot> slots;
+    };
+
+    RequestId requestId = 0;
+    std::vector<Region> regions;
+    std::vector<Endpoint> endpoints;
+};
+
+///
+/// @brief Group request message format
+///
+/// This message is sent by client to request RDMA operations over several endpoints at once. Server locks slots of all
+/// endpoints or of none of them and answers with one group responce; one acknowledge with group request ID closes the
+/// group. Entries are addressed like single requests; their request IDs are not used.
+///
+struct GroupRequest {
+    RequestId requestId = 0;
+    std::vector<Request> requests;
+};
+
+///
+/// @brief Group responce message format
+///
+/// This message is sent by server in reply to group request. Group code is operationPermitted only if every entry is
+/// permitted; otherwise it is code of first entry that failed and no slot stays locked. Entries follow order of
+/// request entries and carry slot location and descriptor like single responce.
+///
+struct GroupResponce {
+    RequestId requestId = 0;
+    Responce::Code responceCode = Responce::Code::operationRejected;
+    std::vector<Responce> responces;
+};
+
 ///
 /// @brief Communication channel message serializer class
 ///
-/// This class provides static methods to serialize and deserialize communication channel messages: Request, Responce
-/// and Acknowledge.
+/// This class provides static methods to serialize and deserialize communication channel messages: Request, Responce,
+/// Acknowledge, CatalogRequest, Catalog, GroupRequest and GroupResponce. Messages are serialized into caller buffer,
+/// so session reuses its frame buffers instead of allocating one per message. Messages are parsed from span of received bytes with bounds
+/// checking; malformed message is reported as error instead of being read past its end.
 ///
 class MessageSerializer
 {
 public:
-    /// @brief Serializes RDMA operation request message to byte buffer
-    static std::vector<uint8_t> SerializeRequest(const Request & request);
+    /// [Message Type]
+
+    /// @brief Gets type of serialized message
+    static std::tuple<MessageType, error> GetMessageType(std::span<const std::uint8_t> buffer);
+
+    /// [Serialization]
+
+    /// @brief Serializes RDMA operation request message into buffer; returns number of bytes written. If buffer is too
+    /// small, returns size message needs along with MessageBufferTooSmall error
+    static std::tuple<std::size_t, error> Serialize(const Request & request, std::span<std::uint8_t> buffer);
+
+    /// @brief Serializes RDMA operation responce message into buffer
+    static std::tuple<std::size_t, error> Serialize(const Responce & responce, std::span<std::uint8_t> buffer);
 
-    /// @brief Deserializes RDMA operation request message from byte buffer
-    static Request DeserializeRequest(const std::vector<uint8_t> & buffer);
+    /// @brief Serializes RDMA operation acknowledge message into buffer
+    static std::tuple<std::size_t, error> Serialize(const Acknowledge & ack, std::span<std::uint8_t> buffer);
 
-    /// @brief Serializes RDMA operation responce message to byte buffer
-    static std::vector<uint8_t> SerializeResponse(const Responce & responce);
+    /// @brief Serializes endpoint catalog request message into buffer
+    static std::tuple<std::size_t, error> Serialize(const CatalogRequest & catalogRequest,
+                                                    std::span<std::uint8_t> buffer);
 
-    /// @brief Deserializes RDMA operation responce message from byte buffer
-    static Responce DeserializeResponse(const std::vector<uint8_t> & buffer);
+    /// @brief Serializes endpoint catalog message into buffer
+    static std::tuple<std::size_t, error> Serialize(const Catalog & catalog, std::span<std::uint8_t> buffer);
 
-    /// @brief Serializes RDMA operation acknowledge message to byte buffer
-    static std::vector<uint8_t> SerializeAcknowledge(const Acknowledge & ack);
+    /// @brief Serializes group request message into buffer
+    static std::tuple<std::size_t, error> Serialize(const GroupRequest & groupRequest, std::span<std::uint8_t> buffer);
 
-    /// @brief Deserializes RDMA operation acknowledge message from byte buffer
-    static Acknowledge DeserializeAcknowledge(const std::vector<uint8_t> & buffer);
+    /// @brief Serializes group responce message into buffer
+    static std::tuple<std::size_t, error> Serialize(const GroupResponce & groupResponce,
+                                                    std::span<std::uint8_t> buffer);
+
+    /// @brief Gets size of serialized message
+    template <typename Message>
+    static std::size_t SerializedSize(const Message & message);
+
+    /// [Deserialization]
+
+    /// @brief Deserializes RDMA operation request message
+    static std::tuple<Request, error> DeserializeRequest(std::span<const std::uint8_t> buffer);
+
+    /// @brief Deserializes RDMA operation responce message
+    static std::tuple<Responce, error> DeserializeResponse(std::span<const std::uint8_t> buffer);
+
+    /// @brief Deserializes RDMA operation acknowledge message
+    static std::tuple<Acknowledge, error> DeserializeAcknowledge(std::span<const std::uint8_t> buffer);
+
+    /// @brief Deserializes endpoint catalog request message
+    static std::tuple<CatalogRequest, error> DeserializeCatalogRequest(std::span<const std::uint8_t> buffer);
+
+    /// @brief Deserializes endpoint catalog message
+    static std::tuple<Catalog, error> DeserializeCatalog(std::span<const std::uint8_t> buffer);
+
+    /// @brief Deserializes group request message
+    static std::tuple<GroupRequest, error> DeserializeGroupRequest(std::span<const std::uint8_t> buffer);
+
+    /// @brief Deserializes group responce message
+    static std::tuple<GroupResponce, error> DeserializeGroupResponce(std::span<const std::uint8_t> buffer);
 };
 
-}  // namespace doca::rdma::communication
\ No newline at end of file
+template <typename Message>
+std::size_t MessageSerializer::SerializedSize(const Message & message)
+{
+    // Empty buffer holds nothing, so serializer only counts bytes
+    auto [size, _] = MessageSerializer::Serialize(message, std::span<std::uint8_t>());
+    return size;
+}
+
+}  // namespace doca::rdma::communication
@@ -1,10 +1,15 @@
 #pragma once
 
+#include <algorithm>
 #include <atomic>
+#include <cerrno>
+#include <chrono>
 #include <condition_variable>
 #include <cstddef>
+#include <cstring>
 #include <errors/errors.hpp>
 #include <future>
+#include <list>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -12,11 +17,14 @@
 #include <queue>
 #include <span>
 #include <thread>
+#include <vector>
 
 #include "doca-cpp/core/context.hpp"
 #include "doca-cpp/core/device.hpp"
 #include "doca-cpp/core/progress_engine.hpp"
+#include "doca-cpp/core/registration_cache.hpp"
 #include "doca-cpp/rdma/internal/rdma_awaitable.hpp"
+#include "doca-cpp/rdma/internal/rdma_buffer_cache.hpp"
 #include "doca-cpp/rdma/internal/rdma_engine.hpp"
 #include "doca-cpp/rdma/internal/rdma_operation.hpp"
 #include "doca-cpp/rdma/internal/rdma_task.hpp"
@@ -36,27 +44,44 @@ using RdmaExecutorPtr = std::shared_ptr<RdmaExecutor>;
 namespace ErrorTypes
 {
 inline const auto TimeoutExpired = errors::New("Timeout expired");
+inline const auto ShutDown = errors::New("Executor is shut down");
 }  // namespace ErrorTypes
 
 ///
 /// @brief
 /// RDMA executor controls RDMA operations performing and task submission. Creates thread that waits for RDMA requests
-/// in queue and then perfroms it. Provides RDMA context and progress engine initialization. Manages DOCA resources and
-/// wraps DOCA operations with connections and task completion polling
+/// in queue and keeps up to Limits::maxInflightOperations of them submitted at once, so their transfers overlap.
+/// While operations are in flight, thread sleeps on progress engine notification until tasks complete, new request
+/// comes or nearest operation deadline expires. Provides RDMA context and progress engine initialization. Manages
+/// DOCA resources and wraps DOCA operations with connections and task completion polling
 ///
 class RdmaExecutor
 {
 public:
+    /// [Nested Types]
+
+    /// @brief Workload limits executor resources are sized for
+    struct Limits {
+        /// @brief Maximum number of RDMA operations submitted but not completed per connection
+        std::size_t maxInflightOperations = 8;
+        /// @brief Maximum number of RDMA connections
+        std::size_t maxConnections = 16;
+        /// @brief Budget of bytes kept pinned by registration cache for buffers that were not mapped by owner
+        std::size_t maxRegisteredBytes = 1024ull * 1024 * 1024;
+        /// @brief Time RDMA operation may take before it fails with timeout; zero disables deadline
+        std::chrono::milliseconds operationTimeout = 10s;
+    };
+
     /// [Fabric Methods]
 
     /// @brief Creates RDMA executor associated with given device
-    static std::tuple<RdmaExecutorPtr, error> Create(doca::DevicePtr initialDevice);
+    static std::tuple<RdmaExecutorPtr, error> Create(doca::DevicePtr initialDevice, const Limits & limits = Limits{});
 
     /// [Run & Stop]
 
     /// @brief Initializes RDMA context and starts it
     error Start();
-    /// @brief Stop RDMA context and working thread
+    /// @brief Stop RDMA context and working thread; operations not completed yet fail
     void Stop();
 
     /// [Connection Management]
@@ -84,14 +109,31 @@ public:
 
     /// @brief Submits RDMA operation to working thread
     std::tuple<RdmaAwaitable, error> SubmitOperation(RdmaOperationRequest request);
-    /// @brief Runs progress engine iteration with task completion polling
-    void Progress();
+    /// @brief Runs progress engine iteration with task completion polling; returns number of processed events
+    std::uint32_t Progress();
+
+    /// [Progress Notification]
+
+    /// @brief Gets progress engine notification handle, so event loop can wait for RDMA events instead of polling
+    std::tuple<doca_notification_handle_t, error> GetProgressNotificationHandle() const;
+    /// @brief Arms progress engine notification and progresses once more to catch events that came before arming
+    error RequestProgressNotification();
+    /// @brief Clears progress engine notification handle after it became readable
+    error ClearProgressNotification(doca_notification_handle_t handle);
 
     /// [Device]
 
     /// @brief Gets associated device
     doca::DevicePtr GetDevice();
 
+    /// [Statistics]
+
+    /// @brief Gets usage statistics of buffer inventory
+    std::tuple<doca::ElasticBufferInventory::Statistics, error> GetBufferInventoryStatistics() const;
+
+    /// @brief Gets counters of registration cache used for buffers that were not mapped by owner
+    std::tuple<doca::MemoryRegistrationCache::Statistics, error> GetRegistrationCacheStatistics() const;
+
     /// [Construction & Destruction]
 
 #pragma region RdmaExecutor::Construct
@@ -115,6 +157,7 @@ public:
     struct Config {
         RdmaEnginePtr initialRdmaEngine = nullptr;
         doca::DevicePtr initialDevice = nullptr;
+        Limits limits = Limits{};
     };
 
     /// @brief Constructor
@@ -127,20 +170,54 @@ public:
 #pragma endregion
 
 private:
+    /// [Nested Types]
+
+    /// @brief RDMA operation taken from queue by worker thread and not completed yet
+    struct InflightOperation {
+        RdmaOperationRequest request;
+        /// @brief Submitted task; freed when operation completes
+        RdmaTaskInterfacePtr task = nullptr;
+        /// @brief Changed by task callbacks; operation is not moved while task is in flight
+        IRdmaTask::State taskState = IRdmaTask::State::idle;
+        /// @brief Leases of cached DOCA buffers; buffers are not reused by other operations until operation completes
+        RdmaBufferLeasePtr sourceBuffer = nullptr;
+        RdmaBufferLeasePtr destinationBuffer = nullptr;
+        /// @brief Lease of local memory registration, if any, held until operation completes
+        doca::MemoryRegistrationPtr registration = nullptr;
+        /// @brief Time request fails with timeout if task has not completed by then
+        std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::time_point::max();
+        /// @brief Request already failed by timeout or stop; operation is kept until its task finishes, since task
+        /// callbacks still change its state
+        bool requestCompleted = false;
+    };
+
 #pragma region RdmaExecutor::PrivateMethods
     /// [Worker]
 
-    /// @brief Working thread that polls RDMA requests queue and submits RDMA task
+    /// @brief Working thread that takes RDMA requests from queue, submits their tasks and completes them
     void workerLoop();
 
     /// [Operation Execution]
 
-    /// @brief Executes RDMA operation from request
-    RdmaOperationResponce executeOperation(RdmaOperationRequest & request);
-    /// @brief Executes RDMA Read operation from request
-    RdmaOperationResponce executeRead(RdmaOperationRequest & request);
-    /// @brief Executes RDMA Write operation from request
-    RdmaOperationResponce executeWrite(RdmaOperationRequest & request);
+    /// @brief Submits RDMA task of operation
+    error startOperation(InflightOperation & operation);
+    /// @brief Submits RDMA Read task of operation
+    error startRead(InflightOperation & operation);
+    /// @brief Submits RDMA Write task of operation
+    error startWrite(InflightOperation & operation);
+    /// @brief Frees tasks of completed operations, sets their responces and removes them from list
+    void completeOperations(std::list<InflightOperation> & inflight);
+    /// @brief Fails requests of operations which deadline expired
+    void expireOperations(std::list<InflightOperation> & inflight);
+    /// @brief Fails requests of all operations with given error
+    void failOperations(std::list<InflightOperation> & inflight, error err);
+    /// @brief Waits for progress engine notification, new request or nearest operation deadline
+    void waitForEvents(const std::list<InflightOperation> & inflight);
+    /// @brief Wakes worker thread waiting for events
+    void wakeWorker();
+    /// @brief Wakes waiting worker thread when other thread processed progress engine events: notification handle is
+    /// shared with event loops, so worker may miss completions they process
+    void wakeWorkerOnProgress(std::uint32_t processed);
 
     /// [Completion Waiting]
 
@@ -150,23 +227,28 @@ private:
 
     /// @brief Waits for specified RDMA context state running progress engine with timeout
     error waitForContextState(doca::Context::State desiredState, std::chrono::milliseconds waitTimeout = 0ms) const;
-    /// @brief Waits for specified RDMA task completion state running progress engine with timeout
-    error waitForTaskState(IRdmaTask::State desiredState, IRdmaTask::State & changingState,
-                           std::chrono::milliseconds waitTimeout = 0ms);
     /// @brief Waits for specified RDMA connection state running progress engine with timeout
     error waitForConnectionState(RdmaConnection::State desiredState, RdmaConnection::State & changingState,
                                  std::chrono::milliseconds waitTimeout = 0ms);
 
     /// [Buffer Retrieval]
 
-    /// @brief Gets local DOCA buffer considered as source for RDMA operation
-    std::tuple<doca::BufferPtr, error> getSourceLocalBuffer(RdmaBufferPtr rdmaBuffer);
-    /// @brief Gets local DOCA buffer considered as destination for RDMA operation
-    std::tuple<doca::BufferPtr, error> getDestinationLocalBuffer(RdmaBufferPtr rdmaBuffer);
-    /// @brief Gets remote DOCA buffer considered as source for RDMA operation
-    std::tuple<doca::BufferPtr, error> getSourceRemoteBuffer(RdmaRemoteBufferPtr rdmaBuffer);
-    /// @brief Gets remote DOCA buffer considered as destination for RDMA operation
-    std::tuple<doca::BufferPtr, error> getDestinationRemoteBuffer(RdmaRemoteBufferPtr rdmaBuffer);
+    /// @brief Gets memory map of local buffer; memory of unmapped buffer is leased from registration cache
+    std::tuple<doca::MemoryMapPtr, doca::MemoryRegistrationPtr, error> getLocalMemoryMap(
+        RdmaBufferPtr rdmaBuffer, doca::MemoryRangeHandle memoryRange);
+    /// @brief Leases local DOCA buffer considered as source for RDMA operation; buffer and registration leases must
+    /// be held until operation completes
+    std::tuple<RdmaBufferLeasePtr, doca::MemoryRegistrationPtr, error> getSourceLocalBuffer(RdmaBufferPtr rdmaBuffer);
+    /// @brief Leases local DOCA buffer considered as destination for RDMA operation; buffer and registration leases
+    /// must be held until operation completes
+    std::tuple<RdmaBufferLeasePtr, doca::MemoryRegistrationPtr, error> getDestinationLocalBuffer(
+        RdmaBufferPtr rdmaBuffer);
+    /// @brief Leases remote DOCA buffer considered as source for RDMA operation; lease must be held until operation
+    /// completes
+    std::tuple<RdmaBufferLeasePtr, error> getSourceRemoteBuffer(RdmaRemoteBufferPtr rdmaBuffer);
+    /// @brief Leases remote DOCA buffer considered as destination for RDMA operation; lease must be held until
+    /// operation completes
+    std::tuple<RdmaBufferLeasePtr, error> getDestinationRemoteBuffer(RdmaRemoteBufferPtr rdmaBuffer);
 
 #pragma endregion
 
@@ -184,16 +266,26 @@ private:
     std::mutex queueMutex;
     /// @brief Queue with RDMA operation requests condition variable
     std::condition_variable queueCondVar;
+    /// @brief Serializes progress engine polling; engine is polled by serving loop, worker thread and control
+    /// threads waiting for connection
+    std::mutex progressMutex;
+    /// @brief Event file descriptor waking worker thread waiting for progress engine notification
+    int workerWakeupFd = -1;
+    /// @brief Flag indicating worker thread waits for events and must be woken on progress or new request
+    std::atomic<bool> workerWaiting = false;
 
     /// [Device]
 
     /// @brief Associated device
     doca::DevicePtr device = nullptr;
 
+    /// @brief Workload limits executor resources are sized for
+    Limits limits;
+
     /// [Connections Storage]
 
-    /// @brief Active connection
-    RdmaConnectionPtr activeConnection = nullptr;
+    /// @brief Active connection; read by control threads while progress engine callbacks replace it
+    std::atomic<RdmaConnectionPtr> activeConnection = nullptr;
     /// @brief Requested connection
     RdmaConnectionPtr requestedConnection = nullptr;
 
@@ -205,8 +297,18 @@ private:
     doca::ContextPtr rdmaContext = nullptr;
     /// @brief RDMA Progress Engine for task completion polling
     doca::ProgressEnginePtr progressEngine = nullptr;
-    /// @brief RDMA buffer inventory for buffer management
-    doca::BufferInventoryPtr bufferInventory = nullptr;
+    /// @brief RDMA buffer inventory for buffer management; grows on demand up to limits
+    doca::ElasticBufferInventoryPtr bufferInventory = nullptr;
+    /// @brief Cache of DOCA buffers prepared for RDMA buffers memory
+    RdmaBufferCachePtr bufferCache = nullptr;
+    /// @brief Cache of memory registrations for local buffers that were not mapped by owner
+    doca::MemoryRegistrationCachePtr registrationCache = nullptr;
+
+    /// [Abandoned Operations]
+
+    /// @brief Operations which tasks did not finish before worker thread stopped; kept since task callbacks may still
+    /// change their state. Declared last, so they are destroyed before components their buffers come from
+    std::list<InflightOperation> abandonedOperations;
 };
 
 }  // namespace doca::rdma
\ No newline at end of file
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <errors/errors.hpp>
+#include <format>
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <vector>
+
+namespace doca::rdma
+{
+
+/// @brief Constants for consistent hash ring
+namespace constants
+{
+/// @brief Points every server takes on hash ring; more points spread keys between servers more evenly
+inline constexpr std::size_t HashRingVirtualNodes = 160;
+}  // namespace constants
+
+// Forward declarations
+class RdmaHashRing;
+
+// Type aliases
+using RdmaHashRingPtr = std::shared_ptr<RdmaHashRing>;
+
+///
+/// @brief
+/// Consistent hash ring mapping keys to servers. Every server takes several points on ring and key belongs to server
+/// owning first point after key hash, so adding or removing server moves only keys of ring arcs it gains or loses.
+/// Hash does not depend on process, so every client maps keys the same way. Ring is not thread safe; its owner guards
+/// it.
+///
+class RdmaHashRing
+{
+public:
+    /// [Fabric Methods]
+
+    /// @brief Creates empty hash ring
+    static RdmaHashRingPtr Create(std::size_t virtualNodes = constants::HashRingVirtualNodes);
+
+    /// [Membership]
+
+    /// @brief Adds server with its points to ring
+    error AddServer(const std::string & serverId);
+
+    /// @brief Removes server with its points from ring
+    error RemoveServer(const std::string & serverId);
+
+    /// @brief Lists servers on ring
+    std::vector<std::string> ListServers() const;
+
+    /// @brief Checks if ring has no servers
+    bool Empty() const;
+
+    /// [Lookup]
+
+    /// @brief Gets server key belongs to
+    std::tuple<std::string, error> GetServer(std::string_view key) const;
+
+    /// [Construction & Destruction]
+
+#pragma region RdmaHashRing::Construct
+
+    /// @brief Copy constructor is deleted
+    RdmaHashRing(const RdmaHashRing &) = delete;
+
+    /// @brief Copy operator is deleted
+    RdmaHashRing & operator=(const RdmaHashRing &) = delete;
+
+    /// @brief Constructor
+    /// @warning Avoid using this constructor since class has static fabric methods
+    explicit RdmaHashRing(std::size_t virtualNodes);
+
+    /// @brief Destructor
+    ~RdmaHashRing() = default;
+
+#pragma endregion
+
+private:
+    /// [Properties]
+
+    /// @brief Number of points of every server
+    std::size_t virtualNodes = 0;
+
+    /// @brief Ring points ordered by hash and servers owning them
+    std::map<std::uint64_t, std::string> points;
+
+    /// @brief Servers on ring
+    std::set<std::string> servers;
+};
+
+}  // namespace doca::rdma
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <errors/errors.hpp>
+#include <functional>
 #include <future>
 #include <memory>
 #include <tuple>
@@ -52,6 +53,8 @@ struct RdmaOperationRequest {
     std::size_t bytesAffected = 0;
     // Responce promise
     RdmaOperationRequestPromise responcePromise = nullptr;
+    // Called on executor thread after responce is set, so waiter is woken instead of polling promise
+    std::function<void()> onCompleted = nullptr;
 };
 
 }  // namespace doca::rdma
\ No newline at end of file
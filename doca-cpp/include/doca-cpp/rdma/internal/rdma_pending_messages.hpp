@@ -0,0 +1,124 @@
+#pragma once
+
+#include <asio.hpp>
+#include <chrono>
+#include <errors/errors.hpp>
+#include <map>
+#include <memory>
+#include <optional>
+#include <tuple>
+
+#include "doca-cpp/rdma/internal/rdma_communication.hpp"
+#include "doca-cpp/rdma/internal/rdma_executor.hpp"
+
+namespace doca::rdma
+{
+
+///
+/// @brief
+/// Control messages awaited by request ID. Session reader delivers every received message to coroutine waiting for
+/// message of the same request, so several requests may be outstanding in one session and be answered in any order.
+/// Messages nobody waits for (e.g. arriving after timeout) are dropped.
+///
+template <typename Message>
+class RdmaPendingMessages
+{
+public:
+    /// [Waiting]
+
+    /// @brief Registers waiter for message of given request; must be called before message can be received
+    void Expect(communication::RequestId requestId, asio::any_io_executor executor);
+
+    /// @brief Waits for expected message with timeout; waiter is removed afterwards
+    asio::awaitable<std::tuple<Message, error>> Wait(communication::RequestId requestId,
+                                                     std::chrono::milliseconds timeout);
+
+    /// @brief Removes waiter of request whose message will never be received
+    void Discard(communication::RequestId requestId);
+
+    /// [Delivery]
+
+    /// @brief Delivers message to its waiter; returns false if nobody waits for it
+    bool Deliver(const Message & message);
+
+    /// @brief Fails all waiters with given error, e.g. when session is closed
+    void FailAll(error err);
+
+private:
+    /// [Nested Types]
+
+    /// @brief Coroutine waiting for message; timer is cancelled to wake it up
+    struct Waiter {
+        explicit Waiter(asio::any_io_executor executor) : timer(executor, asio::steady_timer::time_point::max()) {}
+
+        asio::steady_timer timer;
+        std::optional<Message> message;
+        error err = nullptr;
+    };
+
+    /// [Properties]
+
+    /// @brief Waiters by request ID
+    std::map<communication::RequestId, std::shared_ptr<Waiter>> waiters;
+};
+
+template <typename Message>
+void RdmaPendingMessages<Message>::Expect(communication::RequestId requestId, asio::any_io_executor executor)
+{
+    this->waiters.insert_or_assign(requestId, std::make_shared<Waiter>(executor));
+}
+
+template <typename Message>
+asio::awaitable<std::tuple<Message, error>> RdmaPendingMessages<Message>::Wait(communication::RequestId requestId,
+                                                                               std::chrono::milliseconds timeout)
+{
+    auto found = this->waiters.find(requestId);
+    if (found == this->waiters.end()) {
+        co_return std::make_tuple(Message(), errors::New("No message is expected for given request"));
+    }
+    auto waiter = found->second;
+
+    // Message may have been delivered before waiting started
+    if (!waiter->message.has_value() && waiter->err == nullptr) {
+        waiter->timer.expires_after(timeout);
+        std::ignore = co_await waiter->timer.async_wait(asio::as_tuple(asio::use_awaitable));
+    }
+    this->waiters.erase(requestId);
+
+    if (waiter->err) {
+        co_return std::make_tuple(Message(), waiter->err);
+    }
+    if (!waiter->message.has_value()) {
+        co_return std::make_tuple(Message(), ErrorTypes::TimeoutExpired);
+    }
+    co_return std::make_tuple(*waiter->message, nullptr);
+}
+
+template <typename Message>
+void RdmaPendingMessages<Message>::Discard(communication::RequestId requestId)
+{
+    this->waiters.erase(requestId);
+}
+
+template <typename Message>
+bool RdmaPendingMessages<Message>::Deliver(const Message & message)
+{
+    auto found = this->waiters.find(message.requestId);
+    if (found == this->waiters.end()) {
+        return false;
+    }
+    found->second->message = message;
+    found->second->timer.cancel();
+    return true;
+}
+
+template <typename Message>
+void RdmaPendingMessages<Message>::FailAll(error err)
+{
+    for (auto & [requestId, waiter] : this->waiters) {
+        waiter->err = err;
+        waiter->timer.cancel();
+    }
+}
+
+}  // namespace doca::rdma
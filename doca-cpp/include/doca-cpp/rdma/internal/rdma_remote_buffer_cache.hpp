@@ -0,0 +1,116 @@
+#pragma once
+
+#include <cstdint>
+#include <errors/errors.hpp>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <tuple>
+#include <vector>
+
+#include "doca-cpp/core/device.hpp"
+#include "doca-cpp/core/mmap.hpp"
+#include "doca-cpp/rdma/rdma_buffer.hpp"
+#include "doca-cpp/rdma/rdma_endpoint.hpp"
+
+namespace doca::rdma
+{
+
+// Forward declarations
+class RdmaRemoteBufferCache;
+
+// Type aliases
+using RdmaRemoteBufferCachePtr = std::shared_ptr<RdmaRemoteBufferCache>;
+
+///
+/// @brief
+/// RDMA remote buffer cache keeps remote buffers imported from descriptors sent by server. Importing descriptor
+/// creates remote memory map, so imported buffer is reused for every next operation over the same endpoint until
+/// server reports new descriptor generation. Endpoints whose buffers share one server memory region report the same
+/// descriptor generation, so their buffers are addressed by offset within one shared remote memory map.
+///
+class RdmaRemoteBufferCache
+{
+public:
+    /// [Fabric Methods]
+
+    /// @brief Creates empty remote buffer cache
+    static RdmaRemoteBufferCachePtr Create();
+
+    /// [Buffer Retrieval]
+
+    /// @brief Gets cached remote buffer of endpoint if its generation and location match given ones; otherwise creates
+    /// remote buffer at given offset and length of remote memory imported from descriptor and caches it. Remote memory
+    /// imported for the same generation is shared between endpoints. Zero generation is never cached
+    std::tuple<RdmaRemoteBufferPtr, error> GetOrImport(const RdmaEndpointId & endpointId, std::uint64_t generation,
+                                                       std::uint64_t offset, std::uint64_t length,
+                                                       const std::vector<std::uint8_t> & descriptor,
+                                                       doca::DevicePtr device);
+
+    /// [Management]
+
+    /// @brief Removes cached remote buffer of endpoint
+    void Invalidate(const RdmaEndpointId & endpointId);
+
+    /// @brief Removes all cached remote buffers
+    void Clear();
+
+    /// @brief Gets number of cached remote buffers
+    std::size_t Size() const;
+
+    /// [Construction & Destruction]
+
+#pragma region RdmaRemoteBufferCache::Construct
+
+    /// @brief Copy constructor is deleted
+    RdmaRemoteBufferCache(const RdmaRemoteBufferCache &) = delete;
+
+    /// @brief Copy operator is deleted
+    RdmaRemoteBufferCache & operator=(const RdmaRemoteBufferCache &) = delete;
+
+    /// @brief Move constructor is deleted
+    RdmaRemoteBufferCache(RdmaRemoteBufferCache && other) noexcept = delete;
+
+    /// @brief Move operator is deleted
+    RdmaRemoteBufferCache & operator=(RdmaRemoteBufferCache && other) noexcept = delete;
+
+    /// @brief Default constructor
+    RdmaRemoteBufferCache() = default;
+
+    /// @brief Destructor
+    ~RdmaRemoteBufferCache() = default;
+
+#pragma endregion
+
+private:
+    /// [Nested Types]
+
+    /// @brief Imported remote buffer with descriptor generation and location it was imported from
+    struct Entry {
+        std::uint64_t generation = 0;
+        std::uint64_t offset = 0;
+        std::uint64_t length = 0;
+        RdmaRemoteBufferPtr buffer = nullptr;
+    };
+
+    /// [Private Methods]
+
+    /// @brief Gets remote memory imported for given generation or imports it from descriptor
+    /// @warning Must be called with cache mutex held
+    std::tuple<doca::RemoteMemoryMapPtr, error> getOrImportMemoryMap(std::uint64_t generation,
+                                                                     const std::vector<std::uint8_t> & descriptor,
+                                                                     doca::DevicePtr device);
+
+    /// [Properties]
+
+    /// @brief Cached remote buffers by endpoint
+    std::map<RdmaEndpointId, Entry> entries;
+
+    /// @brief Remote memory maps by descriptor generation; maps are owned by cached buffers and shared between them
+    std::map<std::uint64_t, std::weak_ptr<doca::RemoteMemoryMap>> memoryMaps;
+
+    /// @brief Guards cache storage
+    mutable std::mutex cacheMutex;
+};
+
+}  // namespace doca::rdma
@@ -0,0 +1,192 @@
+#pragma once
+
+#include <algorithm>
+#include <asio.hpp>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <deque>
+#include <errors/errors.hpp>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+#include "doca-cpp/rdma/rdma_buffer.hpp"
+#include "doca-cpp/rdma/rdma_endpoint.hpp"
+
+namespace doca::rdma
+{
+
+// Forward declarations
+class RdmaServiceExecutor;
+
+// Type aliases
+using RdmaServiceExecutorPtr = std::shared_ptr<RdmaServiceExecutor>;
+
+///
+/// @brief
+/// Executor running endpoint services off control threads. Server sessions hand service handlers to it and resume
+/// when handler completes, so slow service does not stall control traffic of other clients. Asynchronous services do
+/// not block, so they are awaited on caller's executor instead of taking worker thread. Number of queued handlers is
+/// bounded: session waits for room in queue, which slows down clients when services fall behind. Waiting sessions get
+/// room in order they came. Submitted buffers of one endpoint may be gathered into batch and handled by one
+/// HandleBatch call.
+///
+class RdmaServiceExecutor
+{
+public:
+    /// [Nested Types]
+
+    /// @brief How handlers are scheduled on worker threads
+    enum class Mode {
+        /// @brief Any handler runs on any free worker thread
+        threadPool,
+        /// @brief Handlers of one endpoint run one after another in order of submission; different endpoints run in
+        /// parallel
+        serialPerEndpoint,
+    };
+
+    /// @brief Configuration of service executor
+    struct Config {
+        Mode mode = Mode::threadPool;
+        /// @brief Number of worker threads; 0 uses all hardware threads
+        std::size_t numThreads = 1;
+        /// @brief Maximum number of handlers queued or running
+        std::size_t maxQueuedHandlers = 1024;
+        /// @brief Most submitted buffers of endpoint handled by one HandleBatch call; 1 disables batching
+        std::size_t maxBatchSize = 1;
+        /// @brief How long first buffer of batch waits for more buffers before batch is handled
+        std::chrono::microseconds batchWindow{ 50 };
+    };
+
+    /// @brief Called after handler completes: on worker thread, or on caller's executor for asynchronous service
+    using CompletionCallback = std::function<void(error)>;
+
+    /// [Fabric Methods]
+
+    /// @brief Creates service executor and starts its worker threads
+    static std::tuple<RdmaServiceExecutorPtr, error> Create(const Config & config);
+
+    /// [Execution]
+
+    /// @brief Runs endpoint service for buffer on worker thread and resumes caller when it completes; asynchronous
+    /// service is awaited on caller's executor
+    asio::awaitable<error> Run(RdmaEndpointPtr endpoint, RdmaBufferPtr buffer);
+
+    /// @brief Queues endpoint service for buffer without waiting for it; waits only for room in queue. Callback is
+    /// called with result of handler; when batching is enabled buffer may wait for batch window and result is result
+    /// of whole batch
+    asio::awaitable<error> Submit(RdmaEndpointPtr endpoint, RdmaBufferPtr buffer, CompletionCallback onComplete);
+
+    /// @brief Waits for queued handlers and stops worker threads
+    void Stop();
+
+    /// [Construction & Destruction]
+
+#pragma region RdmaServiceExecutor::Construct
+
+    /// @brief Copy constructor is deleted
+    RdmaServiceExecutor(const RdmaServiceExecutor &) = delete;
+
+    /// @brief Copy operator is deleted
+    RdmaServiceExecutor & operator=(const RdmaServiceExecutor &) = delete;
+
+    /// @brief Constructor
+    /// @warning Avoid using this constructor since class has static fabric methods
+    explicit RdmaServiceExecutor(const Config & config, std::size_t numThreads);
+
+    /// @brief Destructor stops worker threads
+    ~RdmaServiceExecutor();
+
+#pragma endregion
+
+private:
+    /// [Nested Types]
+
+    /// @brief Submitted buffers of endpoint waiting to be handled together
+    struct PendingBatch {
+        explicit PendingBatch(asio::any_io_executor executor) : timer(executor) {}
+
+        RdmaEndpointPtr endpoint = nullptr;
+        std::vector<RdmaBufferPtr> buffers;
+        std::vector<CompletionCallback> callbacks;
+        /// @brief Expires when batch window of first buffer ends
+        asio::steady_timer timer;
+    };
+
+    using PendingBatchPtr = std::shared_ptr<PendingBatch>;
+
+    /// @brief Caller waiting for room in queue; woken by handler which hands its place over
+    struct QueueSlotWaiter {
+        explicit QueueSlotWaiter(asio::any_io_executor initialExecutor)
+            : executor(initialExecutor), timer(initialExecutor, asio::steady_timer::time_point::max())
+        {
+        }
+
+        /// @brief Executor of waiting caller; waiter is touched only on it
+        asio::any_io_executor executor;
+        /// @brief Cancelled when place in queue is handed over
+        asio::steady_timer timer;
+        bool granted = false;
+    };
+
+    using QueueSlotWaiterPtr = std::shared_ptr<QueueSlotWaiter>;
+
+    /// [Private Methods]
+
+    /// @brief Queues handler; synchronous service may be batched only when caller does not wait for result
+    asio::awaitable<error> submitHandler(RdmaEndpointPtr endpoint, RdmaBufferPtr buffer, CompletionCallback onComplete,
+                                         bool allowBatch);
+
+    /// @brief Adds buffer to pending batch of endpoint; batch is handled once full or once its window ends
+    void addToBatch(RdmaEndpointPtr endpoint, RdmaBufferPtr buffer, CompletionCallback onComplete);
+
+    /// @brief Posts batch to executor of its endpoint; called with batches mutex locked to keep batches in order
+    void dispatchBatch(PendingBatchPtr batch);
+
+    /// @brief Waits for room in queue and takes place of one handler
+    asio::awaitable<void> acquireQueueSlot();
+
+    /// @brief Frees places of given number of handlers; places go to waiting callers first
+    void releaseQueueSlots(std::size_t count);
+
+    /// @brief Gets executor handlers of endpoint are posted to according to mode
+    asio::any_io_executor endpointExecutor(const RdmaEndpointPtr & endpoint);
+
+    /// [Properties]
+
+    /// @brief Executor configuration
+    Config config;
+
+    /// @brief Worker threads
+    asio::thread_pool workers;
+
+    /// @brief Handlers queued or running, including asynchronous ones
+    std::size_t queuedHandlers = 0;
+
+    /// @brief Callers waiting for room in queue in order they came
+    std::deque<QueueSlotWaiterPtr> slotWaiters;
+
+    /// @brief Guards queued handlers counter and waiters
+    std::mutex queueMutex;
+
+    /// @brief Strands serializing handlers of every endpoint in serial mode
+    std::map<RdmaEndpointId, asio::strand<asio::thread_pool::executor_type>> endpointStrands;
+
+    /// @brief Guards endpoint strands
+    std::mutex strandsMutex;
+
+    /// @brief Batches being gathered, at most one per endpoint
+    std::map<RdmaEndpointId, PendingBatchPtr> pendingBatches;
+
+    /// @brief Guards pending batches
+    std::mutex batchesMutex;
+};
+
+}  // namespace doca::rdma
@@ -1,17 +1,31 @@
 #pragma once
 
+#include <algorithm>
 #include <asio.hpp>
 #include <asio/experimental/awaitable_operators.hpp>
 #include <chrono>
+#include <cstdint>
+#include <deque>
 #include <errors/errors.hpp>
+#include <map>
 #include <memory>
 #include <mutex>
+#include <numeric>
+#include <optional>
 #include <set>
+#include <span>
 #include <string>
+#include <tuple>
+#include <variant>
+#include <vector>
 
 #include "doca-cpp/rdma/internal/rdma_communication.hpp"
 #include "doca-cpp/rdma/internal/rdma_executor.hpp"
 #include "doca-cpp/rdma/internal/rdma_operation.hpp"
+#include "doca-cpp/rdma/internal/rdma_pending_messages.hpp"
+#include "doca-cpp/rdma/internal/rdma_remote_buffer_cache.hpp"
+#include "doca-cpp/rdma/internal/rdma_service_executor.hpp"
+#include "doca-cpp/rdma/internal/rdma_transport.hpp"
 #include "doca-cpp/rdma/rdma_endpoint.hpp"
 
 namespace doca::rdma
@@ -23,8 +37,31 @@ namespace constants
 /// @brief Timeout for waiting for RDMA operation completion
 inline constexpr std::chrono::milliseconds RdmaOperationTimeout = 5000ms;
 
+/// @brief Interval of checking if endpoint mapped in background is ready
+inline constexpr std::chrono::milliseconds EndpointMappingPollInterval = 1ms;
+
+/// @brief Maximum number of requests of one server session handled at once; session reads next request only when
+/// there is room
+inline constexpr std::size_t MaxSessionRequestsInFlight = 64;
+
+/// @brief Initial size of session read buffer; it grows to hold larger frame
+inline constexpr std::size_t ReadBufferSize = 64 * 1024;
+
+/// @brief Initial size of frame buffer; small control messages fit into it
+inline constexpr std::size_t FrameBufferSize = 256;
+
+/// @brief Number of written frame buffers kept for reuse
+inline constexpr std::size_t MaxFreeFrames = 16;
+
 }  // namespace constants
 
+/// @brief Error types for RDMA session operations
+namespace ErrorTypes
+{
+/// @brief Request did not reach server, so it is safe to send it again over new session
+inline const auto RequestNotDelivered = errors::New("Request was not delivered to server");
+}  // namespace ErrorTypes
+
 // Forward declarations
 class RdmaSession;
 class RdmaSessionServer;
@@ -40,27 +77,49 @@ using namespace std::chrono_literals;
 
 // Session handler coroutines
 
-/// @brief Coroutine to handle a communication session on server side
+/// @brief Coroutine to handle a communication session on server side. Requests are dispatched concurrently, up to
+/// constants::MaxSessionRequestsInFlight at once, so requests for independent endpoints do not wait for each other.
+/// Session returns only after all its request handlers complete; their first error or exception is returned.
+/// Services run on service executor and never on control thread; filled slots of multi-slot write endpoints are
+/// handed to it without waiting, so session serves next request while service runs
 asio::awaitable<error> HandleServerSession(RdmaSessionServerPtr session, RdmaEndpointStoragePtr endpointsStorage,
-                                           RdmaExecutorPtr executor);
+                                           RdmaExecutorPtr executor, RdmaServiceExecutorPtr serviceExecutor);
+
+/// @brief Coroutine to fetch server endpoint catalog at start of client session. Memory of registered endpoints is
+/// imported from catalog descriptors once, so following requests address endpoints by number and get no descriptors
+asio::awaitable<error> HandleClientCatalog(RdmaSessionClientPtr session, RdmaEndpointStoragePtr endpointsStorage,
+                                           RdmaExecutorPtr executor, RdmaRemoteBufferCachePtr remoteBufferCache);
 
 /// @brief Coroutine to handle a communication session on client side
 asio::awaitable<error> HandleClientSession(RdmaSessionClientPtr session, RdmaEndpointPtr endpoint,
-                                           RdmaExecutorPtr executor);
+                                           RdmaExecutorPtr executor, RdmaRemoteBufferCachePtr remoteBufferCache);
+
+/// @brief Coroutine to process several endpoints by one group request on client side: one request and responce lock
+/// all endpoints, their RDMA operations run together and one acknowledge closes the group
+asio::awaitable<error> HandleClientGroup(RdmaSessionClientPtr session, std::vector<RdmaEndpointPtr> endpoints,
+                                         RdmaExecutorPtr executor, RdmaRemoteBufferCachePtr remoteBufferCache);
 
 ///
 /// @brief
-/// Base RDMA session class providing common socket-based communication functionality.
+/// Base RDMA session class providing common communication functionality over control transport.
 /// Provides RDMA send and receive operations through the executor.
 ///
 class RdmaSession
 {
 public:
+    /// [Setup]
+
+    /// @brief Completes setup of control transport with peer; called once before first message
+    asio::awaitable<error> Open();
+
     /// [State]
 
     /// @brief Checks if session is open
     bool IsOpen() const;
 
+    /// @brief Closes session transport; session is closed on transport failures so that it is not reused
+    void Close();
+
     /// [Construction & Destruction]
 
 #pragma region RdmaSession::Construct
@@ -78,7 +137,7 @@ public:
     RdmaSession & operator=(RdmaSession && other) noexcept = delete;
 
     /// @brief Constructor
-    explicit RdmaSession(asio::ip::tcp::socket socket);
+    explicit RdmaSession(RdmaTransportPtr transport);
 
     /// @brief Destructor
     ~RdmaSession();
@@ -86,10 +145,56 @@ public:
 #pragma endregion
 
 protected:
+    /// [Framing]
+
+    /// @brief Serializes message into reused frame buffer and writes it as one length-prefixed frame
+    template <typename Message>
+    asio::awaitable<error> writeMessage(const Message & message);
+
+    /// @brief Writes serialized message as one length-prefixed frame. Frames of concurrent requests are queued and
+    /// written together by one vectored write, so that they do not interleave on transport
+    /// @note Caller whose frame was queued behind other frames is not told about failed write; session is closed then
+    asio::awaitable<error> writeFrame(std::vector<std::uint8_t> frame);
+
+    /// @brief Reads one length-prefixed frame. Transport is read in large chunks, so several small frames are taken by
+    /// one read
+    /// @warning Returned message points into read buffer and is valid until next read
+    asio::awaitable<std::tuple<std::span<const std::uint8_t>, error>> readMessage();
+
+    /// @brief Takes frame buffer of written frame for reuse or makes new one
+    std::vector<std::uint8_t> acquireFrame();
+
+    /// @brief Keeps buffer of written frame for reuse
+    void releaseFrame(std::vector<std::uint8_t> frame);
+
     /// [Properties]
 
-    /// @brief TCP socket for session communication
-    asio::ip::tcp::socket socket;
+    /// @brief Control transport of session; client session has none until connected
+    RdmaTransportPtr transport;
+
+    /// @brief Frames waiting to be written
+    std::deque<std::vector<std::uint8_t>> writeQueue;
+
+    /// @brief Buffers of written frames kept for reuse
+    std::vector<std::vector<std::uint8_t>> freeFrames;
+
+    /// @brief Length prefixes of frames being written
+    std::vector<std::uint32_t> frameLengths;
+
+    /// @brief Buffer sequence of frames being written
+    std::vector<asio::const_buffer> writeBuffers;
+
+    /// @brief Some coroutine is writing queued frames
+    bool writeInProgress = false;
+
+    /// @brief Received bytes; frames are parsed from it in place
+    std::vector<std::uint8_t> readBuffer;
+
+    /// @brief Beginning of received bytes not taken yet
+    std::size_t readBegin = 0;
+
+    /// @brief End of received bytes
+    std::size_t readEnd = 0;
 };
 
 ///
@@ -102,19 +207,31 @@ class RdmaSessionServer : public RdmaSession
 public:
     /// [Fabric Methods]
 
-    /// @brief Creates server session from TCP socket
-    static RdmaSessionServerPtr Create(asio::ip::tcp::socket socket);
+    /// @brief Creates server session from accepted control transport
+    static RdmaSessionServerPtr Create(RdmaTransportPtr transport);
 
     /// [Communication]
 
-    /// @brief Receives request from client
-    asio::awaitable<std::tuple<communication::Request, error>> ReceiveRequest();
+    /// @brief Receives next endpoint, group or catalog request from client; acknowledges received meanwhile are
+    /// delivered to their requests
+    asio::awaitable<std::tuple<
+        std::variant<communication::Request, communication::CatalogRequest, communication::GroupRequest>, error>>
+    ReceiveRequest();
 
-    /// @brief Sends response to client
+    /// @brief Sends response to client; acknowledge is expected for every permitted request. Memory descriptor is
+    /// left out if client already got descriptor of the same generation in this session
     asio::awaitable<error> SendResponse(const communication::Responce & response);
 
-    /// @brief Waits for acknowledgment with timeout
-    asio::awaitable<std::tuple<communication::Acknowledge, error>> ReceiveAcknowledge(std::chrono::seconds timeout);
+    /// @brief Sends endpoint catalog to client; descriptors of catalog regions are not sent again in this session
+    asio::awaitable<error> SendCatalog(const communication::Catalog & catalog);
+
+    /// @brief Sends group responce to client; one acknowledge is expected for permitted group. Descriptors are left
+    /// out like in single responce
+    asio::awaitable<error> SendGroupResponse(const communication::GroupResponce & response);
+
+    /// @brief Waits for acknowledgment of given request with timeout
+    asio::awaitable<std::tuple<communication::Acknowledge, error>> ReceiveAcknowledge(
+        communication::RequestId requestId, std::chrono::seconds timeout);
 
     /// [RDMA Operations]
 
@@ -138,12 +255,26 @@ public:
     RdmaSessionServer & operator=(RdmaSessionServer && other) noexcept = delete;
 
     /// @brief Constructor
-    explicit RdmaSessionServer(asio::ip::tcp::socket socket);
+    explicit RdmaSessionServer(RdmaTransportPtr transport);
 
     /// @brief Destructor
     ~RdmaSessionServer() = default;
 
 #pragma endregion
+
+private:
+    /// [Private Methods]
+
+    /// @brief Leaves out descriptor of permitted responce if client already got descriptor of the same generation
+    void omitSentDescriptor(communication::Responce & response);
+
+    /// [Properties]
+
+    /// @brief Acknowledges awaited by permitted requests
+    RdmaPendingMessages<communication::Acknowledge> pendingAcknowledges;
+
+    /// @brief Generations of memory descriptors already sent to client in this session
+    std::set<std::uint64_t> sentGenerations;
 };
 
 ///
@@ -151,28 +282,35 @@ public:
 /// Client-side RDMA session for connecting to servers and performing RDMA operations.
 /// Provides connection management, request/response communication, and RDMA read/write operations.
 ///
-class RdmaSessionClient : public RdmaSession
+class RdmaSessionClient : public RdmaSession, public std::enable_shared_from_this<RdmaSessionClient>
 {
 public:
     /// [Fabric Methods]
 
-    /// @brief Creates client session from TCP socket
-    static RdmaSessionClientPtr Create(asio::ip::tcp::socket socket);
+    /// @brief Creates client session; transport is connected by Connect()
+    static RdmaSessionClientPtr Create();
 
     /// [Connection Management]
 
-    /// @brief Connects to server
-    asio::awaitable<error> Connect(const std::string & serverAddress, uint16_t serverPort);
+    /// @brief Connects to server by transport selected by control address
+    asio::awaitable<error> Connect(const RdmaControlAddress & address);
 
     /// [Communication]
 
-    /// @brief Sends request to server and receives response
+    /// @brief Sends request to server and receives response. Request is given new request ID, so several requests may
+    /// be outstanding in session
     asio::awaitable<std::tuple<communication::Responce, error>> SendRequest(const communication::Request & request,
                                                                             const std::chrono::seconds & timeout);
 
-    /// @brief Sends acknowledge to server
-    asio::awaitable<error> SendAcknowledge(const communication::Acknowledge & ack,
-                                           const std::chrono::seconds & timeout);
+    /// @brief Sends acknowledge to server; acknowledge carries ID of request it belongs to
+    asio::awaitable<error> SendAcknowledge(const communication::Acknowledge & ack);
+
+    /// @brief Requests server endpoint catalog. Endpoints listed in catalog are requested by number afterwards
+    asio::awaitable<std::tuple<communication::Catalog, error>> RequestCatalog(const std::chrono::seconds & timeout);
+
+    /// @brief Sends group request to server and receives group responce; group is given new request ID
+    asio::awaitable<std::tuple<communication::GroupResponce, error>> SendGroupRequest(
+        const communication::GroupRequest & request, const std::chrono::seconds & timeout);
 
     /// [RDMA Operations]
 
@@ -205,7 +343,7 @@ public:
     RdmaSessionClient & operator=(RdmaSessionClient && other) noexcept = delete;
 
     /// @brief Constructor
-    explicit RdmaSessionClient(asio::ip::tcp::socket socket);
+    RdmaSessionClient();
 
     /// @brief Destructor
     ~RdmaSessionClient() = default;
@@ -213,10 +351,55 @@ public:
 #pragma endregion
 
 private:
+    /// [Private Methods]
+
+    /// @brief Reads responces and delivers them to requests waiting for them until session is closed
+    static asio::awaitable<void> readResponces(RdmaSessionClientPtr session);
+
+    /// @brief Addresses request to endpoint by catalog number instead of path if endpoint is listed in catalog
+    void addressByNumber(communication::Request & request) const;
+
     /// [Properties]
 
     /// @brief Flag indicating client is connected to server
     bool isConnected = false;
+
+    /// @brief ID given to next request
+    communication::RequestId nextRequestId = 1;
+
+    /// @brief Responces awaited by outstanding requests
+    RdmaPendingMessages<communication::Responce> pendingResponces;
+
+    /// @brief Catalogs awaited by outstanding catalog requests
+    RdmaPendingMessages<communication::Catalog> pendingCatalogs;
+
+    /// @brief Group responces awaited by outstanding group requests
+    RdmaPendingMessages<communication::GroupResponce> pendingGroupResponces;
+
+    /// @brief Server endpoint numbers from catalog by endpoint ID
+    std::map<RdmaEndpointId, std::uint32_t> endpointNumbers;
 };
 
+template <typename Message>
+asio::awaitable<error> RdmaSession::writeMessage(const Message & message)
+{
+    auto frame = this->acquireFrame();
+
+    std::size_t size = 0;
+    error err = nullptr;
+    std::tie(size, err) = communication::MessageSerializer::Serialize(message, frame);
+    if (errors::Is(err, communication::ErrorTypes::MessageBufferTooSmall)) {
+        // Frame buffer grows for large message (e.g. catalog) and keeps its size when reused
+        frame.resize(size);
+        std::tie(size, err) = communication::MessageSerializer::Serialize(message, frame);
+    }
+    if (err) {
+        this->releaseFrame(std::move(frame));
+        co_return errors::Wrap(err, "Failed to serialize message");
+    }
+    frame.resize(size);
+
+    co_return co_await this->writeFrame(std::move(frame));
+}
+
 }  // namespace doca::rdma
@@ -0,0 +1,396 @@
+#pragma once
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <array>
+#include <asio.hpp>
+#include <atomic>
+#include <bit>
+#include <cerrno>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <errors/errors.hpp>
+#include <format>
+#include <limits>
+#include <new>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+
+#include "doca-cpp/rdma/internal/rdma_communication.hpp"
+
+namespace doca::rdma
+{
+
+/// @brief Constants for control channel transports
+namespace constants
+{
+/// @brief Capacity of every shared memory ring; must be power of two
+inline constexpr std::size_t SharedMemoryRingCapacity = 1024 * 1024;
+
+/// @brief Interval of checking if peer freed space in full shared memory ring
+inline constexpr std::chrono::microseconds SharedMemoryFullPollInterval{ 50 };
+
+/// @brief Longest shared memory segment name accepted from peer
+inline constexpr std::size_t SharedMemoryNameMaxLength = 255;
+}  // namespace constants
+
+// Forward declarations
+class RdmaTransport;
+class RdmaSharedMemoryTransport;
+class RdmaTransportListener;
+
+// Type aliases
+using RdmaTransportPtr = std::shared_ptr<RdmaTransport>;
+using RdmaTransportListenerPtr = std::shared_ptr<RdmaTransportListener>;
+
+///
+/// @brief
+/// Address of control channel. Scheme of address string selects transport:
+///   tcp://host:port — TCP socket; host is listen address on server and may be empty
+///   unix:///path    — Unix domain socket at given path, for client and server on the same host
+///   shm:///path     — shared memory rings; Unix domain socket at given path is used to set them up and to wake peer
+/// Messages and their framing are the same for every transport.
+///
+struct RdmaControlAddress {
+    /// @brief Transport selected by address scheme
+    enum class Scheme {
+        tcp,
+        unixSocket,
+        sharedMemory,
+    };
+
+    Scheme scheme = Scheme::tcp;
+    /// @brief Host of TCP transport
+    std::string host;
+    /// @brief Port of TCP transport
+    std::uint16_t port = communication::Port;
+    /// @brief Unix domain socket path of Unix socket and shared memory transports
+    std::string path;
+
+    /// @brief Parses address string; string without scheme is treated as TCP host
+    static std::tuple<RdmaControlAddress, error> Parse(const std::string & address);
+
+    /// @brief Formats address as string
+    std::string ToString() const;
+};
+
+///
+/// @brief
+/// Byte stream connecting control session with its peer. Session writes length-prefixed frames and reads them back
+/// from stream, so transport only moves bytes.
+///
+class RdmaTransport
+{
+public:
+    /// [Setup]
+
+    /// @brief Completes transport setup with peer; stream sockets are ready once they are connected
+    virtual asio::awaitable<error> Open();
+
+    /// [Data Transfer]
+
+    /// @brief Reads some bytes; waits until at least one byte is available
+    virtual asio::awaitable<std::tuple<std::size_t, asio::error_code>> ReadSome(std::span<std::uint8_t> buffer) = 0;
+
+    /// @brief Writes all bytes of buffer sequence
+    virtual asio::awaitable<asio::error_code> Write(std::span<const asio::const_buffer> buffers) = 0;
+
+    /// [State]
+
+    /// @brief Checks if transport is open
+    virtual bool IsOpen() const = 0;
+
+    /// @brief Closes transport; pending reads of peer fail
+    virtual void Close() = 0;
+
+    /// [Construction & Destruction]
+
+#pragma region RdmaTransport::Construct
+
+    /// @brief Copy constructor is deleted
+    RdmaTransport(const RdmaTransport &) = delete;
+
+    /// @brief Copy operator is deleted
+    RdmaTransport & operator=(const RdmaTransport &) = delete;
+
+    /// @brief Default constructor
+    RdmaTransport() = default;
+
+    /// @brief Destructor
+    virtual ~RdmaTransport() = default;
+
+#pragma endregion
+};
+
+///
+/// @brief
+/// Control transport over stream socket: TCP socket or Unix domain socket.
+///
+template <typename Socket>
+class RdmaStreamTransport : public RdmaTransport
+{
+public:
+    /// [Data Transfer]
+
+    /// @brief Reads some bytes from socket
+    asio::awaitable<std::tuple<std::size_t, asio::error_code>> ReadSome(std::span<std::uint8_t> buffer) override;
+
+    /// @brief Writes buffer sequence to socket by vectored write
+    asio::awaitable<asio::error_code> Write(std::span<const asio::const_buffer> buffers) override;
+
+    /// [State]
+
+    /// @brief Checks if socket is open
+    bool IsOpen() const override;
+
+    /// @brief Shuts down and closes socket
+    void Close() override;
+
+    /// [Construction & Destruction]
+
+#pragma region RdmaStreamTransport::Construct
+
+    /// @brief Constructor
+    explicit RdmaStreamTransport(Socket socket);
+
+    /// @brief Destructor
+    ~RdmaStreamTransport() override;
+
+#pragma endregion
+
+private:
+    /// [Properties]
+
+    /// @brief Connected socket
+    Socket socket;
+};
+
+using RdmaTcpTransport = RdmaStreamTransport<asio::ip::tcp::socket>;
+using RdmaUnixTransport = RdmaStreamTransport<asio::local::stream_protocol::socket>;
+
+///
+/// @brief
+/// Control transport over two single-producer single-consumer byte rings in shared memory, one per direction. Client
+/// creates shared memory segment and passes its name over Unix domain socket; server maps it and the name is unlinked.
+/// Bytes are copied into ring without system calls. Reader that finds ring empty marks itself waiting and sleeps on
+/// Unix domain socket, and writer wakes it by writing one byte there, so system calls are made only when reader is
+/// idle. Socket also reports peer exit.
+///
+class RdmaSharedMemoryTransport : public RdmaTransport
+{
+public:
+    /// [Nested Types]
+
+    /// @brief Side of transport; client creates shared memory segment
+    enum class Role {
+        client,
+        server,
+    };
+
+    /// [Setup]
+
+    /// @brief Creates shared memory segment and passes it to server (client) or maps segment created by client
+    /// (server)
+    asio::awaitable<error> Open() override;
+
+    /// [Data Transfer]
+
+    /// @brief Reads bytes from incoming ring; sleeps on socket while ring is empty
+    asio::awaitable<std::tuple<std::size_t, asio::error_code>> ReadSome(std::span<std::uint8_t> buffer) override;
+
+    /// @brief Writes bytes into outgoing ring and wakes peer if it sleeps; waits while ring is full
+    asio::awaitable<asio::error_code> Write(std::span<const asio::const_buffer> buffers) override;
+
+    /// [State]
+
+    /// @brief Checks if transport is open
+    bool IsOpen() const override;
+
+    /// @brief Closes socket, so that peer sees transport closed
+    void Close() override;
+
+    /// [Construction & Destruction]
+
+#pragma region RdmaSharedMemoryTransport::Construct
+
+    /// @brief Constructor
+    RdmaSharedMemoryTransport(asio::local::stream_protocol::socket socket, Role role);
+
+    /// @brief Destructor unmaps shared memory
+    ~RdmaSharedMemoryTransport() override;
+
+#pragma endregion
+
+private:
+    /// [Nested Types]
+
+    /// @brief Positions of one ring; they only grow, ring offset is position modulo capacity
+    struct SharedRing {
+        alignas(64) std::atomic<std::uint64_t> writePosition;
+        alignas(64) std::atomic<std::uint64_t> readPosition;
+        /// @brief Reader found ring empty and sleeps until woken by writer
+        alignas(64) std::atomic<std::uint32_t> readerWaiting;
+    };
+
+    /// @brief Header of shared memory segment; ring data follows it
+    struct SharedHeader {
+        std::uint64_t magic;
+        std::uint64_t ringCapacity;
+        /// @brief Ring from client to server and ring from server to client
+        SharedRing rings[2];
+    };
+
+    /// [Private Methods]
+
+    /// @brief Maps shared memory segment and points rings into it
+    error mapSegment(int fd, bool create);
+
+    /// @brief Copies bytes into outgoing ring; returns number of bytes that fit. Ring positions are changed by peer,
+    /// so positions out of ring bounds close transport with protocol error
+    std::tuple<std::size_t, asio::error_code> writeRing(std::span<const std::uint8_t> bytes);
+
+    /// @brief Copies bytes from incoming ring; returns number of bytes copied. Ring positions are changed by peer, so
+    /// positions out of ring bounds close transport with protocol error
+    std::tuple<std::size_t, asio::error_code> readRing(std::span<std::uint8_t> bytes);
+
+    /// [Properties]
+
+    /// @brief Socket passing segment name and waking peer
+    asio::local::stream_protocol::socket socket;
+
+    /// @brief Side of transport
+    Role role;
+
+    /// @brief Mapped shared memory segment
+    void * segment = nullptr;
+
+    /// @brief Size of mapped segment
+    std::size_t segmentSize = 0;
+
+    /// @brief Ring read by this side
+    SharedRing * incoming = nullptr;
+    std::uint8_t * incomingData = nullptr;
+
+    /// @brief Ring written by this side
+    SharedRing * outgoing = nullptr;
+    std::uint8_t * outgoingData = nullptr;
+
+    /// @brief Wake-up bytes read from socket; their value does not matter
+    std::array<std::uint8_t, 64> wakeUpBytes{};
+};
+
+///
+/// @brief
+/// Listener accepting control transports on server side according to control address scheme.
+///
+class RdmaTransportListener
+{
+public:
+    /// [Fabric Methods]
+
+    /// @brief Creates listener bound to control address; stale Unix domain socket file is replaced
+    static std::tuple<RdmaTransportListenerPtr, error> Create(asio::io_context & ioContext,
+                                                             const RdmaControlAddress & address);
+
+    /// [Accepting]
+
+    /// @brief Accepts next transport; transport must be opened before use
+    asio::awaitable<std::tuple<RdmaTransportPtr, error>> Accept();
+
+    /// @brief Stops accepting; pending accept fails
+    void Close();
+
+    /// [Construction & Destruction]
+
+#pragma region RdmaTransportListener::Construct
+
+    /// @brief Copy constructor is deleted
+    RdmaTransportListener(const RdmaTransportListener &) = delete;
+
+    /// @brief Copy operator is deleted
+    RdmaTransportListener & operator=(const RdmaTransportListener &) = delete;
+
+    /// @brief Constructor
+    /// @warning Avoid using this constructor since class has static fabric methods
+    explicit RdmaTransportListener(const RdmaControlAddress & address);
+
+    /// @brief Destructor removes Unix domain socket file
+    ~RdmaTransportListener();
+
+#pragma endregion
+
+private:
+    /// [Properties]
+
+    /// @brief Address listener is bound to
+    RdmaControlAddress address;
+
+    /// @brief Acceptor of TCP transport
+    std::unique_ptr<asio::ip::tcp::acceptor> tcpAcceptor = nullptr;
+
+    /// @brief Acceptor of Unix socket and shared memory transports
+    std::unique_ptr<asio::local::stream_protocol::acceptor> unixAcceptor = nullptr;
+};
+
+/// @brief Connects control transport to server at given address and opens it
+asio::awaitable<std::tuple<RdmaTransportPtr, error>> ConnectTransport(const RdmaControlAddress & address);
+
+template <typename Socket>
+RdmaStreamTransport<Socket>::RdmaStreamTransport(Socket socket) : socket(std::move(socket))
+{
+    // Keepalive detects dead TCP peer; Unix domain socket fails at once when peer exits
+    if constexpr (std::is_same_v<Socket, asio::ip::tcp::socket>) {
+        asio::error_code ec;
+        this->socket.set_option(asio::socket_base::keep_alive(true), ec);
+    }
+}
+
+template <typename Socket>
+RdmaStreamTransport<Socket>::~RdmaStreamTransport()
+{
+    this->Close();
+}
+
+template <typename Socket>
+asio::awaitable<std::tuple<std::size_t, asio::error_code>> RdmaStreamTransport<Socket>::ReadSome(
+    std::span<std::uint8_t> buffer)
+{
+    auto [err, bytesRead] = co_await this->socket.async_read_some(asio::buffer(buffer.data(), buffer.size()),
+                                                                  asio::as_tuple(asio::use_awaitable));
+    co_return std::make_tuple(bytesRead, err);
+}
+
+template <typename Socket>
+asio::awaitable<asio::error_code> RdmaStreamTransport<Socket>::Write(std::span<const asio::const_buffer> buffers)
+{
+    auto [err, _] = co_await asio::async_write(this->socket, buffers, asio::as_tuple(asio::use_awaitable));
+    co_return err;
+}
+
+template <typename Socket>
+bool RdmaStreamTransport<Socket>::IsOpen() const
+{
+    return this->socket.is_open();
+}
+
+template <typename Socket>
+void RdmaStreamTransport<Socket>::Close()
+{
+    if (this->socket.is_open()) {
+        asio::error_code ec;
+        this->socket.shutdown(Socket::shutdown_both, ec);
+        this->socket.close(ec);
+    }
+}
+
+}  // namespace doca::rdma
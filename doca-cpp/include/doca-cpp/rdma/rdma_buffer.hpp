@@ -2,32 +2,45 @@
 
 #include <atomic>
 #include <cstddef>
+#include <cstdint>
 #include <errors/errors.hpp>
+#include <format>
 #include <memory>
 #include <mutex>
+#include <random>
 #include <span>
 #include <tuple>
 #include <vector>
 
+#include "doca-cpp/core/mapped_file.hpp"
+#include "doca-cpp/core/memory_allocator.hpp"
 #include "doca-cpp/core/mmap.hpp"
+#include "doca-cpp/core/registration_cache.hpp"
 
 namespace doca::rdma
 {
 
 // Forward declarations
 class RdmaBuffer;
+class RdmaBufferArena;
 class RdmaRemoteBuffer;
 
 // Type aliases
 using RdmaBufferPtr = std::shared_ptr<RdmaBuffer>;
 using RdmaRemoteBufferPtr = std::shared_ptr<RdmaRemoteBuffer>;
 
+/// @brief Memory descriptor exported from memory map for remote access
+using RdmaMemoryDescriptor = std::vector<std::uint8_t>;
+using RdmaMemoryDescriptorPtr = std::shared_ptr<const RdmaMemoryDescriptor>;
+
 /// @brief Error types for RDMA buffer operations
 namespace ErrorTypes
 {
 inline const auto MemoryRangeNotRegistered = errors::New("Memory range not registered");
 inline const auto MemoryRangeAlreadyRegistered = errors::New("Memory range already registered");
 inline const auto MemoryRangeLocked = errors::New("Memory range is locked by RDMA engine");
+inline const auto MemoryRangeNotVectorBacked = errors::New("Memory range is not backed by std::vector");
+inline const auto MemoryRangeReadOnly = errors::New("Memory range is read-only");
 }  // namespace ErrorTypes
 
 ///
@@ -51,28 +64,83 @@ public:
     /// @brief Creates RDMA buffer from memory range
     static std::tuple<RdmaBufferPtr, error> FromMemoryRange(MemoryRangePtr memoryRange);
 
+    /// @brief Creates RDMA buffer backed by memory from given allocator
+    static std::tuple<RdmaBufferPtr, error> FromAllocator(doca::MemoryAllocatorPtr allocator, std::size_t size);
+
+    /// @brief Creates RDMA buffer over caller-owned memory without copying it. Buffer does not own memory; it holds
+    /// lifetime token until buffer is destroyed, so caller keeps memory valid while token is alive
+    static std::tuple<RdmaBufferPtr, error> FromExternalMemory(std::span<std::byte> memory,
+                                                               std::shared_ptr<void> lifetimeToken);
+
+    /// @brief Creates RDMA buffer over memory mapped file. Read-only files are mapped for RDMA reads only
+    static std::tuple<RdmaBufferPtr, error> FromMappedFile(doca::MappedFilePtr file);
+
     /// [Memory Registration]
 
     /// @brief Registers memory range for RDMA operations
     error RegisterMemoryRange(MemoryRangePtr memoryRange);
 
+    /// @brief Registers memory allocated by memory allocator for RDMA operations
+    error RegisterMemoryAllocation(doca::MemoryAllocationPtr allocation);
+
+    /// @brief Registers caller-owned memory for RDMA operations; lifetime token is held until buffer is destroyed
+    error RegisterExternalMemory(std::span<std::byte> memory, std::shared_ptr<void> lifetimeToken);
+
     /// @brief Maps memory to device with specified permissions
     error MapMemory(doca::DevicePtr device, doca::AccessFlags permissions);
 
+    /// @brief Maps memory through registration cache so buffers over already registered memory skip registration
+    error MapMemory(doca::MemoryRegistrationCachePtr registrationCache, doca::AccessFlags permissions);
+
+    /// @brief Notifies buffer that its memory was modified by RDMA operation; flushes file backed memory in batches
+    error NotifyMemoryModified();
+
     /// [Memory Access]
 
     /// @brief Gets memory map
     std::tuple<MemoryMapPtr, error> GetMemoryMap();
 
+    /// @brief Checks if memory is mapped to device
+    bool IsMapped() const;
+
     /// @brief Exports memory descriptor for remote access
     std::tuple<MemoryRangePtr, error> ExportMemoryDescriptor(doca::DevicePtr device);
 
+    /// @brief Gets memory descriptor for remote access. Descriptor is exported once after memory is mapped and then
+    /// shared by all callers without copying
+    std::tuple<RdmaMemoryDescriptorPtr, error> GetExportedDescriptor();
+
     /// @brief Gets registered memory range
+    /// @warning Works only for memory registered as std::vector; use GetMemorySpan for any registered memory
     std::tuple<MemoryRangePtr, error> GetMemoryRange();
 
+    /// @brief Gets registered memory regardless of how it was allocated
+    std::tuple<MemoryRangeHandle, error> GetMemorySpan();
+
+    /// @brief Gets allocation owning registered memory; null if memory is not registered
+    doca::MemoryAllocationPtr GetMemoryAllocation() const;
+
     /// @brief Gets size of registered memory range
     std::size_t MemoryRangeSize() const;
 
+    /// @brief Checks if registered memory can only be read
+    bool IsReadOnly() const;
+
+    /// @brief Gets mapped file backing buffer; null if buffer is not file backed
+    doca::MappedFilePtr GetMappedFile() const;
+
+    /// @brief Gets generation of exported memory descriptor. Generation changes every time memory is mapped, so peers
+    /// can reuse imported descriptor until generation changes. Zero means memory is not mapped
+    std::uint64_t DescriptorGeneration() const;
+
+    /// @brief Gets offset of buffer memory within memory region described by exported descriptor. Offset is non-zero
+    /// when buffer shares memory map with other buffers (e.g. buffers carved from arena)
+    std::size_t RegionOffset() const;
+
+    /// @brief Gets buffer covering arena memory region this buffer was carved from; null if buffer was not carved from
+    /// arena. Carved buffers are mapped by mapping their arena region
+    RdmaBufferPtr GetArenaRegion() const;
+
     /// [Construction & Destruction]
 
 #pragma region RdmaBuffer::Construct
@@ -83,11 +151,11 @@ public:
     /// @brief Copy operator is deleted
     RdmaBuffer & operator=(const RdmaBuffer &) = delete;
 
-    /// @brief Move constructor
-    RdmaBuffer(RdmaBuffer && other) noexcept = default;
+    /// @brief Move constructor is deleted
+    RdmaBuffer(RdmaBuffer && other) noexcept = delete;
 
-    /// @brief Move operator
-    RdmaBuffer & operator=(RdmaBuffer && other) noexcept = default;
+    /// @brief Move operator is deleted
+    RdmaBuffer & operator=(RdmaBuffer && other) noexcept = delete;
 
     /// @brief Default constructor
     RdmaBuffer() = default;
@@ -95,16 +163,44 @@ public:
 #pragma endregion
 
 private:
+    friend class RdmaBufferArena;
+
     /// [Properties]
 
-    /// @brief Registered memory range
+    /// @brief Registered memory range; null if memory was not registered as std::vector
     MemoryRangePtr memoryRange = nullptr;
 
+    /// @brief Registered memory; owns memory unless it was registered as std::vector or external memory
+    doca::MemoryAllocationPtr memoryAllocation = nullptr;
+
+    /// @brief Mapped file backing registered memory; null if buffer is not file backed
+    doca::MappedFilePtr mappedFile = nullptr;
+
     /// @brief Associated device
     doca::DevicePtr device = nullptr;
 
     /// @brief Memory map for RDMA operations
+    /// @note Declared after memory allocation so memory map is destroyed before memory is released
     MemoryMapPtr memoryMap = nullptr;
+
+    /// @brief Lease of registration cache entry when memory was mapped through registration cache
+    doca::MemoryRegistrationPtr memoryRegistration = nullptr;
+
+    /// @brief Buffer covering whole arena memory when buffer was carved from arena; it owns shared memory map
+    RdmaBufferPtr arenaRegion = nullptr;
+
+    /// @brief Memory region registered in memory map; may be wider than buffer memory
+    doca::MemoryRangeHandle mappedRegion;
+
+    /// @brief Generation of memory descriptor exported from memory map
+    std::uint64_t descriptorGeneration = 0;
+
+    /// @brief Memory descriptor exported from memory map
+    RdmaMemoryDescriptorPtr exportedDescriptor = nullptr;
+
+    /// @brief Guards memory map, registration lease, mapped region and exported descriptor; buffer of endpoint shared
+    /// by several clients is mapped from their threads at once
+    mutable std::mutex mappingMutex;
 };
 
 ///
@@ -126,8 +222,13 @@ public:
     /// [Fabric Methods]
 
     /// @brief Creates RDMA remote buffer from exported descriptor payload
-    static std::tuple<RdmaRemoteBufferPtr, error> FromExportedRemoteDescriptor(std::vector<uint8_t> & descPayload,
-                                                                               doca::DevicePtr device);
+    static std::tuple<RdmaRemoteBufferPtr, error> FromExportedRemoteDescriptor(
+        const std::vector<uint8_t> & descPayload, doca::DevicePtr device);
+
+    /// @brief Creates RDMA remote buffer addressing part of imported remote memory map; several buffers may share one
+    /// map when peer carves them from one registered region. Zero length addresses the rest of region after offset
+    static std::tuple<RdmaRemoteBufferPtr, error> FromRemoteMemoryMap(RemoteMemoryMapPtr remoteMemoryMap,
+                                                                      std::size_t offset, std::size_t length);
 
     /// [Memory Registration]
 
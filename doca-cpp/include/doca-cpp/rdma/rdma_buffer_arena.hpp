@@ -0,0 +1,122 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <errors/errors.hpp>
+#include <format>
+#include <memory>
+#include <mutex>
+#include <tuple>
+#include <vector>
+
+#include "doca-cpp/core/memory_allocator.hpp"
+#include "doca-cpp/core/mmap.hpp"
+#include "doca-cpp/rdma/rdma_buffer.hpp"
+
+namespace doca::rdma
+{
+
+// Forward declarations
+class RdmaBufferArena;
+
+// Type aliases
+using RdmaBufferArenaPtr = std::shared_ptr<RdmaBufferArena>;
+
+///
+/// @brief
+/// RDMA buffer arena carves many small RDMA buffers out of one memory region. Region is mapped once and exported
+/// with one descriptor shared by all carved buffers; peers address every buffer by its offset within region. Buffers
+/// are carved in size classes and their slots are reused after buffers are destroyed.
+///
+class RdmaBufferArena : public std::enable_shared_from_this<RdmaBufferArena>
+{
+public:
+    /// [Nested Types]
+
+    /// @brief Configuration of buffer arena
+    struct Config {
+        /// @brief Size of arena memory region in bytes
+        std::size_t capacity = 64ull * 1024 * 1024;
+        /// @brief Slot sizes in bytes buffers are rounded up to; must be multiples of slot alignment
+        std::vector<std::size_t> sizeClasses = { 1024, 4096, 16384, 65536 };
+        /// @brief Allocator of arena memory region; page aligned allocator is used if not set
+        doca::MemoryAllocatorPtr allocator = nullptr;
+    };
+
+    /// @brief Arena usage counters
+    struct Statistics {
+        std::size_t capacity = 0;
+        std::size_t carvedBytes = 0;
+        std::size_t buffersInUse = 0;
+        std::size_t freeSlots = 0;
+    };
+
+    /// [Fabric Methods]
+
+    /// @brief Creates arena and allocates its memory region
+    static std::tuple<RdmaBufferArenaPtr, error> Create(const Config & config);
+
+    /// [Allocation]
+
+    /// @brief Carves buffer of given size from arena; buffer gives its slot back to arena when destroyed
+    std::tuple<RdmaBufferPtr, error> Allocate(std::size_t size);
+
+    /// [Accessors]
+
+    /// @brief Gets buffer covering whole arena memory region
+    RdmaBufferPtr Region() const;
+
+    /// @brief Gets arena usage counters
+    Statistics GetStatistics() const;
+
+    /// [Construction & Destruction]
+
+#pragma region RdmaBufferArena::Construct
+
+    /// @brief Copy constructor is deleted
+    RdmaBufferArena(const RdmaBufferArena &) = delete;
+
+    /// @brief Copy operator is deleted
+    RdmaBufferArena & operator=(const RdmaBufferArena &) = delete;
+
+    /// @brief Move constructor is deleted
+    RdmaBufferArena(RdmaBufferArena && other) noexcept = delete;
+
+    /// @brief Move operator is deleted
+    RdmaBufferArena & operator=(RdmaBufferArena && other) noexcept = delete;
+
+    /// @brief Constructor
+    /// @warning Avoid using this constructor since class has static fabric methods
+    explicit RdmaBufferArena(std::vector<std::size_t> initialSizeClasses, RdmaBufferPtr initialRegion);
+
+#pragma endregion
+
+private:
+    /// [Private Methods]
+
+    /// @brief Gives slot back to free list of its size class
+    void releaseSlot(std::size_t sizeClassIndex, std::size_t offset);
+
+    /// [Properties]
+
+    /// @brief Slot sizes in ascending order
+    std::vector<std::size_t> sizeClasses;
+
+    /// @brief Buffer covering whole arena memory region; owns memory and shared memory map
+    RdmaBufferPtr region = nullptr;
+
+    /// @brief Offset of first byte that was never carved
+    std::size_t carvedBytes = 0;
+
+    /// @brief Offsets of free slots per size class
+    std::vector<std::vector<std::size_t>> freeSlots;
+
+    /// @brief Number of carved buffers alive
+    std::size_t buffersInUse = 0;
+
+    /// @brief Guards carving and free lists
+    mutable std::mutex arenaMutex;
+};
+
+}  // namespace doca::rdma
@@ -1,23 +1,41 @@
 #pragma once
 
+#include <algorithm>
 #include <asio.hpp>
 #include <asio/experimental/awaitable_operators.hpp>
+#include <cstddef>
 #include <errors/errors.hpp>
+#include <future>
 #include <map>
 #include <memory>
+#include <mutex>
+#include <optional>
+#include <set>
 #include <string>
+#include <thread>
 #include <tuple>
+#include <vector>
 
 #include "doca-cpp/core/device.hpp"
 #include "doca-cpp/rdma/internal/rdma_communication.hpp"
 #include "doca-cpp/rdma/internal/rdma_executor.hpp"
+#include "doca-cpp/rdma/internal/rdma_remote_buffer_cache.hpp"
 #include "doca-cpp/rdma/internal/rdma_session.hpp"
+#include "doca-cpp/rdma/internal/rdma_transport.hpp"
 #include "doca-cpp/rdma/rdma_buffer.hpp"
 #include "doca-cpp/rdma/rdma_endpoint.hpp"
 
 namespace doca::rdma
 {
 
+/// @brief Constants for RDMA client operations
+namespace constants
+{
+/// @brief Number of attempts to deliver request when control session turns out to be closed by server
+inline constexpr std::size_t RequestDeliveryAttempts = 2;
+
+}  // namespace constants
+
 // Forward declarations
 class RdmaClient;
 
@@ -28,6 +46,8 @@ using RdmaClientPtr = std::shared_ptr<RdmaClient>;
 /// @brief
 /// RDMA client for connecting to RDMA servers and requesting endpoint processing.
 /// Manages device, executor, and endpoint storage for client-side RDMA operations.
+/// Control session with server is opened once on connect and reused by all requests; it is reopened after failure.
+/// Session runs on client event loop thread, so requests made from any thread share it and run concurrently.
 ///
 class RdmaClient
 {
@@ -39,17 +59,45 @@ public:
 
     /// [Connection Management]
 
-    /// @brief Connects to RDMA server at specified address and port
+    /// @brief Connects to RDMA server at specified address and port and opens control session
     error Connect(const std::string & serverAddress, uint16_t serverPort);
 
+    /// @brief Sets control channel address: tcp://[host][:port], unix:///path or shm:///path; must be called before
+    /// Connect. By default control session goes over TCP to server address. Host of TCP address defaults to server
+    /// address
+    error SetControlAddress(const std::string & address);
+
     /// [Endpoint Management]
 
     /// @brief Registers endpoints for RDMA operations
     error RegisterEndpoints(std::vector<RdmaEndpointPtr> & endpoints);
 
+    /// @brief Sets how endpoints memory is mapped; must be called before Connect. All endpoints are mapped on Connect
+    /// by default
+    void SetEndpointMapping(const RdmaEndpointStorage::MappingConfig & config);
+
     /// @brief Requests processing of specified endpoint
     error RequestEndpointProcessing(const RdmaEndpointId & endpointId);
 
+    /// @brief Requests processing of specified endpoint without waiting for it. Requests of different endpoints run
+    /// concurrently over shared RDMA connection and control session; endpoint can not be in flight twice. Future
+    /// must be waited for before client is destroyed
+    std::future<error> RequestEndpointProcessingAsync(const RdmaEndpointId & endpointId);
+
+    /// @brief Requests processing of several different endpoints at once. Requests are outstanding in control session
+    /// together and executor keeps up to RdmaExecutor::Limits::maxInflightOperations of their RDMA operations in
+    /// flight at once; returns when all of them are processed. Endpoints sharing path compete for slots of that path
+    error RequestEndpointsProcessing(const std::vector<RdmaEndpointId> & endpointIds);
+
+    /// @brief Requests processing of several endpoints as one group: server locks all of them for one request,
+    /// their RDMA operations run together and one acknowledge completes the group. Group is rejected as a whole when
+    /// any endpoint is missing or locked; endpoints of group must have different paths
+    error RequestEndpointGroupProcessing(const std::vector<RdmaEndpointId> & endpointIds);
+
+    /// @brief Requests processing of endpoint group without waiting for it; none of its endpoints can be in flight
+    /// already. Future must be waited for before client is destroyed
+    std::future<error> RequestEndpointGroupProcessingAsync(const std::vector<RdmaEndpointId> & endpointIds);
+
     /// [Construction & Destruction]
 
 #pragma region RdmaClient::Construct
@@ -60,19 +108,64 @@ public:
     /// @brief Copy operator is deleted
     RdmaClient & operator=(const RdmaClient &) = delete;
 
-    /// @brief Move constructor
-    RdmaClient(RdmaClient && other) noexcept = default;
+    /// @brief Move constructor is deleted
+    RdmaClient(RdmaClient && other) noexcept = delete;
 
-    /// @brief Move operator
-    RdmaClient & operator=(RdmaClient && other) noexcept = default;
+    /// @brief Move operator is deleted
+    RdmaClient & operator=(RdmaClient && other) noexcept = delete;
 
     /// @brief Constructor
     /// @warning Avoid using this constructor since class has static fabric methods
     explicit RdmaClient(doca::DevicePtr initialDevice);
 
+    /// @brief Destructor
+    ~RdmaClient();
+
 #pragma endregion
 
 private:
+    /// [Private Methods]
+
+    /// @brief Opens control session with server and fetches its endpoint catalog; previous session is closed
+    asio::awaitable<error> openSession();
+
+    /// @brief Gets open control session; request that finds it closed reopens it while other requests wait
+    asio::awaitable<std::tuple<RdmaSessionClientPtr, error>> acquireSession();
+
+    /// @brief Processes endpoint over control session; request not delivered over reused session is sent again
+    asio::awaitable<error> processEndpoint(RdmaEndpointPtr endpoint);
+
+    /// @brief Marks endpoint in flight and spawns its processing on event loop
+    std::future<error> submitEndpoint(RdmaEndpointPtr endpoint);
+
+    /// @brief Processes endpoint group over control session; group not delivered over reused session is sent again
+    asio::awaitable<error> processGroup(std::vector<RdmaEndpointPtr> endpoints);
+
+    /// @brief Spawns coroutine on client event loop; future gets its result
+    std::future<error> spawnOnEventLoop(asio::awaitable<error> task);
+
+    /// @brief Runs coroutine on client event loop and waits until it completes
+    error runOnEventLoop(asio::awaitable<error> task);
+
+    /// @brief Runs coroutines concurrently on client event loop and waits until all of them complete; errors are
+    /// joined
+    error runOnEventLoop(std::vector<asio::awaitable<error>> tasks);
+
+    /// @brief Creates event loop waiting for progress engine events and starts its thread
+    error startEventLoop();
+
+    /// @brief Stops event loop thread
+    void stopEventLoop();
+
+    /// @brief Body of event loop thread: runs event loop until it is stopped
+    void runEventLoop();
+
+    /// @brief Progresses executor whenever progress engine notifies about events; finishes when notifier is released
+    asio::awaitable<error> progressOnEvents(RdmaExecutorPtr rdmaExecutor, doca_notification_handle_t handle);
+
+    /// @brief Gets endpoint for request and makes sure its memory is mapped
+    std::tuple<RdmaEndpointPtr, error> prepareEndpoint(const RdmaEndpointId & endpointId);
+
     /// [Properties]
 
     /// @brief Storage of registered RDMA endpoints
@@ -81,11 +174,48 @@ private:
     /// @brief Associated device
     doca::DevicePtr device = nullptr;
 
+    /// @brief Configuration of endpoints memory mapping
+    RdmaEndpointStorage::MappingConfig mappingConfig;
+
     /// @brief RDMA executor for operation management
     RdmaExecutorPtr executor = nullptr;
 
     /// @brief Server address for connection
     std::string serverAddress;
+
+    /// @brief Address of control channel if set explicitly
+    std::optional<RdmaControlAddress> controlAddress;
+
+    /// @brief Remote buffers imported from server descriptors
+    RdmaRemoteBufferCachePtr remoteBufferCache = nullptr;
+
+    /// @brief Asio event loop of control session; kept between requests
+    std::unique_ptr<asio::io_context> ioContext = nullptr;
+
+    /// @brief Keeps event loop from running out of work between requests
+    std::optional<asio::executor_work_guard<asio::io_context::executor_type>> workGuard;
+
+    /// @brief Progress engine notification handle waited for by event loop; handle is owned by progress engine
+    std::optional<asio::posix::stream_descriptor> progressNotifier;
+
+    /// @brief Thread running event loop
+    std::thread eventLoopThread;
+
+    /// @brief Endpoints with request in flight
+    std::set<RdmaEndpointId> inflightEndpoints;
+
+    /// @brief Guards endpoints in flight
+    std::mutex inflightMutex;
+
+    /// @brief Control session is being reopened; touched only on event loop thread
+    bool sessionOpening = false;
+
+    /// @brief Cancelled when control session is reopened, waking requests waiting for it
+    std::unique_ptr<asio::steady_timer> sessionOpenedTimer = nullptr;
+
+    /// @brief Control session with server
+    /// @note Declared after event loop so session transport is destroyed first
+    RdmaSessionClientPtr session = nullptr;
 };
 
 }  // namespace doca::rdma
@@ -1,13 +1,24 @@
 #pragma once
 
+#include <algorithm>
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
 #include <errors/errors.hpp>
+#include <format>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <optional>
+#include <shared_mutex>
 #include <string>
+#include <thread>
 #include <tuple>
+#include <utility>
+#include <vector>
 
+#include "doca-cpp/core/memory_allocator.hpp"
 #include "doca-cpp/core/mmap.hpp"
 #include "doca-cpp/rdma/rdma_buffer.hpp"
 #include "doca-cpp/rdma/rdma_service_interface.hpp"
@@ -70,6 +81,11 @@ public:
         RdmaEndpointPath path = "";
         RdmaEndpointType type = RdmaEndpointType::write;
         RdmaEndpointBufferPtr buffer = nullptr;
+        /// @brief Buffer slots; first slot is endpoint buffer. Requests over endpoint path are served by different
+        /// slots concurrently
+        std::vector<RdmaEndpointBufferPtr> slotBuffers;
+        /// @brief Endpoints with higher priority are mapped first when memory is mapped in background
+        int mappingPriority = 0;
     };
 
     /// [Fabric Methods]
@@ -85,9 +101,18 @@ public:
     /// @brief Gets endpoint type
     RdmaEndpointType Type() const;
 
-    /// @brief Gets endpoint buffer
+    /// @brief Gets endpoint buffer; for multi-slot endpoint it is buffer of first slot
     RdmaEndpointBufferPtr Buffer();
 
+    /// @brief Gets buffer of given slot; null if slot does not exist
+    RdmaEndpointBufferPtr SlotBuffer(std::size_t slotIndex);
+
+    /// @brief Gets number of buffer slots
+    std::size_t SlotCount() const;
+
+    /// @brief Gets priority of background memory mapping
+    int MappingPriority() const;
+
     /// [Service Management]
 
     /// @brief Registers service for endpoint processing
@@ -149,6 +174,13 @@ public:
         /// @brief Sets endpoint buffer
         Builder & SetBuffer(RdmaEndpointBufferPtr buffer);
 
+        /// @brief Sets buffer slots of endpoint. Server hands out free slot to every request, so clients write into
+        /// some slots while service processes others
+        Builder & SetSlotBuffers(std::vector<RdmaEndpointBufferPtr> buffers);
+
+        /// @brief Sets priority of background memory mapping; higher priority endpoints are mapped first
+        Builder & SetMappingPriority(int priority);
+
         /// [Construction & Destruction]
 
         /// @brief Copy constructor is deleted
@@ -209,14 +241,59 @@ class RdmaEndpointStorage
 public:
     /// [Nested Types]
 
-    /// @brief Stored endpoint wrapper with locking support
+    /// @brief Stored endpoint wrapper
     struct StoredEndpoint {
         RdmaEndpointPtr endpoint = nullptr;
-        std::atomic_bool endpointLocked = false;
-        std::mutex endpointMutex;
+        /// @brief Compact endpoint number; numbers start from one
+        std::uint32_t endpointNumber = 0;
     };
     using StoredEndpointPtr = std::shared_ptr<StoredEndpoint>;
 
+    /// @brief Policy of endpoints memory mapping
+    enum class MappingPolicy {
+        /// @brief All endpoints are mapped before serving starts
+        eager,
+        /// @brief Endpoint is mapped when it is requested first time
+        onDemand,
+        /// @brief Endpoints are mapped in background in priority order; requested endpoints are mapped first
+        prewarm,
+    };
+
+    /// @brief Configuration of endpoints memory mapping
+    struct MappingConfig {
+        /// @brief When endpoints memory is mapped
+        MappingPolicy policy = MappingPolicy::eager;
+        /// @brief Number of threads mapping endpoint buffers; zero uses number of hardware threads
+        std::size_t numThreads = 0;
+        /// @brief Fault in buffer pages before registration so that pinning does not fault them in one by one. Page
+        /// contents are not changed, so buffers may be used while they are mapped in background
+        bool prefault = true;
+    };
+
+    /// @brief Time spent mapping memory of one endpoint
+    struct EndpointMappingTime {
+        RdmaEndpointId endpointId;
+        /// @brief Buffer slot of endpoint; every slot of multi-slot endpoint has its own entry
+        std::size_t slotIndex = 0;
+        std::size_t bytes = 0;
+        std::chrono::microseconds prefaultTime{};
+        std::chrono::microseconds registrationTime{};
+        /// @brief Memory is mapped; endpoints mapped on demand or in background are not mapped until then
+        bool mapped = false;
+        /// @brief Memory is shared with endpoint mapped earlier (same buffer or same arena), so it was not mapped again
+        bool sharedMapping = false;
+    };
+
+    /// @brief Report of last endpoints memory mapping
+    struct MappingReport {
+        /// @brief Threads mapping endpoints; zero unless policy is eager, since other policies map in background
+        std::size_t numThreads = 0;
+        /// @brief Time of whole mapping; zero unless policy is eager
+        std::chrono::microseconds totalTime{};
+        /// @brief Entries of endpoints mapped in background are filled once their memory is mapped
+        std::vector<EndpointMappingTime> endpoints;
+    };
+
     /// [Fabric Methods]
 
     /// @brief Creates endpoint storage instance
@@ -238,19 +315,45 @@ public:
     /// @brief Gets endpoint by ID
     std::tuple<RdmaEndpointPtr, error> GetEndpoint(const RdmaEndpointId & endpointId);
 
+    /// @brief Gets IDs of all endpoints in order of their numbers
+    std::vector<RdmaEndpointId> ListEndpoints() const;
+
+    /// @brief Gets ID of endpoint by its number. Endpoints are numbered from one in order of registration, so peers
+    /// may address endpoint by compact number instead of path
+    std::tuple<RdmaEndpointId, error> GetEndpointIdByNumber(std::uint32_t endpointNumber) const;
+
     /// [Endpoint Locking]
 
-    /// @brief Tries to lock endpoint for exclusive access
-    std::tuple<bool, error> TryLockEndpointsByPath(const RdmaEndpointPath & endpointsPath);
+    /// @brief Tries to lock free buffer slot of endpoints with given path for exclusive access. Endpoints sharing path
+    /// share slots. Returns no slot if all slots are locked
+    std::tuple<std::optional<std::size_t>, error> TryLockEndpointSlot(const RdmaEndpointPath & endpointsPath);
 
-    /// @brief Unlocks previously locked endpoint
-    error UnlockEndpointsByPath(const RdmaEndpointPath & endpointsPath);
+    /// @brief Unlocks previously locked buffer slot of endpoints with given path
+    error UnlockEndpointSlot(const RdmaEndpointPath & endpointsPath, std::size_t slotIndex);
 
     /// [Memory Management]
 
-    /// @brief Maps all endpoints memory to device
+    /// @brief Maps all endpoints memory to device with default mapping configuration
     error MapEndpointsMemory(doca::DevicePtr device);
 
+    /// @brief Maps all endpoints memory to device according to mapping policy. Eagerly mapped memory regions are
+    /// prefaulted, registered and exported in parallel; other policies start background mapping thread and return
+    /// immediately. Endpoints sharing memory are mapped once
+    error MapEndpointsMemory(doca::DevicePtr device, const MappingConfig & config);
+
+    /// @brief Maps endpoint memory if it is not mapped yet and waits for it; waits only for endpoint's own memory
+    error EnsureEndpointMapped(const RdmaEndpointId & endpointId);
+
+    /// @brief Checks if memory of every endpoint slot is mapped and its descriptor is exported
+    bool IsEndpointMapped(const RdmaEndpointId & endpointId) const;
+
+    /// @brief Checks if endpoint memory is mapped; if not, schedules it to be mapped in background ahead of prewarming.
+    /// Returns error of failed mapping once, so that next request schedules mapping again
+    std::tuple<bool, error> RequestEndpointMapping(const RdmaEndpointId & endpointId);
+
+    /// @brief Gets report of last endpoints memory mapping
+    MappingReport GetMappingReport() const;
+
     /// [Construction & Destruction]
 
 #pragma region RdmaEndpointStorage::Construct
@@ -276,10 +379,102 @@ public:
 #pragma endregion
 
 private:
+    /// [Nested Types]
+
+    /// @brief Buffer slot locks of endpoints sharing one path
+    struct PathSlots {
+        std::vector<bool> slotLocked;
+        /// @brief Slot to try first; slots are handed out in turn so that every slot gets reused
+        std::size_t nextSlot = 0;
+    };
+
+    /// @brief Memory region mapped at once; shared by endpoints using the same buffer or buffers of the same arena
+    struct RegionMapping {
+        /// @brief Buffer owning memory map of region
+        RdmaBufferPtr buffer = nullptr;
+        /// @brief Endpoint buffers carved from region; they take memory map of region once it is mapped
+        std::vector<RdmaBufferPtr> carvedBuffers;
+        /// @brief Indices of region endpoints in mapping report
+        std::vector<std::size_t> reportIndices;
+        /// @brief Highest mapping priority of region endpoints
+        int priority = 0;
+        /// @brief Region is mapped
+        std::atomic_bool mapped = false;
+        /// @brief Region is queued for background mapping; guarded by queue mutex
+        bool scheduled = false;
+        /// @brief Error of last failed mapping; guarded by queue mutex
+        error mappingErr = nullptr;
+        /// @brief Serializes mapping of region
+        std::mutex mappingMutex;
+    };
+    using RegionMappingPtr = std::shared_ptr<RegionMapping>;
+
+    /// [Private Methods]
+
+    /// @brief Groups endpoints into memory regions and prepares mapping report
+    void planRegions();
+
+    /// @brief Prefaults, registers and exports memory region unless it is already mapped
+    error mapRegion(const RegionMappingPtr & region, std::size_t prefaultThreads);
+
+    /// @brief Maps requested regions and then prewarms remaining ones until stop is requested
+    void runMappingThread(std::stop_token stopToken);
+
+    /// @brief Copies memory regions of endpoint; returns false if memory mapping of endpoint was not planned
+    std::tuple<std::vector<RegionMappingPtr>, bool> findEndpointRegions(const RdmaEndpointId & endpointId) const;
+
+    /// @brief Gets number of threads mapping memory according to mapping configuration
+    std::size_t mappingThreads() const;
+
     /// [Properties]
 
     /// @brief Map of endpoint IDs to stored endpoints
     std::map<RdmaEndpointId, StoredEndpointPtr> endpointsMap;
+
+    /// @brief Endpoint IDs in order of registration; endpoint number is index plus one
+    std::vector<RdmaEndpointId> endpointIdsByNumber;
+
+    /// @brief Guards endpoints, their numbers and memory regions; control threads look them up concurrently
+    mutable std::shared_mutex endpointsMutex;
+
+    /// @brief Buffer slot locks by endpoint path
+    std::map<RdmaEndpointPath, PathSlots> slotsByPath;
+
+    /// @brief Guards buffer slot locks
+    std::mutex slotsMutex;
+
+    /// @brief Device endpoints memory is mapped to
+    doca::DevicePtr mappingDevice = nullptr;
+
+    /// @brief Configuration of endpoints memory mapping
+    MappingConfig mappingConfig;
+
+    /// @brief Memory regions ordered by mapping priority
+    std::vector<RegionMappingPtr> regions;
+
+    /// @brief Memory regions of every endpoint; endpoint slots may lie in different regions
+    std::map<RdmaEndpointId, std::vector<RegionMappingPtr>> regionsByEndpoint;
+
+    /// @brief Report of last endpoints memory mapping
+    MappingReport mappingReport;
+
+    /// @brief Guards mapping report
+    mutable std::mutex reportMutex;
+
+    /// @brief Regions requested before they were mapped; mapped ahead of prewarming
+    std::deque<RegionMappingPtr> mappingQueue;
+
+    /// @brief Index of next region to prewarm
+    std::size_t nextPrewarmRegion = 0;
+
+    /// @brief Guards mapping queue and region scheduling state
+    std::mutex queueMutex;
+
+    /// @brief Wakes mapping thread when region is requested
+    std::condition_variable_any queueCondVar;
+
+    /// @brief Background mapping thread; declared last so it is stopped before regions it maps are destroyed
+    std::jthread mappingThread;
 };
 
 }  // namespace doca::rdma
@@ -1,17 +1,30 @@
 #pragma once
 
+#include <pthread.h>
+#include <sched.h>
+
 #include <asio.hpp>
 #include <asio/experimental/awaitable_operators.hpp>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstring>
 #include <errors/errors.hpp>
 #include <map>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <string>
+#include <thread>
 #include <tuple>
+#include <vector>
 
 #include "doca-cpp/core/device.hpp"
 #include "doca-cpp/rdma/internal/rdma_communication.hpp"
 #include "doca-cpp/rdma/internal/rdma_executor.hpp"
+#include "doca-cpp/rdma/internal/rdma_service_executor.hpp"
 #include "doca-cpp/rdma/internal/rdma_session.hpp"
+#include "doca-cpp/rdma/internal/rdma_transport.hpp"
 #include "doca-cpp/rdma/rdma_buffer.hpp"
 #include "doca-cpp/rdma/rdma_endpoint.hpp"
 
@@ -100,6 +113,22 @@ public:
         Builder & SetDevice(doca::DevicePtr device);
         /// @brief Sets port to listen on
         Builder & SetListenPort(uint16_t port);
+        /// @brief Sets how endpoints memory is mapped; all endpoints are mapped before serving by default
+        Builder & SetEndpointMapping(const RdmaEndpointStorage::MappingConfig & config);
+        /// @brief Sets control channel address: tcp://[host][:port] (default), unix:///path or shm:///path. Unix
+        /// socket and shared memory transports serve clients on the same host without TCP stack
+        Builder & SetControlAddress(const std::string & address);
+        /// @brief Sets number of threads running control sessions; 0 uses all hardware threads. One thread by default.
+        /// Every session runs on its own strand, so sessions scale with threads and services of different endpoints
+        /// may run concurrently
+        Builder & SetControlThreads(std::size_t numThreads);
+        /// @brief Sets how endpoint services are run: thread pool or serial queue per endpoint, with bounded number of
+        /// queued handlers. One worker thread by default
+        Builder & SetServiceExecutor(const RdmaServiceExecutor::Config & config);
+        /// @brief Sets dedicated thread busy-polling progress engine, optionally pinned to CPU core. By default server
+        /// waits for progress engine events in control event loop and takes no CPU while idle; busy-polling trades
+        /// one core for lower latency
+        Builder & SetBusyPolling(bool enabled, std::optional<std::size_t> cpuCore = std::nullopt);
 
         /// [Construction & Destruction]
 
@@ -125,11 +154,38 @@ public:
         doca::DevicePtr device = nullptr;
         /// @brief Port to listen on
         uint16_t port = 0;
+        /// @brief Configuration of endpoints memory mapping
+        RdmaEndpointStorage::MappingConfig mappingConfig;
+        /// @brief Address of control channel
+        RdmaControlAddress controlAddress;
+        /// @brief Number of threads running control sessions
+        std::size_t controlThreads = 1;
+        /// @brief Configuration of service executor
+        RdmaServiceExecutor::Config serviceConfig;
+        /// @brief Busy-poll progress engine instead of waiting for its events
+        bool busyPolling = false;
+        /// @brief CPU core busy-polling thread is pinned to
+        std::optional<std::size_t> busyPollingCore = std::nullopt;
     };
 
 #pragma endregion
 
 private:
+    /// [Private Methods]
+
+    /// @brief Gets number of control threads according to configuration
+    std::size_t controlThreadsCount() const;
+
+    /// @brief Progresses engine whenever its notification handle becomes readable; runs in control event loop
+    asio::awaitable<error> progressOnEvents(asio::posix::stream_descriptor & notifier,
+                                            doca_notification_handle_t handle);
+
+    /// @brief Progresses engine in loop until serving stops; runs on dedicated thread
+    error progressBusyPolling(const std::atomic_bool & progressRunning);
+
+    /// @brief Stops serving and wakes Serve()
+    void requestStop();
+
     /// [Properties]
 
     /// [Endpoint Storage]
@@ -144,6 +200,30 @@ private:
     /// @brief Port to listen on
     uint16_t port = 0;
 
+    /// [Endpoint Mapping]
+
+    /// @brief Configuration of endpoints memory mapping
+    RdmaEndpointStorage::MappingConfig mappingConfig;
+
+    /// [Control Channel]
+
+    /// @brief Address clients connect control sessions to
+    RdmaControlAddress controlAddress;
+    /// @brief Number of threads running control sessions; 0 means all hardware threads
+    std::size_t controlThreads = 1;
+
+    /// [Services]
+
+    /// @brief Configuration of executor running endpoint services
+    RdmaServiceExecutor::Config serviceConfig;
+
+    /// [Progress]
+
+    /// @brief Busy-poll progress engine on dedicated thread instead of waiting for its events
+    bool busyPolling = false;
+    /// @brief CPU core busy-polling thread is pinned to; not pinned if empty
+    std::optional<std::size_t> busyPollingCore = std::nullopt;
+
     /// [Components]
 
     /// @brief Executor to process RDMA operations
@@ -161,6 +241,10 @@ private:
     std::condition_variable shutdownCondVar;
     /// @brief Signal to exit server loop immediately
     std::atomic_bool shutdownForced = false;
+    /// @brief Guards serving stop and session errors Serve() waits for
+    std::mutex serveStopMutex;
+    /// @brief Wakes Serve() when serving stops or session fails
+    std::condition_variable serveStopCondVar;
 };
 
 }  // namespace doca::rdma
@@ -1,7 +1,9 @@
 #pragma once
 
+#include <asio.hpp>
 #include <errors/errors.hpp>
 #include <memory>
+#include <span>
 
 #include "doca-cpp/rdma/rdma_buffer.hpp"
 
@@ -10,9 +12,11 @@ namespace doca::rdma
 
 // Forward declarations
 class IRdmaService;
+class IRdmaAsyncService;
 
 // Type aliases
 using RdmaServiceInterfacePtr = std::shared_ptr<IRdmaService>;
+using RdmaAsyncServiceInterfacePtr = std::shared_ptr<IRdmaAsyncService>;
 
 ///
 /// @brief
@@ -27,6 +31,20 @@ public:
     /// @brief Handles RDMA buffer processing
     virtual error Handle(RdmaBufferPtr buffer) = 0;
 
+    /// @brief Handles several buffers of endpoint filled close together. Server gathers them when service executor
+    /// batches handlers; override to process buffers in one pass. Default implementation calls Handle for each buffer
+    virtual error HandleBatch(std::span<RdmaBufferPtr> buffers)
+    {
+        error batchErr = nullptr;
+        for (auto & buffer : buffers) {
+            auto err = this->Handle(buffer);
+            if (err) {
+                batchErr = batchErr ? errors::Join(batchErr, err) : err;
+            }
+        }
+        return batchErr;
+    }
+
     /// [Construction & Destruction]
 
 #pragma region IRdmaService::Construct
@@ -52,4 +70,25 @@ public:
 #pragma endregion
 };
 
+///
+/// @brief
+/// Abstract interface for RDMA service handlers that forward buffer data asynchronously, e.g. to disk, another RDMA
+/// peer or compute queue. Session co_awaits handler on its control thread instead of blocking worker thread, so many
+/// requests may be in service at once. Handler must not block; it suspends on asynchronous operations instead.
+///
+class IRdmaAsyncService : public IRdmaService
+{
+public:
+    /// [Handler]
+
+    /// @brief Handles RDMA buffer processing asynchronously
+    virtual asio::awaitable<error> HandleAsync(RdmaBufferPtr buffer) = 0;
+
+    /// @brief Synchronous handler is not used; library calls HandleAsync
+    error Handle(RdmaBufferPtr buffer) final
+    {
+        return errors::New("Asynchronous RDMA service must be called by HandleAsync");
+    }
+};
+
 }  // namespace doca::rdma
@@ -0,0 +1,163 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <errors/errors.hpp>
+#include <format>
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "doca-cpp/core/device.hpp"
+#include "doca-cpp/core/types.hpp"
+#include "doca-cpp/rdma/internal/rdma_hash_ring.hpp"
+#include "doca-cpp/rdma/rdma_client.hpp"
+#include "doca-cpp/rdma/rdma_endpoint.hpp"
+
+namespace doca::rdma
+{
+
+// Forward declarations
+class RdmaShardedClient;
+
+// Type aliases
+using RdmaShardedClientPtr = std::shared_ptr<RdmaShardedClient>;
+
+///
+/// @brief
+/// RDMA client spreading endpoints over set of servers. Endpoint paths are mapped to servers by consistent hash ring,
+/// so endpoints sharing path go to the same server and membership change moves only paths of ring arcs that changed
+/// owner. Every server has its own RdmaClient with its own RDMA connection, executor and control session. Requests
+/// in flight finish on server they were routed to; server removed meanwhile is disconnected once they complete.
+///
+class RdmaShardedClient
+{
+public:
+    /// [Fabric Methods]
+
+    /// @brief Creates sharded RDMA client associated with given device
+    static std::tuple<RdmaShardedClientPtr, error> Create(doca::DevicePtr device);
+
+    /// [Endpoint Management]
+
+    /// @brief Registers endpoints for RDMA operations; must be called before servers are added
+    error RegisterEndpoints(std::vector<RdmaEndpointPtr> & endpoints);
+
+    /// @brief Sets how endpoints memory is mapped; must be called before servers are added. Memory is mapped once
+    /// and shared by clients of all servers
+    void SetEndpointMapping(const RdmaEndpointStorage::MappingConfig & config);
+
+    /// [Membership]
+
+    /// @brief Connects to server at specified address and port and adds it to hash ring; endpoint paths are
+    /// rebalanced
+    error AddServer(const std::string & serverAddress, uint16_t serverPort);
+
+    /// @brief Removes server from hash ring; endpoint paths are rebalanced to remaining servers
+    error RemoveServer(const std::string & serverAddress, uint16_t serverPort);
+
+    /// @brief Lists servers as address:port
+    std::vector<std::string> ListServers() const;
+
+    /// @brief Gets server endpoint is routed to, as address:port
+    std::tuple<std::string, error> GetEndpointServer(const RdmaEndpointId & endpointId) const;
+
+    /// [Requests]
+
+    /// @brief Requests processing of endpoint by server it is routed to
+    error RequestEndpointProcessing(const RdmaEndpointId & endpointId);
+
+    /// @brief Requests processing of several different endpoints at once; endpoints of different servers are
+    /// processed in parallel
+    error RequestEndpointsProcessing(const std::vector<RdmaEndpointId> & endpointIds);
+
+    /// @brief Requests processing of endpoints as groups: endpoints routed to one server make one group request of
+    /// that server. Groups of different servers are processed in parallel and are not atomic with each other
+    error RequestEndpointGroupProcessing(const std::vector<RdmaEndpointId> & endpointIds);
+
+    /// [Construction & Destruction]
+
+#pragma region RdmaShardedClient::Construct
+
+    /// @brief Copy constructor is deleted
+    RdmaShardedClient(const RdmaShardedClient &) = delete;
+
+    /// @brief Copy operator is deleted
+    RdmaShardedClient & operator=(const RdmaShardedClient &) = delete;
+
+    /// @brief Constructor
+    /// @warning Avoid using this constructor since class has static fabric methods
+    explicit RdmaShardedClient(doca::DevicePtr initialDevice);
+
+    /// @brief Destructor
+    ~RdmaShardedClient() = default;
+
+#pragma endregion
+
+private:
+    /// [Nested Types]
+
+    /// @brief Endpoints of request routed to one server
+    struct Shard {
+        /// @brief Client of server; keeps removed server connected until request completes
+        RdmaClientPtr client = nullptr;
+        std::vector<RdmaEndpointId> endpointIds;
+    };
+
+    /// [Private Methods]
+
+    /// @brief Splits endpoints of request between servers they are routed to
+    std::tuple<std::map<std::string, Shard>, error> routeEndpoints(const std::vector<RdmaEndpointId> & endpointIds);
+
+    /// @brief Assigns every registered endpoint path to server by hash ring; called with membership mutex locked
+    void rebalance();
+
+    /// @brief Marks endpoints in flight; endpoint can not be in flight on two servers after rebalance
+    error markInflight(const std::vector<RdmaEndpointId> & endpointIds);
+
+    /// @brief Clears in flight mark of endpoints
+    void clearInflight(const std::vector<RdmaEndpointId> & endpointIds);
+
+    /// @brief Marks endpoints in flight, routes them and runs request of every server in parallel; errors are joined
+    error processSharded(const std::vector<RdmaEndpointId> & endpointIds, bool asGroups);
+
+    /// [Properties]
+
+    /// @brief Associated device
+    doca::DevicePtr device = nullptr;
+
+    /// @brief Configuration of endpoints memory mapping
+    RdmaEndpointStorage::MappingConfig mappingConfig;
+
+    /// @brief Registered endpoints, registered in client of every server
+    std::vector<RdmaEndpointPtr> endpoints;
+
+    /// @brief Paths of registered endpoints
+    std::map<RdmaEndpointId, RdmaEndpointPath> endpointPaths;
+
+    /// @brief Hash ring of servers
+    RdmaHashRingPtr hashRing = nullptr;
+
+    /// @brief Clients of servers on hash ring
+    std::map<std::string, RdmaClientPtr> clients;
+
+    /// @brief Server every registered endpoint path is routed to
+    std::map<RdmaEndpointPath, std::string> pathOwners;
+
+    /// @brief Guards endpoints, hash ring, clients and path owners
+    mutable std::mutex membershipMutex;
+
+    /// @brief Endpoints with request in flight
+    std::set<RdmaEndpointId> inflightEndpoints;
+
+    /// @brief Guards endpoints in flight
+    std::mutex inflightMutex;
+};
+
+}  // namespace doca::rdma
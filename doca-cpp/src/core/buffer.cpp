@@ -4,6 +4,8 @@ using doca::Buffer;
 using doca::BufferInventory;
 using doca::BufferInventoryPtr;
 using doca::BufferPtr;
+using doca::ElasticBufferInventory;
+using doca::ElasticBufferInventoryPtr;
 
 #pragma region Buffer
 
@@ -318,6 +320,32 @@ std::tuple<BufferPtr, error> BufferInventory::AllocBufferByData(RemoteMemoryMapP
     return { managedBuffer, nullptr };
 }
 
+std::tuple<std::uint32_t, error> BufferInventory::GetNumElements() const
+{
+    if (!this->inventory) {
+        return { 0, errors::New("Buffer inventory is null") };
+    }
+    std::uint32_t numElements = 0;
+    auto err = FromDocaError(doca_buf_inventory_get_num_elements(this->inventory, &numElements));
+    if (err) {
+        return { 0, errors::Wrap(err, "Failed to get number of elements in inventory") };
+    }
+    return { numElements, nullptr };
+}
+
+std::tuple<std::uint32_t, error> BufferInventory::GetNumFreeElements() const
+{
+    if (!this->inventory) {
+        return { 0, errors::New("Buffer inventory is null") };
+    }
+    std::uint32_t numFreeElements = 0;
+    auto err = FromDocaError(doca_buf_inventory_get_num_free_elements(this->inventory, &numFreeElements));
+    if (err) {
+        return { 0, errors::Wrap(err, "Failed to get number of free elements in inventory") };
+    }
+    return { numFreeElements, nullptr };
+}
+
 error BufferInventory::Stop()
 {
     if (!this->inventory) {
@@ -335,4 +363,160 @@ doca_buf_inventory * BufferInventory::GetNative()
     return this->inventory;
 }
 
-#pragma endregion
\ No newline at end of file
+#pragma endregion
+
+#pragma region ElasticBufferInventory
+
+std::tuple<ElasticBufferInventoryPtr, error> ElasticBufferInventory::Create(const Config & config)
+{
+    if (config.initialElements == 0) {
+        return { nullptr, errors::New("Initial number of inventory elements must be positive") };
+    }
+    if (config.maxElements < config.initialElements) {
+        return { nullptr, errors::New("Maximum number of inventory elements is less than initial one") };
+    }
+
+    auto elasticInventory = std::make_shared<ElasticBufferInventory>(config);
+
+    std::lock_guard<std::mutex> lock(elasticInventory->inventoryMutex);
+    auto err = elasticInventory->grow(config.initialElements);
+    if (err) {
+        return { nullptr, errors::Wrap(err, "Failed to create initial buffer inventory") };
+    }
+    return { elasticInventory, nullptr };
+}
+
+ElasticBufferInventory::ElasticBufferInventory(const Config & initialConfig) : config(initialConfig) {}
+
+std::tuple<BufferPtr, error> ElasticBufferInventory::AllocBufferByAddress(MemoryMapPtr mmap, void * address,
+                                                                          size_t length)
+{
+    return this->allocate([&](BufferInventoryPtr inventory) {
+        return inventory->AllocBufferByAddress(mmap, address, length);
+    });
+}
+
+std::tuple<BufferPtr, error> ElasticBufferInventory::AllocBufferByData(MemoryMapPtr mmap, void * data, size_t length)
+{
+    return this->allocate([&](BufferInventoryPtr inventory) {
+        return inventory->AllocBufferByData(mmap, data, length);
+    });
+}
+
+std::tuple<BufferPtr, error> ElasticBufferInventory::AllocBufferByAddress(RemoteMemoryMapPtr mmap, void * address,
+                                                                          size_t length)
+{
+    return this->allocate([&](BufferInventoryPtr inventory) {
+        return inventory->AllocBufferByAddress(mmap, address, length);
+    });
+}
+
+std::tuple<BufferPtr, error> ElasticBufferInventory::AllocBufferByData(RemoteMemoryMapPtr mmap, void * data,
+                                                                       size_t length)
+{
+    return this->allocate([&](BufferInventoryPtr inventory) {
+        return inventory->AllocBufferByData(mmap, data, length);
+    });
+}
+
+template <typename AllocFunction>
+std::tuple<BufferPtr, error> ElasticBufferInventory::allocate(AllocFunction allocFunction)
+{
+    std::lock_guard<std::mutex> lock(this->inventoryMutex);
+
+    auto updateHighWaterMark = [this]() {
+        this->highWaterMark = std::max(this->highWaterMark, this->countInUse());
+    };
+
+    // Take buffer from first inventory that has free elements
+    for (auto & inventory : this->inventories) {
+        auto [numFree, err] = inventory->GetNumFreeElements();
+        if (err || numFree == 0) {
+            continue;
+        }
+        auto [buffer, bufErr] = allocFunction(inventory);
+        if (bufErr) {
+            return { nullptr, bufErr };
+        }
+        updateHighWaterMark();
+        return { buffer, nullptr };
+    }
+
+    // All chained inventories are exhausted: append new one if limit allows
+    this->exhaustionCount++;
+    const auto growthElements = std::min(this->config.growthElements, this->config.maxElements - this->capacity);
+    if (growthElements == 0) {
+        this->failureCount++;
+        return { nullptr, errors::Wrap(ErrorTypes::BufferInventoryExhausted,
+                                       "Maximum number of buffer inventory elements is reached") };
+    }
+
+    auto err = this->grow(growthElements);
+    if (err) {
+        this->failureCount++;
+        return { nullptr, errors::Wrap(err, "Failed to grow buffer inventory") };
+    }
+
+    auto [buffer, bufErr] = allocFunction(this->inventories.back());
+    if (bufErr) {
+        return { nullptr, bufErr };
+    }
+    updateHighWaterMark();
+    return { buffer, nullptr };
+}
+
+error ElasticBufferInventory::grow(std::size_t numElements)
+{
+    auto [inventory, err] = BufferInventory::Create(numElements).Start();
+    if (err) {
+        return errors::Wrap(err, "Failed to create and start buffer inventory");
+    }
+    this->inventories.push_back(inventory);
+    this->capacity += numElements;
+    return nullptr;
+}
+
+std::size_t ElasticBufferInventory::countInUse() const
+{
+    std::size_t inUse = 0;
+    for (const auto & inventory : this->inventories) {
+        auto [numElements, err] = inventory->GetNumElements();
+        auto [numFree, freeErr] = inventory->GetNumFreeElements();
+        if (err || freeErr) {
+            continue;
+        }
+        inUse += numElements - numFree;
+    }
+    return inUse;
+}
+
+ElasticBufferInventory::Statistics ElasticBufferInventory::GetStatistics() const
+{
+    std::lock_guard<std::mutex> lock(this->inventoryMutex);
+    return Statistics{
+        .capacity = this->capacity,
+        .inUse = this->countInUse(),
+        .highWaterMark = this->highWaterMark,
+        .exhaustionCount = this->exhaustionCount,
+        .failureCount = this->failureCount,
+        .numInventories = this->inventories.size(),
+    };
+}
+
+error ElasticBufferInventory::Stop()
+{
+    std::lock_guard<std::mutex> lock(this->inventoryMutex);
+    error stopErr = nullptr;
+    for (auto & inventory : this->inventories) {
+        auto err = inventory->Stop();
+        if (err) {
+            stopErr = stopErr ? errors::Join(stopErr, err) : err;
+        }
+    }
+    if (stopErr) {
+        return errors::Wrap(stopErr, "Failed to stop chained buffer inventories");
+    }
+    return nullptr;
+}
+
+#pragma endregion
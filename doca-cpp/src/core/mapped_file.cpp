@@ -0,0 +1,136 @@
+#include "doca-cpp/core/mapped_file.hpp"
+
+using doca::MappedFile;
+using doca::MappedFilePtr;
+using doca::MemoryRangeHandle;
+
+namespace
+{
+
+/// @brief Formats errno as error message
+std::string errnoMessage()
+{
+    return std::string(std::strerror(errno));
+}
+
+}  // namespace
+
+std::tuple<MappedFilePtr, error> MappedFile::Open(const std::string & path, const Config & config)
+{
+    const auto writable = config.mode == Mode::readWrite;
+    if (!writable && config.size != 0) {
+        return { nullptr, errors::New("File size can be set only for writable mapping") };
+    }
+
+    const auto openFlags = writable ? (O_RDWR | O_CREAT | O_CLOEXEC) : (O_RDONLY | O_CLOEXEC);
+    const auto fd = open(path.c_str(), openFlags, 0644);
+    if (fd < 0) {
+        return { nullptr, errors::New(std::format("Failed to open file {}: {}", path, errnoMessage())) };
+    }
+    // Descriptor is closed on any failure below; on success it is owned by mapped file
+    auto fdOwned = false;
+    auto closeFd = defer::MakeDefer([fd, &fdOwned]() {
+        if (!fdOwned) {
+            close(fd);
+        }
+    });
+
+    if (config.size != 0 && ftruncate(fd, static_cast<off_t>(config.size)) != 0) {
+        return { nullptr, errors::New(std::format("Failed to resize file {}: {}", path, errnoMessage())) };
+    }
+
+    struct stat fileStat {};
+    if (fstat(fd, &fileStat) != 0) {
+        return { nullptr, errors::New(std::format("Failed to stat file {}: {}", path, errnoMessage())) };
+    }
+    const auto size = static_cast<std::size_t>(fileStat.st_size);
+    if (size == 0) {
+        return { nullptr, errors::New(std::format("File {} is empty", path)) };
+    }
+
+    const auto protection = writable ? (PROT_READ | PROT_WRITE) : PROT_READ;
+    const auto mapFlags = MAP_SHARED | (config.populate ? MAP_POPULATE : 0);
+    auto * data = mmap(nullptr, size, protection, mapFlags, fd, 0);
+    if (data == MAP_FAILED) {
+        return { nullptr, errors::New(std::format("Failed to map file {}: {}", path, errnoMessage())) };
+    }
+
+    auto memory = MemoryRangeHandle(static_cast<std::uint8_t *>(data), size);
+    auto file = std::make_shared<MappedFile>(path, config, fd, memory);
+    fdOwned = true;
+    return { file, nullptr };
+}
+
+MappedFile::MappedFile(const std::string & initialPath, const Config & initialConfig, int initialFd,
+                       MemoryRangeHandle initialMemory)
+    : path(initialPath), config(initialConfig), fd(initialFd), memory(initialMemory)
+{
+}
+
+MappedFile::~MappedFile()
+{
+    if (this->config.mode == Mode::readWrite) {
+        std::ignore = msync(static_cast<void *>(this->memory.data()), this->memory.size(), MS_SYNC);
+    }
+    if (!this->memory.empty()) {
+        std::ignore = munmap(static_cast<void *>(this->memory.data()), this->memory.size());
+    }
+    if (this->fd >= 0) {
+        close(this->fd);
+    }
+}
+
+MemoryRangeHandle MappedFile::Memory() const
+{
+    return this->memory;
+}
+
+std::size_t MappedFile::Size() const
+{
+    return this->memory.size();
+}
+
+const std::string & MappedFile::Path() const
+{
+    return this->path;
+}
+
+MappedFile::Mode MappedFile::AccessMode() const
+{
+    return this->config.mode;
+}
+
+error MappedFile::MarkModified()
+{
+    if (this->config.mode != Mode::readWrite) {
+        return errors::New("Read-only mapped file can not be modified");
+    }
+
+    std::lock_guard<std::mutex> lock(this->flushMutex);
+    this->pendingModifications++;
+    if (this->config.flushBatchSize == 0 || this->pendingModifications < this->config.flushBatchSize) {
+        return nullptr;
+    }
+
+    // Batch is full: schedule write-back without blocking caller
+    if (msync(static_cast<void *>(this->memory.data()), this->memory.size(), MS_ASYNC) != 0) {
+        return errors::New(std::format("Failed to flush file {}: {}", this->path, errnoMessage()));
+    }
+    this->pendingModifications = 0;
+    return nullptr;
+}
+
+error MappedFile::Flush(bool synchronous)
+{
+    if (this->config.mode != Mode::readWrite) {
+        return nullptr;  // Nothing to flush
+    }
+
+    std::lock_guard<std::mutex> lock(this->flushMutex);
+    const auto flags = synchronous ? MS_SYNC : MS_ASYNC;
+    if (msync(static_cast<void *>(this->memory.data()), this->memory.size(), flags) != 0) {
+        return errors::New(std::format("Failed to flush file {}: {}", this->path, errnoMessage()));
+    }
+    this->pendingModifications = 0;
+    return nullptr;
+}
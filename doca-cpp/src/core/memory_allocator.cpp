@@ -0,0 +1,329 @@
+#include "doca-cpp/core/memory_allocator.hpp"
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+using doca::AlignedMemoryAllocator;
+using doca::AlignedMemoryAllocatorPtr;
+using doca::HugePageMemoryAllocator;
+using doca::HugePageMemoryAllocatorPtr;
+using doca::MemoryAllocation;
+using doca::MemoryAllocationPtr;
+using doca::MemoryRangeHandle;
+using doca::VectorMemoryAllocator;
+using doca::VectorMemoryAllocatorPtr;
+
+namespace constants
+{
+/// @brief Regular page size used for first-touch of non-hugepage memory
+constexpr std::size_t regularPageSize = 4096;
+/// @brief 2 MB hugepage size
+constexpr std::size_t hugePageSize2MB = 2ull * 1024 * 1024;
+/// @brief 1 GB hugepage size
+constexpr std::size_t hugePageSize1GB = 1024ull * 1024 * 1024;
+/// @brief madvise advice populating page tables for reading (Linux 5.14+); kernel headers may predate it
+#ifdef MADV_POPULATE_READ
+constexpr int populateReadAdvice = MADV_POPULATE_READ;
+#else
+constexpr int populateReadAdvice = 22;
+#endif
+/// @brief madvise advice populating page tables for writing (Linux 5.14+); kernel headers may predate it
+#ifdef MADV_POPULATE_WRITE
+constexpr int populateWriteAdvice = MADV_POPULATE_WRITE;
+#else
+constexpr int populateWriteAdvice = 23;
+#endif
+}  // namespace constants
+
+namespace
+{
+
+/// @brief Rounds size up to multiple of given power of two
+std::size_t alignUp(std::size_t size, std::size_t alignment)
+{
+    return (size + alignment - 1) & ~(alignment - 1);
+}
+
+/// @brief Formats errno as error message
+std::string errnoMessage()
+{
+    return std::string(std::strerror(errno));
+}
+
+/// @brief Applies routine to first byte of every page of memory region; pages are split into contiguous slices
+/// between given number of threads
+template <typename PageRoutine>
+void forEachPageInParallel(MemoryRangeHandle memory, std::size_t pageSize, std::size_t numThreads,
+                           PageRoutine routine)
+{
+    if (memory.empty() || pageSize == 0) {
+        return;
+    }
+
+    const auto numPages = (memory.size() + pageSize - 1) / pageSize;
+    numThreads = std::max<std::size_t>(1, std::min(numThreads, numPages));
+    const auto pagesPerThread = (numPages + numThreads - 1) / numThreads;
+
+    auto touch = [memory, pageSize, numPages, pagesPerThread, routine](std::size_t threadIndex) {
+        const auto firstPage = threadIndex * pagesPerThread;
+        const auto lastPage = std::min(firstPage + pagesPerThread, numPages);
+        for (auto page = firstPage; page < lastPage; page++) {
+            routine(memory[page * pageSize]);
+        }
+    };
+
+    std::vector<std::jthread> threads;
+    threads.reserve(numThreads - 1);
+    for (std::size_t threadIndex = 1; threadIndex < numThreads; threadIndex++) {
+        threads.emplace_back(touch, threadIndex);
+    }
+    touch(0);
+}
+
+/// @brief Populates page tables of memory region with madvise from given number of threads without touching page
+/// contents. Returns false when kernel does not support advice or fails to populate any slice
+bool populateInParallel(MemoryRangeHandle memory, int advice, std::size_t numThreads)
+{
+    if (memory.empty()) {
+        return true;
+    }
+
+    // madvise takes page aligned range; partially covered pages belong to the same mapping as region itself
+    const auto pageSize = constants::regularPageSize;
+    const auto regionStart = reinterpret_cast<std::uintptr_t>(memory.data());
+    const auto start = regionStart & ~(pageSize - 1);
+    const auto numPages = (alignUp(regionStart + memory.size(), pageSize) - start) / pageSize;
+    numThreads = std::max<std::size_t>(1, std::min(numThreads, numPages));
+    const auto pagesPerThread = (numPages + numThreads - 1) / numThreads;
+
+    std::atomic<bool> populated = true;
+    auto populate = [&](std::size_t threadIndex) {
+        const auto firstPage = threadIndex * pagesPerThread;
+        const auto lastPage = std::min(firstPage + pagesPerThread, numPages);
+        if (firstPage >= lastPage) {
+            return;
+        }
+        auto * address = reinterpret_cast<void *>(start + firstPage * pageSize);
+        if (madvise(address, (lastPage - firstPage) * pageSize, advice) != 0) {
+            populated = false;
+        }
+    };
+
+    {
+        std::vector<std::jthread> threads;
+        threads.reserve(numThreads - 1);
+        for (std::size_t threadIndex = 1; threadIndex < numThreads; threadIndex++) {
+            threads.emplace_back(populate, threadIndex);
+        }
+        populate(0);
+    }
+    return populated.load();
+}
+
+}  // namespace
+
+#pragma region MemoryAllocation
+
+MemoryAllocationPtr MemoryAllocation::Create(MemoryRangeHandle memory, Releaser releaser)
+{
+    return std::make_shared<MemoryAllocation>(memory, std::move(releaser));
+}
+
+MemoryAllocation::MemoryAllocation(MemoryRangeHandle initialMemory, Releaser initialReleaser)
+    : memory(initialMemory), releaser(std::move(initialReleaser))
+{
+}
+
+MemoryAllocation::~MemoryAllocation()
+{
+    if (this->releaser) {
+        this->releaser(this->memory);
+    }
+}
+
+MemoryRangeHandle MemoryAllocation::Memory() const
+{
+    return this->memory;
+}
+
+std::size_t MemoryAllocation::Size() const
+{
+    return this->memory.size();
+}
+
+#pragma endregion
+
+#pragma region VectorMemoryAllocator
+
+VectorMemoryAllocatorPtr VectorMemoryAllocator::Create()
+{
+    return std::make_shared<VectorMemoryAllocator>();
+}
+
+std::tuple<MemoryAllocationPtr, error> VectorMemoryAllocator::Allocate(std::size_t size)
+{
+    if (size == 0) {
+        return { nullptr, errors::New("Allocation size must be positive") };
+    }
+
+    auto vector = std::make_shared<MemoryRange>(size);
+    auto memory = MemoryRangeHandle(vector->data(), vector->size());
+
+    // Vector is owned by releaser and freed with allocation
+    auto allocation = MemoryAllocation::Create(memory, [vector](MemoryRangeHandle) mutable { vector.reset(); });
+    return { allocation, nullptr };
+}
+
+std::string VectorMemoryAllocator::Description() const
+{
+    return "vector";
+}
+
+#pragma endregion
+
+#pragma region AlignedMemoryAllocator
+
+std::tuple<AlignedMemoryAllocatorPtr, error> AlignedMemoryAllocator::Create(const Config & config)
+{
+    if (!std::has_single_bit(config.alignment) || config.alignment < sizeof(void *)) {
+        return { nullptr, errors::New("Alignment must be power of two and not less than pointer size") };
+    }
+    return { std::make_shared<AlignedMemoryAllocator>(config), nullptr };
+}
+
+AlignedMemoryAllocator::AlignedMemoryAllocator(const Config & initialConfig) : config(initialConfig) {}
+
+std::tuple<MemoryAllocationPtr, error> AlignedMemoryAllocator::Allocate(std::size_t size)
+{
+    if (size == 0) {
+        return { nullptr, errors::New("Allocation size must be positive") };
+    }
+
+    const auto alignedSize = alignUp(size, this->config.alignment);
+    auto * data = static_cast<std::uint8_t *>(std::aligned_alloc(this->config.alignment, alignedSize));
+    if (data == nullptr) {
+        return { nullptr, errors::New(std::format("Failed to allocate {} bytes of aligned memory", alignedSize)) };
+    }
+
+    auto memory = MemoryRangeHandle(data, alignedSize);
+    if (this->config.firstTouchThreads > 0) {
+        doca::FirstTouchMemory(memory, constants::regularPageSize, this->config.firstTouchThreads);
+    }
+
+    auto allocation = MemoryAllocation::Create(memory, [](MemoryRangeHandle memory) { std::free(memory.data()); });
+    return { allocation, nullptr };
+}
+
+std::string AlignedMemoryAllocator::Description() const
+{
+    return std::format("aligned(alignment={}, first-touch threads={})", this->config.alignment,
+                       this->config.firstTouchThreads);
+}
+
+#pragma endregion
+
+#pragma region HugePageMemoryAllocator
+
+std::tuple<HugePageMemoryAllocatorPtr, error> HugePageMemoryAllocator::Create(const Config & config)
+{
+    return { std::make_shared<HugePageMemoryAllocator>(config), nullptr };
+}
+
+HugePageMemoryAllocator::HugePageMemoryAllocator(const Config & initialConfig) : config(initialConfig) {}
+
+std::size_t HugePageMemoryAllocator::PageSizeBytes() const
+{
+    switch (this->config.pageSize) {
+        case PageSize::size1GB:
+            return constants::hugePageSize1GB;
+        case PageSize::size2MB:
+        default:
+            return constants::hugePageSize2MB;
+    }
+}
+
+std::tuple<MemoryAllocationPtr, error> HugePageMemoryAllocator::Allocate(std::size_t size)
+{
+    if (size == 0) {
+        return { nullptr, errors::New("Allocation size must be positive") };
+    }
+
+    const auto pageSize = this->PageSizeBytes();
+    const auto alignedSize = alignUp(size, pageSize);
+
+    // Hugepage size is encoded as log2 of page size; MFD_HUGE_SHIFT equals MAP_HUGE_SHIFT
+    const auto hugePageFlag = std::countr_zero(pageSize) << MAP_HUGE_SHIFT;
+
+    void * data = MAP_FAILED;
+    switch (this->config.source) {
+        case Source::anonymous:
+            {
+                data = mmap(nullptr, alignedSize, PROT_READ | PROT_WRITE,
+                            MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB | hugePageFlag, -1, 0);
+                if (data == MAP_FAILED) {
+                    return { nullptr, errors::New("Failed to map anonymous hugepages: " + errnoMessage()) };
+                }
+                break;
+            }
+        case Source::memfd:
+            {
+                const auto fd = memfd_create("doca-cpp-hugepages", MFD_CLOEXEC | MFD_HUGETLB | hugePageFlag);
+                if (fd < 0) {
+                    return { nullptr, errors::New("Failed to create hugepage memfd: " + errnoMessage()) };
+                }
+                // Mapping keeps memfd alive, so descriptor is closed right after mapping
+                auto closeFd = defer::MakeDefer([fd]() { close(fd); });
+                if (ftruncate(fd, static_cast<off_t>(alignedSize)) != 0) {
+                    return { nullptr, errors::New("Failed to resize hugepage memfd: " + errnoMessage()) };
+                }
+                data = mmap(nullptr, alignedSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+                if (data == MAP_FAILED) {
+                    return { nullptr, errors::New("Failed to map hugepage memfd: " + errnoMessage()) };
+                }
+                break;
+            }
+        default:
+            return { nullptr, errors::New("Unknown hugepage source") };
+    }
+
+    auto memory = MemoryRangeHandle(static_cast<std::uint8_t *>(data), alignedSize);
+    if (this->config.firstTouchThreads > 0) {
+        doca::FirstTouchMemory(memory, pageSize, this->config.firstTouchThreads);
+    }
+
+    auto allocation = MemoryAllocation::Create(memory, [](MemoryRangeHandle memory) {
+        std::ignore = munmap(static_cast<void *>(memory.data()), memory.size());
+    });
+    return { allocation, nullptr };
+}
+
+std::string HugePageMemoryAllocator::Description() const
+{
+    const auto pageSizeName = this->config.pageSize == PageSize::size1GB ? "1GB" : "2MB";
+    const auto sourceName = this->config.source == Source::memfd ? "memfd" : "anonymous";
+    return std::format("hugepage(page={}, source={}, first-touch threads={})", pageSizeName, sourceName,
+                       this->config.firstTouchThreads);
+}
+
+#pragma endregion
+
+void doca::FirstTouchMemory(MemoryRangeHandle memory, std::size_t pageSize, std::size_t numThreads)
+{
+    forEachPageInParallel(memory, pageSize, numThreads, [](std::uint8_t & page) { page = 0; });
+}
+
+void doca::PrefaultMemory(MemoryRangeHandle memory, bool writable, std::size_t numThreads)
+{
+    // Kernel populates page tables without touching page contents, so application may write memory meanwhile
+    const auto advice = writable ? constants::populateWriteAdvice : constants::populateReadAdvice;
+    if (populateInParallel(memory, advice, numThreads)) {
+        return;
+    }
+
+    // Kernel cannot populate page tables: fault pages in by reading their first bytes. Pages are never written
+    // back, since write would race with application writes to the same memory
+    forEachPageInParallel(memory, constants::regularPageSize, numThreads, [](std::uint8_t & page) {
+        volatile std::uint8_t sink = page;
+        (void)sink;
+    });
+}
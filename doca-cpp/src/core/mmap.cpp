@@ -4,12 +4,48 @@ using doca::AccessFlags;
 using doca::DevicePtr;
 using doca::MemoryMap;
 using doca::MemoryMapPtr;
+using doca::MemoryMapStopCallback;
+using doca::MemoryMapStopCallbackId;
+using doca::MemoryMapStopNotifier;
 using doca::MemoryRange;
 using doca::MemoryRangePtr;
 using doca::RemoteMemoryMap;
 using doca::RemoteMemoryMapPtr;
 using doca::RemoteMemoryRangeHandle;
 
+#pragma region MemoryMapStopNotifier
+
+MemoryMapStopCallbackId MemoryMapStopNotifier::Add(MemoryMapStopCallback callback)
+{
+    std::lock_guard<std::mutex> lock(this->callbacksMutex);
+    const auto callbackId = this->nextCallbackId++;
+    this->callbacks.emplace(callbackId, std::move(callback));
+    return callbackId;
+}
+
+void MemoryMapStopNotifier::Remove(MemoryMapStopCallbackId callbackId)
+{
+    std::lock_guard<std::mutex> lock(this->callbacksMutex);
+    this->callbacks.erase(callbackId);
+}
+
+void MemoryMapStopNotifier::NotifyAll()
+{
+    // Take callbacks out of storage so they may safely call Remove() while being invoked
+    std::map<MemoryMapStopCallbackId, MemoryMapStopCallback> pendingCallbacks;
+    {
+        std::lock_guard<std::mutex> lock(this->callbacksMutex);
+        pendingCallbacks.swap(this->callbacks);
+    }
+    for (auto & [_, callback] : pendingCallbacks) {
+        if (callback) {
+            callback();
+        }
+    }
+}
+
+#pragma endregion
+
 #pragma region MemoryMap
 
 MemoryMap::Builder::Builder(doca_mmap * plainMmap) : mmap(plainMmap), buildErr(nullptr), device(nullptr) {}
@@ -62,6 +98,19 @@ MemoryMap::Builder & MemoryMap::Builder::SetMemoryRange(MemoryRangePtr memoryRan
     return *this;
 }
 
+MemoryMap::Builder & MemoryMap::Builder::SetMemoryRange(MemoryRangeHandle memoryRange)
+{
+    if (this->mmap && !this->buildErr) {
+        auto dataPtr = static_cast<void *>(memoryRange.data());
+        auto dataLength = memoryRange.size();
+        auto err = FromDocaError(doca_mmap_set_memrange(this->mmap, dataPtr, dataLength));
+        if (err) {
+            this->buildErr = errors::Wrap(err, "Failed to set memory range");
+        }
+    }
+    return *this;
+}
+
 MemoryMap::Builder & MemoryMap::Builder::SetDmaBufMemoryRange(MemoryRangeHandle memoryRange,
                                                               DmaBufDescriptor dmaBufDescriptor)
 {
@@ -148,6 +197,9 @@ void doca::MemoryMap::Deleter::Delete(doca_mmap * mmap)
 
 MemoryMap::~MemoryMap()
 {
+    if (this->stopNotifier) {
+        this->stopNotifier->NotifyAll();
+    }
     if (this->memoryMap && this->deleter) {
         this->deleter->Delete(this->memoryMap);
     }
@@ -158,6 +210,7 @@ error MemoryMap::Stop()
     if (!this->memoryMap) {
         return errors::New("Memory map is null");
     }
+    this->stopNotifier->NotifyAll();
     auto err = FromDocaError(doca_mmap_stop(this->memoryMap));
     if (err) {
         return errors::Wrap(err, "Failed to stop memory map");
@@ -249,6 +302,16 @@ std::tuple<std::span<uint8_t>, error> doca::MemoryMap::GetMemoryRange()
     return { memrangeSpan, nullptr };
 }
 
+MemoryMapStopCallbackId MemoryMap::AddStopCallback(MemoryMapStopCallback callback)
+{
+    return this->stopNotifier->Add(std::move(callback));
+}
+
+void MemoryMap::RemoveStopCallback(MemoryMapStopCallbackId callbackId)
+{
+    this->stopNotifier->Remove(callbackId);
+}
+
 doca_mmap * MemoryMap::GetNative() const
 {
     return this->memoryMap;
@@ -273,6 +336,9 @@ void doca::RemoteMemoryMap::Deleter::Delete(doca_mmap * mmap)
 
 RemoteMemoryMap::~RemoteMemoryMap()
 {
+    if (this->stopNotifier) {
+        this->stopNotifier->NotifyAll();
+    }
     if (this->memoryMap && this->deleter) {
         this->deleter->Delete(this->memoryMap);
     }
@@ -283,6 +349,7 @@ error RemoteMemoryMap::Stop()
     if (!this->memoryMap) {
         return errors::New("Memory map is null");
     }
+    this->stopNotifier->NotifyAll();
     auto err = FromDocaError(doca_mmap_stop(this->memoryMap));
     if (err) {
         return errors::Wrap(err, "Failed to stop memory map");
@@ -305,8 +372,8 @@ error RemoteMemoryMap::RemoveDevice()
     return nullptr;
 }
 
-std::tuple<RemoteMemoryMapPtr, error> RemoteMemoryMap::CreateFromExport(std::vector<std::uint8_t> & exportDesc,
-                                                                        DevicePtr device)
+std::tuple<RemoteMemoryMapPtr, error> RemoteMemoryMap::CreateFromExport(
+    const std::vector<std::uint8_t> & exportDesc, DevicePtr device)
 {
     if (device == nullptr) {
         return { nullptr, errors::New("Given device is null") };
@@ -314,7 +381,7 @@ std::tuple<RemoteMemoryMapPtr, error> RemoteMemoryMap::CreateFromExport(std::vec
 
     doca_mmap * mmap = nullptr;
     doca_data * userData = nullptr;
-    auto err = FromDocaError(doca_mmap_create_from_export(userData, static_cast<void *>(exportDesc.data()),
+    auto err = FromDocaError(doca_mmap_create_from_export(userData, static_cast<const void *>(exportDesc.data()),
                                                           exportDesc.size(), device->GetNative(), &mmap));
     if (err) {
         return { nullptr, errors::New("Failed to create remote memory map from exported descriptor") };
@@ -345,6 +412,16 @@ std::tuple<RemoteMemoryRangeHandle, error> RemoteMemoryMap::GetRemoteMemoryRange
     return { remoteMemrange, nullptr };
 }
 
+MemoryMapStopCallbackId RemoteMemoryMap::AddStopCallback(MemoryMapStopCallback callback)
+{
+    return this->stopNotifier->Add(std::move(callback));
+}
+
+void RemoteMemoryMap::RemoveStopCallback(MemoryMapStopCallbackId callbackId)
+{
+    this->stopNotifier->Remove(callbackId);
+}
+
 doca_mmap * RemoteMemoryMap::GetNative()
 {
     return this->memoryMap;
@@ -77,4 +77,41 @@ std::tuple<std::size_t, error> ProgressEngine::GetNumInflightTasks() const
     return { numInflightTasks, nullptr };
 }
 
+std::tuple<doca_notification_handle_t, error> ProgressEngine::GetNotificationHandle() const
+{
+    if (!this->progressEngine) {
+        return { doca_notification_handle_t{}, errors::New("Progress engine is null") };
+    }
+    doca_notification_handle_t handle{};
+    auto err = FromDocaError(doca_pe_get_notification_handle(this->progressEngine, &handle));
+    if (err) {
+        return { doca_notification_handle_t{}, errors::Wrap(err, "Failed to get progress engine notification handle") };
+    }
+    return { handle, nullptr };
+}
+
+error ProgressEngine::RequestNotification()
+{
+    if (!this->progressEngine) {
+        return errors::New("Progress engine is null");
+    }
+    auto err = FromDocaError(doca_pe_request_notification(this->progressEngine));
+    if (err) {
+        return errors::Wrap(err, "Failed to request progress engine notification");
+    }
+    return nullptr;
+}
+
+error ProgressEngine::ClearNotification(doca_notification_handle_t handle)
+{
+    if (!this->progressEngine) {
+        return errors::New("Progress engine is null");
+    }
+    auto err = FromDocaError(doca_pe_clear_notification(this->progressEngine, handle));
+    if (err) {
+        return errors::Wrap(err, "Failed to clear progress engine notification");
+    }
+    return nullptr;
+}
+
 #pragma endregion
\ No newline at end of file
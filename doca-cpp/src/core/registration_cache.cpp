@@ -0,0 +1,329 @@
+#include "doca-cpp/core/registration_cache.hpp"
+
+using doca::AccessFlags;
+using doca::DevicePtr;
+using doca::MemoryMapPtr;
+using doca::MemoryRangeHandle;
+using doca::MemoryRegistration;
+using doca::MemoryRegistrationCache;
+using doca::MemoryRegistrationCachePtr;
+using doca::MemoryRegistrationPtr;
+
+namespace
+{
+
+/// @brief Checks if permissions expose memory to remote peers
+bool isRemotelyAccessible(AccessFlags permissions)
+{
+    const auto remoteAccess = AccessFlags::rdmaRead | AccessFlags::rdmaWrite;
+    return static_cast<std::uint32_t>(permissions & remoteAccess) != 0;
+}
+
+/// @brief Checks if granted permissions include all requested ones
+bool permissionsSufficient(AccessFlags granted, AccessFlags requested)
+{
+    return (granted & requested) == requested;
+}
+
+/// @brief Gets start address of memory range
+std::uintptr_t rangeBegin(MemoryRangeHandle range)
+{
+    return reinterpret_cast<std::uintptr_t>(range.data());
+}
+
+}  // namespace
+
+#pragma region MemoryRegistration
+
+MemoryRegistration::MemoryRegistration(MemoryMapPtr initialMemoryMap, MemoryRangeHandle initialRange,
+                                       std::function<void()> initialRelease)
+    : memoryMap(initialMemoryMap), registeredRange(initialRange), release(std::move(initialRelease))
+{
+}
+
+MemoryRegistration::~MemoryRegistration()
+{
+    if (this->release) {
+        this->release();
+    }
+}
+
+MemoryMapPtr MemoryRegistration::GetMemoryMap() const
+{
+    return this->memoryMap;
+}
+
+MemoryRangeHandle MemoryRegistration::GetRegisteredRange() const
+{
+    return this->registeredRange;
+}
+
+#pragma endregion
+
+#pragma region MemoryRegistrationCache
+
+double MemoryRegistrationCache::Statistics::HitRate() const
+{
+    const auto lookups = this->hits + this->misses;
+    if (lookups == 0) {
+        return 0.0;
+    }
+    return static_cast<double>(this->hits) / static_cast<double>(lookups);
+}
+
+std::tuple<MemoryRegistrationCachePtr, error> MemoryRegistrationCache::Create(DevicePtr device, const Config & config)
+{
+    if (device == nullptr) {
+        return { nullptr, errors::New("Device is null") };
+    }
+    return { std::make_shared<MemoryRegistrationCache>(device, config), nullptr };
+}
+
+MemoryRegistrationCache::MemoryRegistrationCache(DevicePtr initialDevice, const Config & initialConfig)
+    : device(initialDevice), config(initialConfig)
+{
+}
+
+MemoryRegistrationCache::~MemoryRegistrationCache()
+{
+    this->Clear();
+}
+
+std::tuple<MemoryRegistrationPtr, error> MemoryRegistrationCache::Acquire(MemoryRangeHandle memoryRange,
+                                                                          AccessFlags permissions,
+                                                                          std::weak_ptr<const void> owner)
+{
+    if (memoryRange.empty()) {
+        return { nullptr, errors::New("Memory range is empty") };
+    }
+    // Registration of memory without owner could outlive memory and be served for other memory at the same address
+    if (owner.expired()) {
+        return { nullptr, errors::New("Memory owner is not alive") };
+    }
+
+    const auto begin = rangeBegin(memoryRange);
+    const auto end = begin + memoryRange.size();
+
+    // Memory maps moved out of cache are released after unlocking since their stop callbacks may take other locks
+    std::vector<MemoryMapPtr> evicted;
+    std::unique_lock<std::mutex> lock(this->cacheMutex);
+
+    auto entryId = EntryId{};
+    auto * cached = this->findContaining(begin, end, permissions, entryId, evicted);
+    if (cached != nullptr) {
+        this->statistics.hits++;
+        this->usageOrder.splice(this->usageOrder.begin(), this->usageOrder, cached->usage);
+        return { this->lease(entryId, *cached), nullptr };
+    }
+    this->statistics.misses++;
+
+    // Merge unused local registrations overlapping requested range into one wider registration
+    auto registeredBegin = begin;
+    auto registeredEnd = end;
+    auto registeredPermissions = permissions;
+    std::vector<std::weak_ptr<const void>> registeredOwners = { owner };
+    if (!isRemotelyAccessible(permissions)) {
+        std::vector<EntryId> merged;
+        std::vector<EntryId> stale;
+        auto it = this->entriesByAddress.lower_bound(begin > this->maxRangeLength ? begin - this->maxRangeLength : 0);
+        for (; it != this->entriesByAddress.end() && it->first < end; ++it) {
+            const auto & entry = this->entries.at(it->second);
+            const auto entryEnd = it->first + entry.range.size();
+            if (entryEnd <= begin || entry.leases > 0 || isRemotelyAccessible(entry.permissions)) {
+                continue;
+            }
+            // Range of freed memory is not registered again
+            if (entry.IsStale()) {
+                stale.push_back(it->second);
+                continue;
+            }
+            registeredBegin = std::min(registeredBegin, it->first);
+            registeredEnd = std::max(registeredEnd, entryEnd);
+            registeredPermissions = registeredPermissions | entry.permissions;
+            registeredOwners.insert(registeredOwners.end(), entry.owners.begin(), entry.owners.end());
+            merged.push_back(it->second);
+        }
+        for (const auto mergedId : merged) {
+            evicted.push_back(this->remove(mergedId));
+        }
+        this->removeStale(stale, evicted);
+        this->statistics.merges += merged.size();
+    }
+
+    const auto registeredRange =
+        MemoryRangeHandle(reinterpret_cast<std::uint8_t *>(registeredBegin), registeredEnd - registeredBegin);
+
+    auto [memoryMap, err] = doca::MemoryMap::Create()
+                                .AddDevice(this->device)
+                                .SetMemoryRange(registeredRange)
+                                .SetPermissions(registeredPermissions)
+                                .Start();
+    if (err) {
+        return { nullptr, errors::Wrap(err, "Failed to register memory range") };
+    }
+
+    const auto newEntryId = this->nextEntryId++;
+    this->usageOrder.push_front(newEntryId);
+    auto & entry = this->entries[newEntryId];
+    entry.memoryMap = memoryMap;
+    entry.range = registeredRange;
+    entry.permissions = registeredPermissions;
+    entry.usage = this->usageOrder.begin();
+    entry.owners = std::move(registeredOwners);
+    this->entriesByAddress.emplace(registeredBegin, newEntryId);
+    this->maxRangeLength = std::max(this->maxRangeLength, registeredRange.size());
+    this->statistics.pinnedBytes += registeredRange.size();
+    this->statistics.entries = this->entries.size();
+
+    auto registration = this->lease(newEntryId, entry);
+    this->evictOverBudget(evicted);
+
+    return { registration, nullptr };
+}
+
+void MemoryRegistrationCache::Clear()
+{
+    std::vector<MemoryMapPtr> evicted;
+    std::lock_guard<std::mutex> lock(this->cacheMutex);
+
+    std::vector<EntryId> unused;
+    for (const auto & [entryId, entry] : this->entries) {
+        if (entry.leases == 0) {
+            unused.push_back(entryId);
+        }
+    }
+    for (const auto entryId : unused) {
+        evicted.push_back(this->remove(entryId));
+    }
+}
+
+MemoryRegistrationCache::Statistics MemoryRegistrationCache::GetStatistics() const
+{
+    std::lock_guard<std::mutex> lock(this->cacheMutex);
+    return this->statistics;
+}
+
+MemoryRegistrationCache::Entry * MemoryRegistrationCache::findContaining(std::uintptr_t begin, std::uintptr_t end,
+                                                                         AccessFlags permissions, EntryId & entryId,
+                                                                         std::vector<MemoryMapPtr> & evicted)
+{
+    const auto exactRangeRequired = isRemotelyAccessible(permissions);
+
+    // Walk back from requested start address while cached ranges may still reach it
+    std::vector<EntryId> stale;
+    Entry * found = nullptr;
+    auto it = this->entriesByAddress.upper_bound(begin);
+    while (it != this->entriesByAddress.begin()) {
+        --it;
+        if (begin - it->first > this->maxRangeLength) {
+            break;
+        }
+        auto & entry = this->entries.at(it->second);
+        const auto entryEnd = it->first + entry.range.size();
+        if (exactRangeRequired && (it->first != begin || entryEnd != end)) {
+            continue;
+        }
+        if (entryEnd < end || !permissionsSufficient(entry.permissions, permissions)) {
+            continue;
+        }
+        // Registration of freed memory would point NIC at pages of old allocation
+        if (entry.IsStale()) {
+            stale.push_back(it->second);
+            continue;
+        }
+        entryId = it->second;
+        found = &entry;
+        break;
+    }
+
+    this->removeStale(stale, evicted);
+    return found;
+}
+
+void MemoryRegistrationCache::removeStale(const std::vector<EntryId> & candidates, std::vector<MemoryMapPtr> & evicted)
+{
+    for (const auto entryId : candidates) {
+        auto it = this->entries.find(entryId);
+        if (it != this->entries.end() && it->second.leases == 0 && it->second.IsStale()) {
+            evicted.push_back(this->remove(entryId));
+            this->statistics.evictions++;
+        }
+    }
+}
+
+bool MemoryRegistrationCache::Entry::IsStale() const
+{
+    return std::ranges::any_of(this->owners, [](const auto & owner) { return owner.expired(); });
+}
+
+MemoryRegistrationPtr MemoryRegistrationCache::lease(EntryId entryId, Entry & entry)
+{
+    entry.leases++;
+    auto weakCache = this->weak_from_this();
+    return std::make_shared<MemoryRegistration>(entry.memoryMap, entry.range, [weakCache, entryId]() {
+        if (auto cache = weakCache.lock()) {
+            cache->returnLease(entryId);
+        }
+    });
+}
+
+void MemoryRegistrationCache::returnLease(EntryId entryId)
+{
+    std::vector<MemoryMapPtr> evicted;
+    std::lock_guard<std::mutex> lock(this->cacheMutex);
+
+    auto it = this->entries.find(entryId);
+    if (it == this->entries.end()) {
+        return;
+    }
+    it->second.leases--;
+    if (it->second.leases == 0) {
+        // Registration whose memory was freed while leased is released at once
+        this->removeStale({ entryId }, evicted);
+        this->evictOverBudget(evicted);
+    }
+}
+
+void MemoryRegistrationCache::evictOverBudget(std::vector<MemoryMapPtr> & evicted)
+{
+    auto it = this->usageOrder.end();
+    while (this->statistics.pinnedBytes > this->config.maxPinnedBytes && it != this->usageOrder.begin()) {
+        --it;
+        const auto entryId = *it;
+        if (this->entries.at(entryId).leases > 0) {
+            continue;
+        }
+        // Move iterator off entry being removed; next step continues from its more recently used neighbour
+        it = std::next(it);
+        evicted.push_back(this->remove(entryId));
+        this->statistics.evictions++;
+    }
+}
+
+MemoryMapPtr MemoryRegistrationCache::remove(EntryId entryId)
+{
+    auto it = this->entries.find(entryId);
+    if (it == this->entries.end()) {
+        return nullptr;
+    }
+    auto & entry = it->second;
+
+    const auto begin = rangeBegin(entry.range);
+    auto [first, last] = this->entriesByAddress.equal_range(begin);
+    for (auto addressIt = first; addressIt != last; ++addressIt) {
+        if (addressIt->second == entryId) {
+            this->entriesByAddress.erase(addressIt);
+            break;
+        }
+    }
+
+    this->usageOrder.erase(entry.usage);
+    this->statistics.pinnedBytes -= entry.range.size();
+
+    auto memoryMap = std::move(entry.memoryMap);
+    this->entries.erase(it);
+    this->statistics.entries = this->entries.size();
+    return memoryMap;
+}
+
+#pragma endregion
@@ -25,3 +25,8 @@ RdmaOperationResponce RdmaAwaitable::AwaitWithTimeout(const std::chrono::millise
 
     return { nullptr, errors::New("Task execution timed out") };
 }
+
+bool RdmaAwaitable::IsReady() const
+{
+    return this->taskFuture.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+}
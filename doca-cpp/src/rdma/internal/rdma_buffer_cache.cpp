@@ -0,0 +1,346 @@
+#include "doca-cpp/rdma/internal/rdma_buffer_cache.hpp"
+
+#include "doca-cpp/logging/logging.hpp"
+
+#ifdef DOCA_CPP_ENABLE_LOGGING
+namespace
+{
+inline const auto loggerConfig = doca::logging::GetDefaultLoggerConfig();
+inline const auto loggerContext = kvalog::Logger::Context{
+    .appName = "doca-cpp",
+    .moduleName = "buffer-cache",
+};
+}  // namespace
+DOCA_CPP_DEFINE_LOGGER(loggerConfig, loggerContext)
+#endif
+
+using doca::rdma::RdmaBufferCache;
+using doca::rdma::RdmaBufferCachePtr;
+using doca::rdma::RdmaBufferLease;
+using doca::rdma::RdmaBufferLeasePtr;
+
+// ----------------------------------------------------------------------------
+// RdmaBufferLease
+// ----------------------------------------------------------------------------
+
+RdmaBufferLease::RdmaBufferLease(doca::BufferPtr initialBuffer, std::function<void()> initialRelease)
+    : buffer(initialBuffer), release(std::move(initialRelease))
+{
+}
+
+RdmaBufferLease::~RdmaBufferLease()
+{
+    if (this->release) {
+        this->release();
+    }
+}
+
+doca::BufferPtr RdmaBufferLease::GetBuffer() const
+{
+    return this->buffer;
+}
+
+// ----------------------------------------------------------------------------
+// RdmaBufferCache
+// ----------------------------------------------------------------------------
+
+RdmaBufferCachePtr RdmaBufferCache::Create(doca::ElasticBufferInventoryPtr inventory, std::size_t maxEntries)
+{
+    return std::make_shared<RdmaBufferCache>(inventory, maxEntries);
+}
+
+RdmaBufferCache::RdmaBufferCache(doca::ElasticBufferInventoryPtr initialInventory, std::size_t maxEntries)
+    : inventory(initialInventory), maxEntries(maxEntries)
+{
+}
+
+RdmaBufferCache::~RdmaBufferCache()
+{
+    this->Clear();
+}
+
+std::tuple<RdmaBufferLeasePtr, error> RdmaBufferCache::GetBuffer(doca::MemoryMapPtr memoryMap,
+                                                                 std::span<std::uint8_t> memoryRange,
+                                                                 Direction direction)
+{
+    return this->getBuffer(memoryMap, memoryRange, direction);
+}
+
+std::tuple<RdmaBufferLeasePtr, error> RdmaBufferCache::GetBuffer(doca::RemoteMemoryMapPtr memoryMap,
+                                                                 std::span<std::uint8_t> memoryRange,
+                                                                 Direction direction)
+{
+    return this->getBuffer(memoryMap, memoryRange, direction);
+}
+
+template <typename MemoryMapType>
+std::tuple<RdmaBufferLeasePtr, error> RdmaBufferCache::getBuffer(std::shared_ptr<MemoryMapType> memoryMap,
+                                                                 std::span<std::uint8_t> memoryRange,
+                                                                 Direction direction)
+{
+    if (memoryMap == nullptr) {
+        return { nullptr, errors::New("Memory map is null") };
+    }
+    if (this->inventory == nullptr) {
+        return { nullptr, errors::New("Buffer inventory is null") };
+    }
+
+    const auto key = Key{
+        .memoryMap = static_cast<const void *>(memoryMap.get()),
+        .address = static_cast<const void *>(memoryRange.data()),
+        .length = memoryRange.size(),
+        .direction = direction,
+    };
+
+    // Evicted entries are released after cache mutex is unlocked: releasing may destroy memory map which in turn
+    // invokes stop callback of this cache
+    std::vector<Entry> evicted;
+    auto deferred = defer::MakeDefer([&evicted]() {
+        for (auto & entry : evicted) {
+            RdmaBufferCache::release(entry);
+        }
+    });
+
+    std::lock_guard<std::mutex> lock(this->cacheMutex);
+
+    // Buffer not kept in cache is given back to inventory as soon as its lease ends
+    auto leaseUncached = [](doca::BufferPtr buffer) {
+        return std::make_shared<RdmaBufferLease>(buffer, [buffer]() {
+            std::ignore = buffer->DecRefcount();
+        });
+    };
+
+    auto found = this->entries.find(key);
+
+    // Cache hit: prepare buffer for next operation
+    if (found != this->entries.end() && found->second.inUse == 0) {
+        this->usageOrder.splice(this->usageOrder.begin(), this->usageOrder, found->second.usage);
+        auto buffer = found->second.buffer;
+        auto err = RdmaBufferCache::resetBuffer(buffer, memoryRange, direction);
+        if (err) {
+            return { nullptr, errors::Wrap(err, "Failed to reset cached buffer") };
+        }
+        found->second.inUse++;
+        return { this->lease(key, buffer), nullptr };
+    }
+
+    // Cached buffer is used by operation still in flight: its data section must stay intact, so this operation gets
+    // its own buffer
+    if (found != this->entries.end()) {
+        this->usageOrder.splice(this->usageOrder.begin(), this->usageOrder, found->second.usage);
+        auto [buffer, bufErr] = this->allocateBuffer(memoryMap, memoryRange, direction, evicted);
+        if (bufErr) {
+            return { nullptr, bufErr };
+        }
+        return { leaseUncached(buffer), nullptr };
+    }
+
+    // Cache miss: make room and take new buffer from inventory
+    while (this->entries.size() >= this->maxEntries && this->evictLeastRecentlyUsed(evicted)) {
+    }
+
+    auto [buffer, bufErr] = this->allocateBuffer(memoryMap, memoryRange, direction, evicted);
+    if (bufErr) {
+        return { nullptr, bufErr };
+    }
+
+    // Every cached buffer is in use: serve operation without caching its buffer
+    if (this->entries.size() >= this->maxEntries) {
+        return { leaseUncached(buffer), nullptr };
+    }
+
+    // Release cached buffers when memory map is going to be stopped
+    auto weakCache = this->weak_from_this();
+    const auto * mapKey = key.memoryMap;
+    auto callbackId = memoryMap->AddStopCallback([weakCache, mapKey]() {
+        if (auto cache = weakCache.lock()) {
+            cache->invalidate(mapKey);
+        }
+    });
+    auto weakMap = std::weak_ptr<MemoryMapType>(memoryMap);
+
+    this->usageOrder.push_front(key);
+    this->entries.emplace(key, Entry{
+                                   .buffer = buffer,
+                                   .removeStopCallback =
+                                       [weakMap, callbackId]() {
+                                           if (auto map = weakMap.lock()) {
+                                               map->RemoveStopCallback(callbackId);
+                                           }
+                                       },
+                                   .usage = this->usageOrder.begin(),
+                                   .inUse = 1,
+                               });
+
+    DOCA_CPP_LOG_DEBUG(std::format("Cached new buffer, cache size {}", this->entries.size()));
+
+    return { this->lease(key, buffer), nullptr };
+}
+
+template <typename MemoryMapType>
+std::tuple<doca::BufferPtr, error> RdmaBufferCache::allocateBuffer(std::shared_ptr<MemoryMapType> memoryMap,
+                                                                   std::span<std::uint8_t> memoryRange,
+                                                                   Direction direction, std::vector<Entry> & evicted)
+{
+    auto allocate = [&]() -> std::tuple<doca::BufferPtr, error> {
+        auto * address = static_cast<void *>(memoryRange.data());
+        if (direction == Direction::source) {
+            return this->inventory->AllocBufferByData(memoryMap, address, memoryRange.size());
+        }
+        return this->inventory->AllocBufferByAddress(memoryMap, address, memoryRange.size());
+    };
+
+    // Inventory is exhausted: give back least recently used unused buffers until one is free, so full cache still
+    // serves operation as long as it holds any buffer not in use
+    auto [buffer, bufErr] = allocate();
+    while (bufErr && errors::Is(bufErr, doca::ErrorTypes::BufferInventoryExhausted) &&
+           this->evictLeastRecentlyUsed(evicted)) {
+        DOCA_CPP_LOG_DEBUG("Buffer inventory exhausted, evicted least recently used cached buffer");
+        std::tie(buffer, bufErr) = allocate();
+    }
+    if (bufErr) {
+        return { nullptr, errors::Wrap(bufErr, "Failed to allocate buffer from buffer inventory") };
+    }
+    return { buffer, nullptr };
+}
+
+RdmaBufferLeasePtr RdmaBufferCache::lease(const Key & key, doca::BufferPtr buffer)
+{
+    auto weakCache = this->weak_from_this();
+    return std::make_shared<RdmaBufferLease>(buffer, [weakCache, key, buffer]() {
+        // Cache already released its buffers when it is gone
+        if (auto cache = weakCache.lock()) {
+            cache->returnLease(key, buffer);
+        }
+    });
+}
+
+void RdmaBufferCache::returnLease(const Key & key, doca::BufferPtr buffer)
+{
+    std::list<Entry> released;
+    {
+        std::lock_guard<std::mutex> lock(this->cacheMutex);
+        if (auto found = this->entries.find(key); found != this->entries.end() && found->second.buffer == buffer) {
+            if (found->second.inUse > 0) {
+                found->second.inUse--;
+            }
+            return;
+        }
+
+        // Entry was invalidated while buffer was in use: release it with last lease
+        for (auto it = this->retiredEntries.begin(); it != this->retiredEntries.end(); ++it) {
+            if (it->buffer != buffer) {
+                continue;
+            }
+            if (it->inUse > 0) {
+                it->inUse--;
+            }
+            if (it->inUse == 0) {
+                released.splice(released.begin(), this->retiredEntries, it);
+            }
+            break;
+        }
+    }
+    for (auto & entry : released) {
+        RdmaBufferCache::release(entry);
+    }
+}
+
+error RdmaBufferCache::resetBuffer(doca::BufferPtr buffer, std::span<std::uint8_t> memoryRange, Direction direction)
+{
+    if (direction == Direction::source) {
+        // Source buffer must expose whole memory range as data to be transferred
+        return buffer->SetData(static_cast<void *>(memoryRange.data()), memoryRange.size());
+    }
+    // Destination buffer must have empty data section to receive transferred data
+    return buffer->ResetData();
+}
+
+void RdmaBufferCache::invalidate(const void * memoryMap)
+{
+    std::vector<Entry> invalidated;
+    {
+        std::lock_guard<std::mutex> lock(this->cacheMutex);
+        for (auto it = this->entries.begin(); it != this->entries.end();) {
+            if (it->first.memoryMap != memoryMap) {
+                ++it;
+                continue;
+            }
+            this->usageOrder.erase(it->second.usage);
+            // Buffer in use by operation in flight stays out of inventory until its last lease is returned
+            if (it->second.inUse > 0) {
+                this->retiredEntries.emplace_back(std::move(it->second));
+            } else {
+                invalidated.emplace_back(std::move(it->second));
+            }
+            it = this->entries.erase(it);
+        }
+    }
+    for (auto & entry : invalidated) {
+        RdmaBufferCache::release(entry);
+    }
+}
+
+bool RdmaBufferCache::evictLeastRecentlyUsed(std::vector<Entry> & evicted)
+{
+    // Buffers in use by operations in flight are skipped
+    auto usage = std::find_if(this->usageOrder.rbegin(), this->usageOrder.rend(), [this](const Key & key) {
+        auto found = this->entries.find(key);
+        return found == this->entries.end() || found->second.inUse == 0;
+    });
+    if (usage == this->usageOrder.rend()) {
+        return false;
+    }
+
+    const auto key = *usage;
+    this->usageOrder.erase(std::next(usage).base());
+    auto node = this->entries.extract(key);
+    if (node.empty()) {
+        return true;
+    }
+
+    // Buffer goes back to inventory at once, so that allocation following eviction finds free slot. Buffer object
+    // and stop callback are released after unlocking, since they may hold last reference to memory map
+    auto & entry = node.mapped();
+    if (entry.buffer && !entry.bufferReturned) {
+        std::ignore = entry.buffer->DecRefcount();
+        entry.bufferReturned = true;
+    }
+    evicted.emplace_back(std::move(entry));
+    return true;
+}
+
+void RdmaBufferCache::release(Entry & entry)
+{
+    if (entry.removeStopCallback) {
+        entry.removeStopCallback();
+    }
+    if (entry.buffer && !entry.bufferReturned) {
+        std::ignore = entry.buffer->DecRefcount();
+        entry.bufferReturned = true;
+    }
+}
+
+void RdmaBufferCache::Clear()
+{
+    std::map<Key, Entry> released;
+    std::list<Entry> retired;
+    {
+        std::lock_guard<std::mutex> lock(this->cacheMutex);
+        released.swap(this->entries);
+        retired.swap(this->retiredEntries);
+        this->usageOrder.clear();
+    }
+    for (auto & [_, entry] : released) {
+        RdmaBufferCache::release(entry);
+    }
+    for (auto & entry : retired) {
+        RdmaBufferCache::release(entry);
+    }
+}
+
+std::size_t RdmaBufferCache::Size() const
+{
+    std::lock_guard<std::mutex> lock(this->cacheMutex);
+    return this->entries.size();
+}
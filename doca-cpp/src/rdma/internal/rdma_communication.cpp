@@ -1,7 +1,12 @@
 #include "doca-cpp/rdma/internal/rdma_communication.hpp"
 
 using doca::rdma::communication::Acknowledge;
+using doca::rdma::communication::Catalog;
+using doca::rdma::communication::CatalogRequest;
+using doca::rdma::communication::GroupRequest;
+using doca::rdma::communication::GroupResponce;
 using doca::rdma::communication::MessageSerializer;
+using doca::rdma::communication::MessageType;
 using doca::rdma::communication::Request;
 using doca::rdma::communication::Responce;
 
@@ -31,95 +36,457 @@ std::string Responce::CodeDescription(const Responce::Code & code)
     }
 }
 
-std::vector<uint8_t> MessageSerializer::SerializeRequest(const Request & request)
+namespace
 {
-    std::vector<uint8_t> buffer;
-    size_t offset = 0;
 
-    // Serialize endpoint type
-    buffer.push_back(static_cast<uint8_t>(request.endpointType));
-    offset += sizeof(uint8_t);
+using doca::rdma::communication::RequestId;
 
-    // Serialize path length
-    uint32_t pathLen = static_cast<uint32_t>(request.endpointPath.size());
-    buffer.resize(buffer.size() + sizeof(pathLen));
-    std::memcpy(buffer.data() + offset, &pathLen, sizeof(pathLen));
-    offset += sizeof(pathLen);
+/// @brief Size of header every serialized message starts with: message type and request ID
+constexpr std::size_t messageHeaderSize = sizeof(std::uint8_t) + sizeof(RequestId);
 
-    // Serialize path
-    buffer.insert(buffer.end(), request.endpointPath.begin(), request.endpointPath.end());
+/// @brief Writes message fields into caller buffer. Bytes past end of buffer are counted but not written, so caller
+/// learns size message needs
+class MessageWriter
+{
+public:
+    explicit MessageWriter(std::span<std::uint8_t> buffer) : buffer(buffer) {}
+
+    /// @brief Writes raw bytes
+    void WriteBytes(const void * data, std::size_t size)
+    {
+        if (this->offset <= this->buffer.size() && size <= this->buffer.size() - this->offset && size != 0) {
+            std::memcpy(this->buffer.data() + this->offset, data, size);
+        }
+        this->offset += size;
+    }
+
+    /// @brief Writes trivially copyable value
+    template <typename Value>
+    void Write(const Value & value)
+    {
+        static_assert(std::is_trivially_copyable_v<Value>);
+        this->WriteBytes(&value, sizeof(value));
+    }
+
+    /// @brief Writes length-prefixed byte sequence
+    void WriteSequence(std::span<const std::uint8_t> bytes)
+    {
+        this->Write(static_cast<std::uint32_t>(bytes.size()));
+        this->WriteBytes(bytes.data(), bytes.size());
+    }
+
+    /// @brief Writes message header
+    void WriteHeader(MessageType type, RequestId requestId)
+    {
+        this->Write(static_cast<std::uint8_t>(type));
+        this->Write(requestId);
+    }
+
+    /// @brief Gets number of bytes written; fails if they did not fit into buffer
+    std::tuple<std::size_t, error> Finish() const
+    {
+        if (this->offset > this->buffer.size()) {
+            return { this->offset, doca::rdma::communication::ErrorTypes::MessageBufferTooSmall };
+        }
+        return { this->offset, nullptr };
+    }
+
+private:
+    std::span<std::uint8_t> buffer;
+    std::size_t offset = 0;
+};
+
+/// @brief Reads message fields from received message with bounds checking; reading past end of message marks it
+/// truncated and yields zero values
+class MessageReader
+{
+public:
+    explicit MessageReader(std::span<const std::uint8_t> buffer) : buffer(buffer) {}
+
+    /// @brief Reads raw bytes; returned span points into message
+    std::span<const std::uint8_t> ReadBytes(std::size_t size)
+    {
+        if (this->truncated || size > this->buffer.size() - this->offset) {
+            this->truncated = true;
+            return {};
+        }
+        auto bytes = this->buffer.subspan(this->offset, size);
+        this->offset += size;
+        return bytes;
+    }
+
+    /// @brief Reads trivially copyable value
+    template <typename Value>
+    void Read(Value & value)
+    {
+        static_assert(std::is_trivially_copyable_v<Value>);
+        auto bytes = this->ReadBytes(sizeof(value));
+        if (bytes.empty()) {
+            value = Value{};
+            return;
+        }
+        std::memcpy(&value, bytes.data(), sizeof(value));
+    }
+
+    /// @brief Reads one-byte enumeration value
+    template <typename Enum>
+    void ReadEnum(Enum & value)
+    {
+        std::uint8_t raw = 0;
+        this->Read(raw);
+        value = static_cast<Enum>(raw);
+    }
+
+    /// @brief Reads length-prefixed byte sequence; returned span points into message
+    std::span<const std::uint8_t> ReadSequence()
+    {
+        std::uint32_t size = 0;
+        this->Read(size);
+        return this->ReadBytes(size);
+    }
+
+    /// @brief Reads message header and returns request ID
+    RequestId ReadHeader()
+    {
+        std::uint8_t type = 0;
+        RequestId requestId = 0;
+        this->Read(type);
+        this->Read(requestId);
+        return requestId;
+    }
+
+    /// @brief Checks if reading went past end of message
+    bool Truncated() const
+    {
+        return this->truncated;
+    }
 
-    return buffer;
+    /// @brief Checks result of reading; message is malformed if it is shorter than its fields
+    error Finish(const std::string & messageName) const
+    {
+        if (this->truncated) {
+            return errors::Wrap(doca::rdma::communication::ErrorTypes::MessageTruncated, messageName);
+        }
+        return nullptr;
+    }
+
+private:
+    std::span<const std::uint8_t> buffer;
+    std::size_t offset = 0;
+    bool truncated = false;
+};
+
+/// @brief Views string as bytes
+std::span<const std::uint8_t> stringBytes(const std::string & value)
+{
+    return { reinterpret_cast<const std::uint8_t *>(value.data()), value.size() };
 }
 
-Request MessageSerializer::DeserializeRequest(const std::vector<uint8_t> & buffer)
+/// @brief Views descriptor as bytes; null descriptor is empty
+std::span<const std::uint8_t> descriptorBytes(const doca::rdma::RdmaMemoryDescriptorPtr & descriptor)
 {
-    Request request;
-    size_t offset = 0;
+    if (descriptor == nullptr) {
+        return {};
+    }
+    return { descriptor->data(), descriptor->size() };
+}
 
-    // Deserialize endpoint type
-    request.endpointType = static_cast<RdmaEndpointType>(buffer[offset]);
-    offset += 1;
+/// @brief Writes fields of request entry that follow message header
+void writeRequestBody(MessageWriter & writer, const Request & request)
+{
+    writer.Write(static_cast<std::uint8_t>(request.endpointType));
+    writer.Write(request.endpointNumber);
+    writer.WriteSequence(stringBytes(request.endpointPath));
+}
+
+/// @brief Reads fields of request entry that follow message header
+void readRequestBody(MessageReader & reader, Request & request)
+{
+    reader.ReadEnum(request.endpointType);
+    reader.Read(request.endpointNumber);
+    const auto path = reader.ReadSequence();
+    request.endpointPath.assign(path.begin(), path.end());
+}
 
-    // Deserialize path length
-    uint32_t pathLen;
-    std::memcpy(&pathLen, buffer.data() + offset, sizeof(pathLen));
-    offset += sizeof(pathLen);
+/// @brief Writes fields of responce entry that follow message header
+void writeResponceBody(MessageWriter & writer, const Responce & responce)
+{
+    writer.Write(static_cast<std::uint8_t>(responce.responceCode));
+    writer.Write(responce.descriptorGeneration);
+    writer.Write(responce.memoryOffset);
+    writer.Write(responce.memoryLength);
+    writer.Write(responce.slotIndex);
+    writer.WriteSequence(descriptorBytes(responce.memoryDescriptor));
+}
 
-    // Deserialize path
-    request.endpointPath = std::string(buffer.begin() + offset, buffer.begin() + offset + pathLen);
+/// @brief Reads fields of responce entry that follow message header
+void readResponceBody(MessageReader & reader, Responce & responce)
+{
+    reader.ReadEnum(responce.responceCode);
+    reader.Read(responce.descriptorGeneration);
+    reader.Read(responce.memoryOffset);
+    reader.Read(responce.memoryLength);
+    reader.Read(responce.slotIndex);
 
-    return request;
+    // Descriptor is omitted when client already got descriptor of the same generation
+    const auto descriptor = reader.ReadSequence();
+    if (!descriptor.empty()) {
+        responce.memoryDescriptor =
+            std::make_shared<const Responce::RemoteMemoryDescriptor>(descriptor.begin(), descriptor.end());
+    }
 }
 
-std::vector<uint8_t> MessageSerializer::SerializeResponse(const Responce & responce)
+}  // namespace
+
+std::tuple<MessageType, error> MessageSerializer::GetMessageType(std::span<const std::uint8_t> buffer)
 {
-    std::vector<uint8_t> buffer;
+    if (buffer.size() < messageHeaderSize) {
+        return { MessageType::request, errors::New("Message is shorter than message header") };
+    }
+    const auto type = static_cast<MessageType>(buffer[0]);
+    switch (type) {
+        case MessageType::request:
+        case MessageType::responce:
+        case MessageType::acknowledge:
+        case MessageType::catalogRequest:
+        case MessageType::catalog:
+        case MessageType::groupRequest:
+        case MessageType::groupResponce:
+            return { type, nullptr };
+        default:
+            return { type, errors::New("Unknown message type") };
+    }
+}
 
-    // Serialize response code
-    buffer.push_back(static_cast<uint8_t>(responce.responceCode));
+std::tuple<std::size_t, error> MessageSerializer::Serialize(const Request & request, std::span<std::uint8_t> buffer)
+{
+    MessageWriter writer(buffer);
+    writer.WriteHeader(MessageType::request, request.requestId);
+    writeRequestBody(writer, request);
+    return writer.Finish();
+}
 
-    // Serialize memory descriptor length
-    uint32_t descLen = static_cast<uint32_t>(responce.memoryDescriptor.size());
-    buffer.resize(buffer.size() + sizeof(descLen));
-    std::memcpy(buffer.data() + 1, &descLen, sizeof(descLen));
+std::tuple<std::size_t, error> MessageSerializer::Serialize(const Responce & responce, std::span<std::uint8_t> buffer)
+{
+    MessageWriter writer(buffer);
+    writer.WriteHeader(MessageType::responce, responce.requestId);
+    writeResponceBody(writer, responce);
+    return writer.Finish();
+}
 
-    // Serialize memory descriptor
-    buffer.insert(buffer.end(), responce.memoryDescriptor.begin(), responce.memoryDescriptor.end());
+std::tuple<std::size_t, error> MessageSerializer::Serialize(const Acknowledge & ack, std::span<std::uint8_t> buffer)
+{
+    MessageWriter writer(buffer);
+    writer.WriteHeader(MessageType::acknowledge, ack.requestId);
+    writer.Write(static_cast<std::uint8_t>(ack.ackCode));
+    return writer.Finish();
+}
 
-    return buffer;
+std::tuple<std::size_t, error> MessageSerializer::Serialize(const CatalogRequest & catalogRequest,
+                                                            std::span<std::uint8_t> buffer)
+{
+    MessageWriter writer(buffer);
+    writer.WriteHeader(MessageType::catalogRequest, catalogRequest.requestId);
+    return writer.Finish();
 }
 
-Responce MessageSerializer::DeserializeResponse(const std::vector<uint8_t> & buffer)
+std::tuple<std::size_t, error> MessageSerializer::Serialize(const Catalog & catalog, std::span<std::uint8_t> buffer)
 {
-    Responce resp;
-    size_t offset = 0;
+    MessageWriter writer(buffer);
+    writer.WriteHeader(MessageType::catalog, catalog.requestId);
+
+    // Regions: generation and descriptor of every mapped memory region
+    writer.Write(static_cast<std::uint32_t>(catalog.regions.size()));
+    for (const auto & region : catalog.regions) {
+        writer.Write(region.descriptorGeneration);
+        writer.WriteSequence(descriptorBytes(region.memoryDescriptor));
+    }
 
-    // Deserialize response code
-    resp.responceCode = static_cast<Responce::Code>(buffer[offset]);
-    offset += 1;
+    // Endpoints: number, type, path and location of every slot
+    writer.Write(static_cast<std::uint32_t>(catalog.endpoints.size()));
+    for (const auto & endpoint : catalog.endpoints) {
+        writer.Write(endpoint.endpointNumber);
+        writer.Write(static_cast<std::uint8_t>(endpoint.endpointType));
+        writer.WriteSequence(stringBytes(endpoint.endpointPath));
+        writer.Write(static_cast<std::uint32_t>(endpoint.slots.size()));
+        for (const auto & slot : endpoint.slots) {
+            writer.Write(slot.descriptorGeneration);
+            writer.Write(slot.memoryOffset);
+            writer.Write(slot.memoryLength);
+        }
+    }
+
+    return writer.Finish();
+}
 
-    // Deserialize memory descriptor length
-    uint32_t descLen;
-    std::memcpy(&descLen, buffer.data() + offset, sizeof(descLen));
-    offset += sizeof(descLen);
+std::tuple<std::size_t, error> MessageSerializer::Serialize(const GroupRequest & groupRequest,
+                                                            std::span<std::uint8_t> buffer)
+{
+    MessageWriter writer(buffer);
+    writer.WriteHeader(MessageType::groupRequest, groupRequest.requestId);
+    writer.Write(static_cast<std::uint32_t>(groupRequest.requests.size()));
+    for (const auto & request : groupRequest.requests) {
+        writeRequestBody(writer, request);
+    }
+    return writer.Finish();
+}
+
+std::tuple<std::size_t, error> MessageSerializer::Serialize(const GroupResponce & groupResponce,
+                                                            std::span<std::uint8_t> buffer)
+{
+    MessageWriter writer(buffer);
+    writer.WriteHeader(MessageType::groupResponce, groupResponce.requestId);
+    writer.Write(static_cast<std::uint8_t>(groupResponce.responceCode));
+    writer.Write(static_cast<std::uint32_t>(groupResponce.responces.size()));
+    for (const auto & responce : groupResponce.responces) {
+        writeResponceBody(writer, responce);
+    }
+    return writer.Finish();
+}
 
-    // Deserialize memory descriptor
-    resp.memoryDescriptor = std::vector<uint8_t>(buffer.begin() + offset, buffer.begin() + offset + descLen);
+std::tuple<Request, error> MessageSerializer::DeserializeRequest(std::span<const std::uint8_t> buffer)
+{
+    MessageReader reader(buffer);
+    Request request;
+    request.requestId = reader.ReadHeader();
+    readRequestBody(reader, request);
 
-    return resp;
+    auto err = reader.Finish("Request");
+    if (err) {
+        return { Request(), err };
+    }
+    return { std::move(request), nullptr };
 }
 
-std::vector<uint8_t> MessageSerializer::SerializeAcknowledge(const Acknowledge & ack)
+std::tuple<Responce, error> MessageSerializer::DeserializeResponse(std::span<const std::uint8_t> buffer)
 {
-    std::vector<uint8_t> buffer;
-    buffer.push_back(static_cast<uint8_t>(ack.ackCode));
-    return buffer;
+    MessageReader reader(buffer);
+    Responce responce;
+    responce.requestId = reader.ReadHeader();
+    readResponceBody(reader, responce);
+
+    auto err = reader.Finish("Responce");
+    if (err) {
+        return { Responce(), err };
+    }
+    return { std::move(responce), nullptr };
 }
 
-Acknowledge MessageSerializer::DeserializeAcknowledge(const std::vector<uint8_t> & buffer)
+std::tuple<Acknowledge, error> MessageSerializer::DeserializeAcknowledge(std::span<const std::uint8_t> buffer)
 {
+    MessageReader reader(buffer);
     Acknowledge ack;
-    ack.ackCode = static_cast<Acknowledge::Code>(buffer[0]);
-    return ack;
-}
\ No newline at end of file
+    ack.requestId = reader.ReadHeader();
+    reader.ReadEnum(ack.ackCode);
+
+    auto err = reader.Finish("Acknowledge");
+    if (err) {
+        return { Acknowledge(), err };
+    }
+    return { ack, nullptr };
+}
+
+std::tuple<CatalogRequest, error> MessageSerializer::DeserializeCatalogRequest(std::span<const std::uint8_t> buffer)
+{
+    MessageReader reader(buffer);
+    CatalogRequest catalogRequest;
+    catalogRequest.requestId = reader.ReadHeader();
+
+    auto err = reader.Finish("Catalog request");
+    if (err) {
+        return { CatalogRequest(), err };
+    }
+    return { catalogRequest, nullptr };
+}
+
+std::tuple<Catalog, error> MessageSerializer::DeserializeCatalog(std::span<const std::uint8_t> buffer)
+{
+    MessageReader reader(buffer);
+    Catalog catalog;
+    catalog.requestId = reader.ReadHeader();
+
+    // Counts come from peer, so nothing is reserved for them; truncated message stops reading at once
+    std::uint32_t regionCount = 0;
+    reader.Read(regionCount);
+    for (std::uint32_t index = 0; index < regionCount && !reader.Truncated(); index++) {
+        Catalog::Region region;
+        reader.Read(region.descriptorGeneration);
+        const auto descriptor = reader.ReadSequence();
+        region.memoryDescriptor =
+            std::make_shared<const doca::rdma::RdmaMemoryDescriptor>(descriptor.begin(), descriptor.end());
+        catalog.regions.push_back(std::move(region));
+    }
+
+    std::uint32_t endpointCount = 0;
+    reader.Read(endpointCount);
+    for (std::uint32_t index = 0; index < endpointCount && !reader.Truncated(); index++) {
+        Catalog::Endpoint endpoint;
+        reader.Read(endpoint.endpointNumber);
+        reader.ReadEnum(endpoint.endpointType);
+        const auto path = reader.ReadSequence();
+        endpoint.endpointPath.assign(path.begin(), path.end());
+
+        std::uint32_t slotCount = 0;
+        reader.Read(slotCount);
+        for (std::uint32_t slotIndex = 0; slotIndex < slotCount && !reader.Truncated(); slotIndex++) {
+            Catalog::Slot slot;
+            reader.Read(slot.descriptorGeneration);
+            reader.Read(slot.memoryOffset);
+            reader.Read(slot.memoryLength);
+            endpoint.slots.push_back(slot);
+        }
+        catalog.endpoints.push_back(std::move(endpoint));
+    }
+
+    auto err = reader.Finish("Catalog");
+    if (err) {
+        return { Catalog(), err };
+    }
+    return { std::move(catalog), nullptr };
+}
+
+std::tuple<GroupRequest, error> MessageSerializer::DeserializeGroupRequest(std::span<const std::uint8_t> buffer)
+{
+    MessageReader reader(buffer);
+    GroupRequest groupRequest;
+    groupRequest.requestId = reader.ReadHeader();
+
+    // Count comes from peer, so nothing is reserved for it; truncated message stops reading at once
+    std::uint32_t requestCount = 0;
+    reader.Read(requestCount);
+    for (std::uint32_t index = 0; index < requestCount && !reader.Truncated(); index++) {
+        Request request;
+        request.requestId = groupRequest.requestId;
+        readRequestBody(reader, request);
+        groupRequest.requests.push_back(std::move(request));
+    }
+
+    auto err = reader.Finish("Group request");
+    if (err) {
+        return { GroupRequest(), err };
+    }
+    return { std::move(groupRequest), nullptr };
+}
+
+std::tuple<GroupResponce, error> MessageSerializer::DeserializeGroupResponce(std::span<const std::uint8_t> buffer)
+{
+    MessageReader reader(buffer);
+    GroupResponce groupResponce;
+    groupResponce.requestId = reader.ReadHeader();
+    reader.ReadEnum(groupResponce.responceCode);
+
+    std::uint32_t responceCount = 0;
+    reader.Read(responceCount);
+    for (std::uint32_t index = 0; index < responceCount && !reader.Truncated(); index++) {
+        Responce responce;
+        responce.requestId = groupResponce.requestId;
+        readResponceBody(reader, responce);
+        groupResponce.responces.push_back(std::move(responce));
+    }
+
+    auto err = reader.Finish("Group responce");
+    if (err) {
+        return { GroupResponce(), err };
+    }
+    return { std::move(groupResponce), nullptr };
+}
@@ -1,5 +1,9 @@
 #include "doca-cpp/rdma/internal/rdma_executor.hpp"
 
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
 #include "doca-cpp/logging/logging.hpp"
 
 #ifdef DOCA_CPP_ENABLE_LOGGING
@@ -16,6 +20,7 @@ DOCA_CPP_DEFINE_LOGGER(loggerConfig, loggerContext)
 #endif
 
 using doca::rdma::RdmaAwaitable;
+using doca::rdma::RdmaBufferLeasePtr;
 using doca::rdma::RdmaConnection;
 using doca::rdma::RdmaConnectionPtr;
 using doca::rdma::RdmaConnectionRole;
@@ -27,22 +32,47 @@ using doca::rdma::RdmaOperationResponce;
 
 namespace constants
 {
-constexpr std::size_t initialBufferInventorySize = 16;
+/// @brief Every RDMA operation takes source and destination buffers
+constexpr std::size_t buffersPerOperation = 2;
+/// @brief Number of times inventory may grow beyond initial size
+constexpr std::size_t bufferInventoryGrowthFactor = 4;
+/// @brief Interval of progress polling when progress engine notification is not available
+constexpr auto workerPollInterval = std::chrono::microseconds(10);
+/// @brief Time stopping worker waits for tasks in flight to finish
+constexpr auto stopDrainTimeout = std::chrono::milliseconds(100);
 }  // namespace constants
 
-std::tuple<RdmaExecutorPtr, error> RdmaExecutor::Create(doca::DevicePtr initialDevice)
+namespace
+{
+
+/// @brief Sets responce of operation request and wakes its waiter
+void completeRequest(RdmaOperationRequest & request, RdmaOperationResponce responce)
+{
+    request.responcePromise->set_value(std::move(responce));
+    if (request.onCompleted) {
+        request.onCompleted();
+    }
+}
+
+}  // namespace
+
+std::tuple<RdmaExecutorPtr, error> RdmaExecutor::Create(doca::DevicePtr initialDevice, const Limits & limits)
 {
     if (initialDevice == nullptr) {
         return { nullptr, errors::New("Device is null") };
     }
 
+    if (limits.maxInflightOperations == 0 || limits.maxConnections == 0) {
+        return { nullptr, errors::New("Executor limits must be positive") };
+    }
+
     // Create RDMA engine
     auto [rdmaEngine, err] = RdmaEngine::Create(initialDevice)
                                  .SetTransportType(TransportType::rc)
                                  .SetGidIndex(0)
                                  .SetPermissions(doca::AccessFlags::localReadWrite | doca::AccessFlags::rdmaRead |
                                                  doca::AccessFlags::rdmaWrite)
-                                 .SetMaxNumConnections(16)
+                                 .SetMaxNumConnections(static_cast<uint16_t>(limits.maxConnections))
                                  .Build();
     if (err) {
         return { nullptr, errors::Wrap(err, "Failed to create RDMA Engine") };
@@ -53,14 +83,16 @@ std::tuple<RdmaExecutorPtr, error> RdmaExecutor::Create(doca::DevicePtr initialD
     auto executorConfig = Config{
         .initialRdmaEngine = rdmaEngine,
         .initialDevice = initialDevice,
+        .limits = limits,
     };
     auto rdmaExecutor = std::make_shared<RdmaExecutor>(executorConfig);
     return { rdmaExecutor, nullptr };
 }
 
 RdmaExecutor::RdmaExecutor(const Config & initialConfig)
-    : rdmaEngine(initialConfig.initialRdmaEngine), device(initialConfig.initialDevice), workerRunning(false),
-      workerThread(nullptr), rdmaContext(nullptr), progressEngine(nullptr), bufferInventory(nullptr)
+    : rdmaEngine(initialConfig.initialRdmaEngine), device(initialConfig.initialDevice), limits(initialConfig.limits),
+      workerRunning(false), workerThread(nullptr), rdmaContext(nullptr), progressEngine(nullptr),
+      bufferInventory(nullptr)
 {
 }
 
@@ -72,10 +104,23 @@ RdmaExecutor::~RdmaExecutor()
         this->workerRunning.store(false);
     }
     this->queueCondVar.notify_one();
+    this->wakeWorker();
 
-    if (this->workerThread->joinable()) {
+    if (this->workerThread && this->workerThread->joinable()) {
         this->workerThread->join();
     }
+
+    // Abandoned operations hold buffer leases, so they go before cached buffers are returned
+    this->abandonedOperations.clear();
+    if (this->workerWakeupFd >= 0) {
+        close(this->workerWakeupFd);
+        this->workerWakeupFd = -1;
+    }
+
+    // Cached buffers must be returned before inventory is destroyed
+    if (this->bufferCache != nullptr) {
+        this->bufferCache->Clear();
+    }
     DOCA_CPP_LOG_DEBUG("Executor destroyed successfully");
 }
 
@@ -264,14 +309,39 @@ error RdmaExecutor::Start()
 
     DOCA_CPP_LOG_DEBUG("Set RDMA connection state change callbacks");
 
-    // Create BufferInventory
-    auto [inventory, invErr] = doca::BufferInventory::Create(constants::initialBufferInventorySize).Start();
-    if (err) {
-        return errors::Wrap(err, "Failed to create and start buffer inventory");
+    // Create BufferInventory sized for in-flight operations of all connections
+    const auto workloadElements =
+        constants::buffersPerOperation * this->limits.maxInflightOperations * this->limits.maxConnections;
+    const auto inventoryConfig = doca::ElasticBufferInventory::Config{
+        .initialElements = workloadElements,
+        .growthElements = workloadElements,
+        .maxElements = workloadElements * constants::bufferInventoryGrowthFactor,
+    };
+    auto [inventory, invErr] = doca::ElasticBufferInventory::Create(inventoryConfig);
+    if (invErr) {
+        return errors::Wrap(invErr, "Failed to create and start buffer inventory");
     }
     this->bufferInventory = inventory;
 
-    DOCA_CPP_LOG_DEBUG("Created buffer inventory");
+    DOCA_CPP_LOG_DEBUG(std::format("Created buffer inventory with {} elements", workloadElements));
+
+    // Create cache of DOCA buffers prepared for endpoints memory; it may take whole inventory and evicts buffers when
+    // inventory can not grow anymore
+    this->bufferCache = RdmaBufferCache::Create(this->bufferInventory, inventoryConfig.maxElements);
+
+    DOCA_CPP_LOG_DEBUG("Created buffer cache");
+
+    // Create registration cache for local buffers which memory was not mapped by owner
+    auto registrationConfig = doca::MemoryRegistrationCache::Config{
+        .maxPinnedBytes = this->limits.maxRegisteredBytes,
+    };
+    auto [registrationCache, regErr] = doca::MemoryRegistrationCache::Create(this->device, registrationConfig);
+    if (regErr) {
+        return errors::Wrap(regErr, "Failed to create memory registration cache");
+    }
+    this->registrationCache = registrationCache;
+
+    DOCA_CPP_LOG_DEBUG("Created memory registration cache");
 
     // ----------------------------------------------------------------------------
 
@@ -295,6 +365,14 @@ error RdmaExecutor::Start()
 
     DOCA_CPP_LOG_DEBUG("RDMA context state is running");
 
+    // Create event file descriptor waking worker thread waiting for progress engine notification
+    if (this->workerWakeupFd < 0) {
+        this->workerWakeupFd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+        if (this->workerWakeupFd < 0) {
+            return errors::New("Failed to create worker wakeup event: " + std::string(std::strerror(errno)));
+        }
+    }
+
     // Start worker thread
     this->workerRunning.store(true);
     this->workerThread = std::make_unique<std::thread>([this] { this->workerLoop(); });
@@ -318,20 +396,43 @@ void RdmaExecutor::Stop()
         this->workerRunning.store(false);
     }
     this->queueCondVar.notify_one();
+    this->wakeWorker();
 
     DOCA_CPP_LOG_DEBUG("Stopped executor's working thread");
 
-    // Wait for worker thread to finish
+    // Wait for worker thread to finish; it fails operations in flight instead of waiting for them
     if (this->workerThread->joinable()) {
         this->workerThread->join();
     }
 
-    // Clear operation queue
+    // Fail requests left in queue, so their waiters do not hang
+    std::queue<RdmaOperationRequest> pendingRequests;
     {
         std::scoped_lock lock(this->queueMutex);
-        while (!this->operationQueue.empty()) {
-            this->operationQueue.pop();
-        }
+        pendingRequests.swap(this->operationQueue);
+    }
+    while (!pendingRequests.empty()) {
+        completeRequest(pendingRequests.front(), { nullptr, ErrorTypes::ShutDown });
+        pendingRequests.pop();
+    }
+
+    // Give cached buffers back to inventory
+    if (this->bufferCache != nullptr) {
+        this->bufferCache->Clear();
+    }
+
+    // Release registrations after buffers referencing their memory maps are returned
+    if (this->registrationCache != nullptr) {
+        [[maybe_unused]] const auto stats = this->registrationCache->GetStatistics();
+        DOCA_CPP_LOG_DEBUG(std::format("Registration cache hit rate {:.3f} ({} hits, {} misses, {} evictions)",
+                                       stats.HitRate(), stats.hits, stats.misses, stats.evictions));
+        this->registrationCache->Clear();
+    }
+
+    if (this->bufferInventory != nullptr) {
+        [[maybe_unused]] const auto stats = this->bufferInventory->GetStatistics();
+        DOCA_CPP_LOG_DEBUG(std::format("Buffer inventory capacity {}, high-water mark {}, exhausted {} times",
+                                       stats.capacity, stats.highWaterMark, stats.exhaustionCount));
     }
 
     DOCA_CPP_LOG_DEBUG("Joined executor's thread and flushed its operations queue");
@@ -394,7 +495,7 @@ error RdmaExecutor::ListenToPort(uint16_t port)
 void RdmaExecutor::OnConnectionRequested(RdmaConnectionPtr connection)
 {
     // Reject if already established
-    if (this->activeConnection != nullptr) {
+    if (this->activeConnection.load() != nullptr) {
         std::ignore = connection->Reject();
         return;
     }
@@ -414,12 +515,12 @@ void RdmaExecutor::OnConnectionRequested(RdmaConnectionPtr connection)
 void RdmaExecutor::OnConnectionEstablished(RdmaConnectionPtr connection)
 {
     // Disconnect if already established
-    if (this->activeConnection != nullptr) {
+    if (this->activeConnection.load() != nullptr) {
         std::ignore = connection->Disconnect();
         return;
     }
 
-    this->activeConnection = connection;
+    this->activeConnection.store(connection);
     this->requestedConnection = nullptr;
 
     DOCA_CPP_LOG_DEBUG(std::format("Assigned requested connection to active connection"));
@@ -427,35 +528,79 @@ void RdmaExecutor::OnConnectionEstablished(RdmaConnectionPtr connection)
 
 void RdmaExecutor::OnConnectionClosed(RdmaConnectionId connectionId)
 {
-    this->activeConnection = nullptr;
+    this->activeConnection.store(nullptr);
     DOCA_CPP_LOG_DEBUG(std::format("Removed active connection from executor"));
 }
 
 std::tuple<RdmaConnectionPtr, error> RdmaExecutor::GetActiveConnection()
 {
-    if (this->activeConnection == nullptr) {
+    auto connection = this->activeConnection.load();
+    if (connection == nullptr) {
         return { nullptr, errors::New("No active RDMA connection") };
     }
-    return { this->activeConnection, nullptr };
+    return { connection, nullptr };
 }
 
 std::tuple<RdmaConnectionPtr, error> doca::rdma::RdmaExecutor::WaitForEstablishedConnection(
     std::chrono::milliseconds waitTimeout)
 {
     const auto startTime = std::chrono::steady_clock::now();
-    while (this->activeConnection == nullptr) {
+    while (this->activeConnection.load() == nullptr) {
         if (this->timeoutExpired(startTime, waitTimeout)) {
             return { nullptr, ErrorTypes::TimeoutExpired };
         }
         std::this_thread::sleep_for(10us);
-        std::ignore = this->progressEngine->Progress();
+        this->Progress();
     }
     return this->GetActiveConnection();
 }
 
-void doca::rdma::RdmaExecutor::Progress()
+std::uint32_t doca::rdma::RdmaExecutor::Progress()
+{
+    std::uint32_t processed = 0;
+    {
+        std::lock_guard<std::mutex> lock(this->progressMutex);
+        auto [count, err] = this->progressEngine->Progress();
+        processed = err ? 0 : count;
+    }
+    this->wakeWorkerOnProgress(processed);
+    return processed;
+}
+
+std::tuple<doca_notification_handle_t, error> RdmaExecutor::GetProgressNotificationHandle() const
+{
+    if (this->progressEngine == nullptr) {
+        return { doca_notification_handle_t{}, errors::New("Progress engine is null") };
+    }
+    return this->progressEngine->GetNotificationHandle();
+}
+
+error RdmaExecutor::RequestProgressNotification()
 {
-    this->progressEngine->Progress();
+    if (this->progressEngine == nullptr) {
+        return errors::New("Progress engine is null");
+    }
+    std::uint32_t processed = 0;
+    {
+        std::lock_guard<std::mutex> lock(this->progressMutex);
+        auto err = this->progressEngine->RequestNotification();
+        if (err) {
+            return err;
+        }
+        auto [count, progressErr] = this->progressEngine->Progress();
+        processed = progressErr ? 0 : count;
+    }
+    this->wakeWorkerOnProgress(processed);
+    return nullptr;
+}
+
+error RdmaExecutor::ClearProgressNotification(doca_notification_handle_t handle)
+{
+    if (this->progressEngine == nullptr) {
+        return errors::New("Progress engine is null");
+    }
+    std::lock_guard<std::mutex> lock(this->progressMutex);
+    return this->progressEngine->ClearNotification(handle);
 }
 
 doca::DevicePtr doca::rdma::RdmaExecutor::GetDevice()
@@ -463,6 +608,22 @@ doca::DevicePtr doca::rdma::RdmaExecutor::GetDevice()
     return this->device;
 }
 
+std::tuple<doca::ElasticBufferInventory::Statistics, error> RdmaExecutor::GetBufferInventoryStatistics() const
+{
+    if (this->bufferInventory == nullptr) {
+        return { {}, errors::New("Buffer inventory is not initialized") };
+    }
+    return { this->bufferInventory->GetStatistics(), nullptr };
+}
+
+std::tuple<doca::MemoryRegistrationCache::Statistics, error> RdmaExecutor::GetRegistrationCacheStatistics() const
+{
+    if (this->registrationCache == nullptr) {
+        return { {}, errors::New("Registration cache is not initialized") };
+    }
+    return { this->registrationCache->GetStatistics(), nullptr };
+}
+
 std::tuple<RdmaAwaitable, error> RdmaExecutor::SubmitOperation(RdmaOperationRequest request)
 {
     auto operationFuture = request.responcePromise->get_future();
@@ -470,214 +631,343 @@ std::tuple<RdmaAwaitable, error> RdmaExecutor::SubmitOperation(RdmaOperationRequ
     {
         std::scoped_lock lock(this->queueMutex);
         if (!this->workerRunning) {
-            auto err = errors::New("Executor is shut down");
-            request.responcePromise->set_value({ nullptr, err });
-            return { std::move(awaitable), err };
+            request.responcePromise->set_value({ nullptr, ErrorTypes::ShutDown });
+            return { std::move(awaitable), ErrorTypes::ShutDown };
         }
         this->operationQueue.push(std::move(request));
         DOCA_CPP_LOG_DEBUG("Pushed RDMA operation to executor operations queue");
     }
     this->queueCondVar.notify_one();
+    if (this->workerWaiting.load()) {
+        this->wakeWorker();
+    }
     return { std::move(awaitable), nullptr };
 }
 
 void RdmaExecutor::workerLoop()
 {
+    // Task callbacks change state of operations in place, so list keeps their addresses while tasks are in flight
+    std::list<InflightOperation> inflight;
     while (true) {
-        // Get operation request from operations queue
-        RdmaOperationRequest request;
+        // Take as many requests as fit into in-flight limit; worker sleeps on queue only when no operation is in flight
+        std::vector<RdmaOperationRequest> requests;
         {
             std::unique_lock lock(this->queueMutex);
-            this->queueCondVar.wait(lock, [this] { return !this->workerRunning || !this->operationQueue.empty(); });
+            if (inflight.empty()) {
+                this->queueCondVar.wait(lock,
+                                        [this] { return !this->workerRunning || !this->operationQueue.empty(); });
+            }
 
-            if (!this->workerRunning && this->operationQueue.empty()) {
-                DOCA_CPP_LOG_DEBUG("Exiting worker thread");
-                return;
+            if (!this->workerRunning) {
+                break;
             }
 
-            request = std::move(this->operationQueue.front());
-            this->operationQueue.pop();
-            DOCA_CPP_LOG_DEBUG("Worker thread took operation from queue");
+            while (!this->operationQueue.empty() &&
+                   inflight.size() + requests.size() < this->limits.maxInflightOperations) {
+                requests.push_back(std::move(this->operationQueue.front()));
+                this->operationQueue.pop();
+            }
         }
-        // Execute operation from queue
-        auto responce = this->executeOperation(request);
 
-        // Set operation promise responce value
-        request.responcePromise->set_value(responce);
+        // Operations are submitted before any of them is waited for, so their transfers overlap on connection
+        for (auto & request : requests) {
+            auto & operation = inflight.emplace_back();
+            operation.request = std::move(request);
+            if (this->limits.operationTimeout != std::chrono::milliseconds::zero()) {
+                operation.deadline = std::chrono::steady_clock::now() + this->limits.operationTimeout;
+            }
+            auto err = this->startOperation(operation);
+            if (err) {
+                if (operation.task != nullptr) {
+                    operation.task->Free();
+                }
+                completeRequest(operation.request, { nullptr, err });
+                inflight.pop_back();
+            }
+        }
+        if (inflight.empty()) {
+            continue;
+        }
+
+        this->Progress();
+        this->completeOperations(inflight);
+        if (inflight.empty()) {
+            continue;
+        }
+
+        this->waitForEvents(inflight);
+        this->Progress();
+        this->expireOperations(inflight);
+        this->completeOperations(inflight);
+    }
+
+    // Executor is stopping: requests in flight fail at once, so Stop is not held by operations that never complete
+    this->failOperations(inflight, ErrorTypes::ShutDown);
 
-        DOCA_CPP_LOG_DEBUG("Worker thread executed RDMA operation");
+    // Tasks still change state of their operations on completion, so operations are kept until tasks finish
+    const auto drainStart = std::chrono::steady_clock::now();
+    while (!inflight.empty() && !this->timeoutExpired(drainStart, constants::stopDrainTimeout)) {
+        std::this_thread::sleep_for(constants::workerPollInterval);
+        this->Progress();
+        this->completeOperations(inflight);
+    }
+    if (!inflight.empty()) {
+        DOCA_CPP_LOG_WARN(std::format("Abandoned {} RDMA operations which tasks did not finish", inflight.size()));
+        this->abandonedOperations.splice(this->abandonedOperations.end(), inflight);
     }
+
+    DOCA_CPP_LOG_DEBUG("Exiting worker thread");
 }
 
-RdmaOperationResponce RdmaExecutor::executeOperation(RdmaOperationRequest & request)
+void RdmaExecutor::waitForEvents(const std::list<InflightOperation> & inflight)
 {
-    switch (request.type) {
+    // Flag is raised before last check, so completion or request coming after check wakes worker
+    this->workerWaiting.store(true);
+    auto waitingDeferred = defer::MakeDefer([this]() { this->workerWaiting.store(false); });
+
+    auto [handle, handleErr] = this->GetProgressNotificationHandle();
+    auto armErr = handleErr ? handleErr : this->RequestProgressNotification();
+    if (armErr) {
+        // Notification is not available: fall back to polling
+        std::this_thread::sleep_for(constants::workerPollInterval);
+        return;
+    }
+
+    // Arming progresses engine once more, so tasks might have finished meanwhile
+    const auto finished = std::ranges::any_of(inflight, [](const InflightOperation & operation) {
+        return operation.taskState == IRdmaTask::State::completed || operation.taskState == IRdmaTask::State::error;
+    });
+    if (finished) {
+        return;
+    }
+    {
+        std::scoped_lock lock(this->queueMutex);
+        if (!this->workerRunning ||
+            (!this->operationQueue.empty() && inflight.size() < this->limits.maxInflightOperations)) {
+            return;
+        }
+    }
+
+    // Sleep until nearest deadline of operation which request is not failed yet
+    auto deadline = std::chrono::steady_clock::time_point::max();
+    for (const auto & operation : inflight) {
+        if (!operation.requestCompleted) {
+            deadline = std::min(deadline, operation.deadline);
+        }
+    }
+    int timeoutMs = -1;
+    if (deadline != std::chrono::steady_clock::time_point::max()) {
+        const auto remaining =
+            std::chrono::ceil<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now());
+        timeoutMs = static_cast<int>(std::max<std::int64_t>(0, remaining.count()));
+    }
+
+    pollfd descriptors[] = {
+        { .fd = handle, .events = POLLIN, .revents = 0 },
+        { .fd = this->workerWakeupFd, .events = POLLIN, .revents = 0 },
+    };
+    if (poll(descriptors, std::size(descriptors), timeoutMs) <= 0) {
+        return;
+    }
+    if (descriptors[0].revents & POLLIN) {
+        std::ignore = this->ClearProgressNotification(handle);
+    }
+    if (descriptors[1].revents & POLLIN) {
+        eventfd_t wakeups = 0;
+        std::ignore = eventfd_read(this->workerWakeupFd, &wakeups);
+    }
+}
+
+void RdmaExecutor::wakeWorker()
+{
+    if (this->workerWakeupFd >= 0) {
+        std::ignore = eventfd_write(this->workerWakeupFd, 1);
+    }
+}
+
+void RdmaExecutor::wakeWorkerOnProgress(std::uint32_t processed)
+{
+    if (processed == 0 || !this->workerWaiting.load()) {
+        return;
+    }
+    // Worker progresses engine itself while arming notification and checks its operations afterwards
+    if (this->workerThread != nullptr && this->workerThread->get_id() == std::this_thread::get_id()) {
+        return;
+    }
+    this->wakeWorker();
+}
+
+error RdmaExecutor::startOperation(InflightOperation & operation)
+{
+    switch (operation.request.type) {
         case RdmaOperationType::read:
-            return this->executeRead(request);
+            return this->startRead(operation);
         case RdmaOperationType::write:
-            return this->executeWrite(request);
+            return this->startWrite(operation);
     }
-    return { nullptr, errors::New("Unknown operation type") };
+    return errors::New("Unknown operation type");
 }
 
-RdmaOperationResponce RdmaExecutor::executeRead(RdmaOperationRequest & request)
+error RdmaExecutor::startRead(InflightOperation & operation)
 {
+    const auto & request = operation.request;
+
     // Check requested buffers
     if (!request.localBuffer || !request.remoteBuffer) {
-        return { nullptr, errors::New("Invalid request; provide both local and remote RDMA buffers") };
+        return errors::New("Invalid request; provide both local and remote RDMA buffers");
     }
 
     // Check that connection is active
-    if (this->activeConnection == nullptr) {
-        return { nullptr, errors::New("No active RDMA connection available for read operation") };
+    auto connection = this->activeConnection.load();
+    if (connection == nullptr) {
+        return errors::New("No active RDMA connection available for read operation");
     }
 
-    // Initialize operation state
-    auto taskState = IRdmaTask::State::idle;
-
     // Get DOCA buffer for source RDMA buffer
     auto [srcBuf, srcBufErr] = this->getSourceRemoteBuffer(request.remoteBuffer);
     if (srcBufErr) {
-        return { nullptr, errors::Wrap(srcBufErr, "Failed to get doca buffer") };
+        return errors::Wrap(srcBufErr, "Failed to get doca buffer");
     }
 
     // Get DOCA buffer for destination RDMA buffer
-    auto [dstBuf, dstBufErr] = this->getDestinationLocalBuffer(request.localBuffer);
+    auto [dstBuf, dstRegistration, dstBufErr] = this->getDestinationLocalBuffer(request.localBuffer);
     if (dstBufErr) {
-        return { nullptr, errors::Wrap(dstBufErr, "Failed to get doca buffer") };
+        return errors::Wrap(dstBufErr, "Failed to get doca buffer");
     }
+    operation.sourceBuffer = srcBuf;
+    operation.destinationBuffer = dstBuf;
+    operation.registration = dstRegistration;
 
     DOCA_CPP_LOG_DEBUG("Worker thread got plain doca source and destination buffers");
 
-    // Create RdmaSendTask from RdmaEngine
-    // Set task user data to current transfer state: it will be changed in the task callbacks
-    auto taskUserData = doca::Data(static_cast<void *>(&taskState));
-    auto [readTask, err] = this->rdmaEngine->AllocateReadTask(this->activeConnection, srcBuf, dstBuf, taskUserData);
+    // Create RdmaReadTask from RdmaEngine
+    // Set task user data to operation state: it will be changed in the task callbacks
+    auto taskUserData = doca::Data(static_cast<void *>(&operation.taskState));
+    auto [readTask, err] = this->rdmaEngine->AllocateReadTask(connection, srcBuf->GetBuffer(), dstBuf->GetBuffer(),
+                                                                 taskUserData);
     if (err) {
-        return { nullptr, errors::Wrap(err, "Failed to allocate RDMA read task") };
+        return errors::Wrap(err, "Failed to allocate RDMA read task");
     }
+    operation.task = readTask;
 
     DOCA_CPP_LOG_DEBUG("Worker thread allocated read task");
 
-    // Submit RdmaSendTask to RdmaEngine
-    taskState = IRdmaTask::State::submitted;
+    // Submit RdmaReadTask to RdmaEngine
+    operation.taskState = IRdmaTask::State::submitted;
     err = readTask->Submit();
     if (err) {
-        return { nullptr, errors::Wrap(err, "Failed to submit RDMA read task") };
+        return errors::Wrap(err, "Failed to submit RDMA read task");
     }
 
     DOCA_CPP_LOG_DEBUG("Worker thread submitted read task");
 
-    DOCA_CPP_LOG_DEBUG("Worker thread is waiting for task to complete...");
-
-    // Wait for task completion
-    // const auto waitTimeout = 5000ms;
-    err = this->waitForTaskState(IRdmaTask::State::completed, taskState /*,  waitTimeout */);
-    if (err) {
-        if (errors::Is(err, ErrorTypes::TimeoutExpired)) {
-            return { nullptr, errors::Wrap(err, "Failed to wait for RDMA read task completion due to timeout") };
-        }
-        return { nullptr, errors::Wrap(err, "Failed to wait for RDMA read task completion") };
-    }
-
-    DOCA_CPP_LOG_DEBUG("Worker thread completed read task");
-
-    // Free RdmaSendTask
-    readTask->Free();
-
-    // Decrement buffers references count in BufferInventory
-    auto [_, srcRcErr] = srcBuf->DecRefcount();
-    if (srcRcErr) {
-        return { nullptr, errors::Wrap(srcRcErr, "Failed to decrement buffer reference count in buffer inventory") };
-    }
-    auto [__, dstRcErr] = dstBuf->DecRefcount();
-    if (dstRcErr) {
-        return { nullptr, errors::Wrap(dstRcErr, "Failed to decrement buffer reference count in buffer inventory") };
-    }
-
-    DOCA_CPP_LOG_DEBUG("Worker thread decreased plain doca source and destination buffers reference counts");
-
-    return { request.localBuffer, nullptr };
+    return nullptr;
 }
 
-RdmaOperationResponce RdmaExecutor::executeWrite(RdmaOperationRequest & request)
+error RdmaExecutor::startWrite(InflightOperation & operation)
 {
+    const auto & request = operation.request;
+
     // Check requested buffers
     if (!request.localBuffer || !request.remoteBuffer) {
-        return { nullptr, errors::New("Invalid request; provide both local and remote RDMA buffers") };
+        return errors::New("Invalid request; provide both local and remote RDMA buffers");
     }
 
     // Check that connection is active
-    if (this->activeConnection == nullptr) {
-        return { nullptr, errors::New("No active RDMA connection available for write operation") };
+    auto connection = this->activeConnection.load();
+    if (connection == nullptr) {
+        return errors::New("No active RDMA connection available for write operation");
     }
 
-    // Initialize operation state
-    auto taskState = IRdmaTask::State::idle;
-
     // Get DOCA buffer for source RDMA buffer
-    auto [srcBuf, srcBufErr] = this->getSourceLocalBuffer(request.localBuffer);
+    auto [srcBuf, srcRegistration, srcBufErr] = this->getSourceLocalBuffer(request.localBuffer);
     if (srcBufErr) {
-        return { nullptr, errors::Wrap(srcBufErr, "Failed to get doca buffer") };
+        return errors::Wrap(srcBufErr, "Failed to get doca buffer");
     }
 
     // Get DOCA buffer for destination RDMA buffer
     auto [dstBuf, dstBufErr] = this->getDestinationRemoteBuffer(request.remoteBuffer);
     if (dstBufErr) {
-        return { nullptr, errors::Wrap(dstBufErr, "Failed to get doca buffer") };
+        return errors::Wrap(dstBufErr, "Failed to get doca buffer");
     }
+    operation.sourceBuffer = srcBuf;
+    operation.destinationBuffer = dstBuf;
+    operation.registration = srcRegistration;
 
     DOCA_CPP_LOG_DEBUG("Worker thread got plain doca source and destination buffers");
 
     // Create task from RdmaEngine
-    // Set task user data to current transfer state: it will be changed in the task callbacks
-    auto taskUserData = doca::Data(static_cast<void *>(&taskState));
-    auto [writeTask, err] = this->rdmaEngine->AllocateWriteTask(this->activeConnection, srcBuf, dstBuf, taskUserData);
+    // Set task user data to operation state: it will be changed in the task callbacks
+    auto taskUserData = doca::Data(static_cast<void *>(&operation.taskState));
+    auto [writeTask, err] = this->rdmaEngine->AllocateWriteTask(connection, srcBuf->GetBuffer(), dstBuf->GetBuffer(),
+                                                                   taskUserData);
     if (err) {
-        return { nullptr, errors::Wrap(err, "Failed to allocate RDMA write task") };
+        return errors::Wrap(err, "Failed to allocate RDMA write task");
     }
+    operation.task = writeTask;
 
     DOCA_CPP_LOG_DEBUG("Worker thread allocated write task");
 
     // Submit task to RdmaEngine
-    taskState = IRdmaTask::State::submitted;
+    operation.taskState = IRdmaTask::State::submitted;
     err = writeTask->Submit();
     if (err) {
-        return { nullptr, errors::Wrap(err, "Failed to submit RDMA write task") };
+        return errors::Wrap(err, "Failed to submit RDMA write task");
     }
 
     DOCA_CPP_LOG_DEBUG("Worker thread submitted write task");
 
-    DOCA_CPP_LOG_DEBUG("Worker thread is waiting for task to complete...");
+    return nullptr;
+}
 
-    // Wait for task completion
-    // const auto waitTimeout = 5000ms;
-    err = this->waitForTaskState(IRdmaTask::State::completed, taskState /*,  waitTimeout */);
-    if (err) {
-        if (errors::Is(err, ErrorTypes::TimeoutExpired)) {
-            return { nullptr, errors::Wrap(err, "Failed to wait for RDMA write task completion due to timeout") };
+void RdmaExecutor::completeOperations(std::list<InflightOperation> & inflight)
+{
+    for (auto it = inflight.begin(); it != inflight.end();) {
+        const auto taskState = it->taskState;
+        if (taskState != IRdmaTask::State::completed && taskState != IRdmaTask::State::error) {
+            ++it;
+            continue;
         }
-        return { nullptr, errors::Wrap(err, "Failed to wait for RDMA write task completion") };
-    }
 
-    DOCA_CPP_LOG_DEBUG("Worker thread completed write task");
+        it->task->Free();
+        if (it->requestCompleted) {
+            // Request already failed by timeout or stop
+        } else if (taskState == IRdmaTask::State::error) {
+            completeRequest(it->request, { nullptr, errors::New("Task completed with error") });
+        } else {
+            completeRequest(it->request, { it->request.localBuffer, nullptr });
+        }
 
-    // Free RdmaSendTask
-    writeTask->Free();
+        DOCA_CPP_LOG_DEBUG("Worker thread completed RDMA operation");
 
-    // Decrement buffers references count in BufferInventory
-    auto [_, srcRcErr] = srcBuf->DecRefcount();
-    if (srcRcErr) {
-        return { nullptr, errors::Wrap(srcRcErr, "Failed to decrement buffer reference count in buffer inventory") };
-    }
-    auto [__, dstRcErr] = dstBuf->DecRefcount();
-    if (dstRcErr) {
-        return { nullptr, errors::Wrap(dstRcErr, "Failed to decrement buffer reference count in buffer inventory") };
+        // Buffer and registration leases are released together with operation
+        it = inflight.erase(it);
     }
+}
 
-    DOCA_CPP_LOG_DEBUG("Worker thread decreased plain doca source and destination buffers reference counts");
+void RdmaExecutor::expireOperations(std::list<InflightOperation> & inflight)
+{
+    const auto now = std::chrono::steady_clock::now();
+    for (auto & operation : inflight) {
+        if (operation.requestCompleted || now < operation.deadline) {
+            continue;
+        }
+        // Task is still in flight: operation stays in list until task finishes, only its request fails
+        DOCA_CPP_LOG_WARN("RDMA operation deadline expired");
+        auto err = errors::Wrap(ErrorTypes::TimeoutExpired, "RDMA operation did not complete in time");
+        completeRequest(operation.request, { nullptr, err });
+        operation.requestCompleted = true;
+    }
+}
 
-    return { request.localBuffer, nullptr };
+void RdmaExecutor::failOperations(std::list<InflightOperation> & inflight, error err)
+{
+    for (auto & operation : inflight) {
+        if (!operation.requestCompleted) {
+            completeRequest(operation.request, { nullptr, err });
+            operation.requestCompleted = true;
+        }
+    }
 }
 
 error RdmaExecutor::waitForContextState(doca::Context::State desiredState, std::chrono::milliseconds waitTimeout) const
@@ -708,8 +998,8 @@ error RdmaExecutor::waitForContextState(doca::Context::State desiredState, std::
     return nullptr;
 }
 
-error RdmaExecutor::waitForTaskState(IRdmaTask::State desiredState, IRdmaTask::State & changingState,
-                                     std::chrono::milliseconds waitTimeout)
+error RdmaExecutor::waitForConnectionState(RdmaConnection::State desiredState, RdmaConnection::State & changingState,
+                                           std::chrono::milliseconds waitTimeout)
 {
     if (this->progressEngine == nullptr) {
         return errors::New("Progress engine is null");
@@ -721,92 +1011,92 @@ error RdmaExecutor::waitForTaskState(IRdmaTask::State desiredState, IRdmaTask::S
             return ErrorTypes::TimeoutExpired;
         }
         std::this_thread::sleep_for(10us);
-        this->progressEngine->Progress();
-
-        if (changingState == IRdmaTask::State::error) {
-            return errors::New("Task completed with error");
-        }
+        this->Progress();
     }
 
     return nullptr;
 }
 
-error RdmaExecutor::waitForConnectionState(RdmaConnection::State desiredState, RdmaConnection::State & changingState,
-                                           std::chrono::milliseconds waitTimeout)
+std::tuple<doca::MemoryMapPtr, doca::MemoryRegistrationPtr, error> RdmaExecutor::getLocalMemoryMap(
+    RdmaBufferPtr rdmaBuffer, doca::MemoryRangeHandle memoryRange)
 {
-    if (this->progressEngine == nullptr) {
-        return errors::New("Progress engine is null");
-    }
-
-    const auto startTime = std::chrono::steady_clock::now();
-    while (changingState != desiredState) {
-        if (this->timeoutExpired(startTime, waitTimeout)) {
-            return ErrorTypes::TimeoutExpired;
-        }
-        std::this_thread::sleep_for(10us);
-        this->progressEngine->Progress();
-    }
-
-    return nullptr;
+    if (rdmaBuffer->IsMapped()) {
+        auto [memoryMap, mapErr] = rdmaBuffer->GetMemoryMap();
+        return { memoryMap, nullptr, mapErr };
+    }
+
+    // Buffer is not mapped: lease registration covering its memory; lease is held until operation completes
+    const auto permissions =
+        rdmaBuffer->IsReadOnly() ? doca::AccessFlags::localReadOnly : doca::AccessFlags::localReadWrite;
+    // Registration is tied to buffer's allocation, so it is not reused for other memory at the same address once
+    // transient buffer is freed
+    auto [registration, regErr] =
+        this->registrationCache->Acquire(memoryRange, permissions, rdmaBuffer->GetMemoryAllocation());
+    if (regErr) {
+        return { nullptr, nullptr, errors::Wrap(regErr, "Failed to acquire memory registration") };
+    }
+    return { registration->GetMemoryMap(), registration, nullptr };
 }
 
-std::tuple<doca::BufferPtr, error> RdmaExecutor::getSourceLocalBuffer(RdmaBufferPtr rdmaBuffer)
+std::tuple<RdmaBufferLeasePtr, doca::MemoryRegistrationPtr, error> RdmaExecutor::getSourceLocalBuffer(
+    RdmaBufferPtr rdmaBuffer)
 {
     if (rdmaBuffer == nullptr) {
-        return { nullptr, errors::New("RDMA buffer is null") };
+        return { nullptr, nullptr, errors::New("RDMA buffer is null") };
     }
 
     // Get buffer memory range
-    auto [memoryRange, err] = rdmaBuffer->GetMemoryRange();
+    auto [memoryRange, err] = rdmaBuffer->GetMemorySpan();
     if (err) {
-        return { nullptr, errors::Wrap(err, "Failed to get buffer memory range") };
+        return { nullptr, nullptr, errors::Wrap(err, "Failed to get buffer memory range") };
     }
 
-    // Get MemoryMap from buffer
-    auto [memoryMap, mapErr] = rdmaBuffer->GetMemoryMap();
+    // Get MemoryMap from buffer or from registration cache if buffer is not mapped
+    auto [memoryMap, registration, mapErr] = this->getLocalMemoryMap(rdmaBuffer, memoryRange);
     if (mapErr) {
-        return { nullptr, errors::Wrap(mapErr, "Failed to get memory map from buffer") };
+        return { nullptr, nullptr, errors::Wrap(mapErr, "Failed to get memory map for buffer") };
     }
 
-    // Get doca::Buffer from BufferInventory
-    auto [buffer, bufErr] = this->bufferInventory->AllocBufferByData(
-        memoryMap, static_cast<void *>(memoryRange->data()), memoryRange->size());
+    // Lease prepared doca::Buffer from cache
+    const auto direction = RdmaBufferCache::Direction::source;
+    auto [buffer, bufErr] = this->bufferCache->GetBuffer(memoryMap, memoryRange, direction);
     if (bufErr) {
-        return { nullptr, errors::Wrap(bufErr, "Failed to allocate buffer from buffer inventory") };
+        return { nullptr, nullptr, errors::Wrap(bufErr, "Failed to get buffer from buffer cache") };
     }
 
-    return { buffer, nullptr };
+    return { buffer, registration, nullptr };
 }
 
-std::tuple<doca::BufferPtr, error> RdmaExecutor::getDestinationLocalBuffer(RdmaBufferPtr rdmaBuffer)
+std::tuple<RdmaBufferLeasePtr, doca::MemoryRegistrationPtr, error> RdmaExecutor::getDestinationLocalBuffer(
+    RdmaBufferPtr rdmaBuffer)
 {
     if (rdmaBuffer == nullptr) {
-        return { nullptr, errors::New("RDMA buffer is null") };
+        return { nullptr, nullptr, errors::New("RDMA buffer is null") };
     }
 
     // Get buffer memory range
-    auto [memoryRange, err] = rdmaBuffer->GetMemoryRange();
+    auto [memoryRange, err] = rdmaBuffer->GetMemorySpan();
     if (err) {
-        return { nullptr, errors::Wrap(err, "Failed to get buffer memory range") };
+        return { nullptr, nullptr, errors::Wrap(err, "Failed to get buffer memory range") };
     }
 
-    // Get MemoryMap from buffer
-    auto [memoryMap, mapErr] = rdmaBuffer->GetMemoryMap();
+    // Get MemoryMap from buffer or from registration cache if buffer is not mapped
+    auto [memoryMap, registration, mapErr] = this->getLocalMemoryMap(rdmaBuffer, memoryRange);
     if (mapErr) {
-        return { nullptr, errors::Wrap(mapErr, "Failed to get memory map from buffer") };
+        return { nullptr, nullptr, errors::Wrap(mapErr, "Failed to get memory map for buffer") };
     }
 
-    // Get doca::Buffer from BufferInventory
-    auto [buffer, bufErr] = this->bufferInventory->AllocBufferByAddress(
-        memoryMap, static_cast<void *>(memoryRange->data()), memoryRange->size());
+    // Lease prepared doca::Buffer from cache
+    const auto direction = RdmaBufferCache::Direction::destination;
+    auto [buffer, bufErr] = this->bufferCache->GetBuffer(memoryMap, memoryRange, direction);
     if (bufErr) {
-        return { nullptr, errors::Wrap(bufErr, "Failed to allocate buffer from buffer inventory") };
+        return { nullptr, nullptr, errors::Wrap(bufErr, "Failed to get buffer from buffer cache") };
     }
 
-    return { buffer, nullptr };
+    return { buffer, registration, nullptr };
 }
 
-std::tuple<doca::BufferPtr, error> RdmaExecutor::getSourceRemoteBuffer(RdmaRemoteBufferPtr rdmaBuffer)
+std::tuple<RdmaBufferLeasePtr, error> RdmaExecutor::getSourceRemoteBuffer(RdmaRemoteBufferPtr rdmaBuffer)
 {
     if (rdmaBuffer == nullptr) {
         return { nullptr, errors::New("Remote RDMA buffer is null") };
@@ -824,17 +1114,16 @@ std::tuple<doca::BufferPtr, error> RdmaExecutor::getSourceRemoteBuffer(RdmaRemot
         return { nullptr, errors::Wrap(mapErr, "Failed to get memory map from buffer") };
     }
 
-    // Get doca::Buffer from BufferInventory
-    auto [buffer, bufErr] = this->bufferInventory->AllocBufferByData(
-        memoryMap, static_cast<void *>(memoryRange->data()), memoryRange->size());
+    // Lease prepared doca::Buffer from cache
+    auto [buffer, bufErr] = this->bufferCache->GetBuffer(memoryMap, *memoryRange, RdmaBufferCache::Direction::source);
     if (bufErr) {
-        return { nullptr, errors::Wrap(bufErr, "Failed to allocate buffer from buffer inventory") };
+        return { nullptr, errors::Wrap(bufErr, "Failed to get buffer from buffer cache") };
     }
 
     return { buffer, nullptr };
 }
 
-std::tuple<doca::BufferPtr, error> RdmaExecutor::getDestinationRemoteBuffer(RdmaRemoteBufferPtr rdmaBuffer)
+std::tuple<RdmaBufferLeasePtr, error> RdmaExecutor::getDestinationRemoteBuffer(RdmaRemoteBufferPtr rdmaBuffer)
 {
     if (rdmaBuffer == nullptr) {
         return { nullptr, errors::New("Remote RDMA buffer is null") };
@@ -852,11 +1141,11 @@ std::tuple<doca::BufferPtr, error> RdmaExecutor::getDestinationRemoteBuffer(Rdma
         return { nullptr, errors::Wrap(mapErr, "Failed to get memory map from buffer") };
     }
 
-    // Get doca::Buffer from BufferInventory
-    auto [buffer, bufErr] = this->bufferInventory->AllocBufferByAddress(
-        memoryMap, static_cast<void *>(memoryRange->data()), memoryRange->size());
+    // Lease prepared doca::Buffer from cache
+    auto [buffer, bufErr] =
+        this->bufferCache->GetBuffer(memoryMap, *memoryRange, RdmaBufferCache::Direction::destination);
     if (bufErr) {
-        return { nullptr, errors::Wrap(bufErr, "Failed to allocate buffer from buffer inventory") };
+        return { nullptr, errors::Wrap(bufErr, "Failed to get buffer from buffer cache") };
     }
 
     return { buffer, nullptr };
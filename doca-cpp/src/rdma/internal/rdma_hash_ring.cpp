@@ -0,0 +1,94 @@
+#include "doca-cpp/rdma/internal/rdma_hash_ring.hpp"
+
+using doca::rdma::RdmaHashRing;
+using doca::rdma::RdmaHashRingPtr;
+
+namespace
+{
+
+/// @brief Hashes key onto ring by 64-bit FNV-1a
+std::uint64_t hashKey(std::string_view key)
+{
+    std::uint64_t value = 14695981039346656037ULL;
+    for (const auto symbol : key) {
+        value ^= static_cast<std::uint8_t>(symbol);
+        value *= 1099511628211ULL;
+    }
+
+    // Keys of one server differ only in last symbols; final mixing spreads their points over whole ring
+    value ^= value >> 33;
+    value *= 0xff51afd7ed558ccdULL;
+    value ^= value >> 33;
+    value *= 0xc4ceb9fe1a85ec53ULL;
+    value ^= value >> 33;
+    return value;
+}
+
+/// @brief Gets key of server's point on ring
+std::string pointKey(const std::string & serverId, std::size_t pointIndex)
+{
+    return std::format("{}#{}", serverId, pointIndex);
+}
+
+}  // namespace
+
+RdmaHashRingPtr RdmaHashRing::Create(std::size_t virtualNodes)
+{
+    return std::make_shared<RdmaHashRing>(virtualNodes);
+}
+
+RdmaHashRing::RdmaHashRing(std::size_t virtualNodes) : virtualNodes(virtualNodes == 0 ? 1 : virtualNodes) {}
+
+error RdmaHashRing::AddServer(const std::string & serverId)
+{
+    if (!this->servers.insert(serverId).second) {
+        return errors::New("Server " + serverId + " is already on hash ring");
+    }
+
+    // Colliding point keeps server that took it first
+    for (std::size_t pointIndex = 0; pointIndex < this->virtualNodes; pointIndex++) {
+        this->points.emplace(hashKey(pointKey(serverId, pointIndex)), serverId);
+    }
+    return nullptr;
+}
+
+error RdmaHashRing::RemoveServer(const std::string & serverId)
+{
+    if (this->servers.erase(serverId) == 0) {
+        return errors::New("Server " + serverId + " is not on hash ring");
+    }
+
+    std::erase_if(this->points, [&serverId](const auto & point) { return point.second == serverId; });
+
+    // Points lost by removed server to colliding hashes are taken back by remaining servers
+    for (const auto & server : this->servers) {
+        for (std::size_t pointIndex = 0; pointIndex < this->virtualNodes; pointIndex++) {
+            this->points.emplace(hashKey(pointKey(server, pointIndex)), server);
+        }
+    }
+    return nullptr;
+}
+
+std::vector<std::string> RdmaHashRing::ListServers() const
+{
+    return std::vector<std::string>(this->servers.begin(), this->servers.end());
+}
+
+bool RdmaHashRing::Empty() const
+{
+    return this->servers.empty();
+}
+
+std::tuple<std::string, error> RdmaHashRing::GetServer(std::string_view key) const
+{
+    if (this->points.empty()) {
+        return { "", errors::New("Hash ring has no servers") };
+    }
+
+    // Key belongs to first point after its hash; ring wraps around to first point
+    auto point = this->points.lower_bound(hashKey(key));
+    if (point == this->points.end()) {
+        point = this->points.begin();
+    }
+    return { point->second, nullptr };
+}
@@ -0,0 +1,115 @@
+#include "doca-cpp/rdma/internal/rdma_remote_buffer_cache.hpp"
+
+#include "doca-cpp/logging/logging.hpp"
+
+#ifdef DOCA_CPP_ENABLE_LOGGING
+namespace
+{
+inline const auto loggerConfig = doca::logging::GetDefaultLoggerConfig();
+inline const auto loggerContext = kvalog::Logger::Context{
+    .appName = "doca-cpp",
+    .moduleName = "remote-buffer-cache",
+};
+}  // namespace
+DOCA_CPP_DEFINE_LOGGER(loggerConfig, loggerContext)
+#endif
+
+using doca::rdma::RdmaEndpointId;
+using doca::rdma::RdmaRemoteBuffer;
+using doca::rdma::RdmaRemoteBufferCache;
+using doca::rdma::RdmaRemoteBufferCachePtr;
+using doca::rdma::RdmaRemoteBufferPtr;
+
+RdmaRemoteBufferCachePtr RdmaRemoteBufferCache::Create()
+{
+    return std::make_shared<RdmaRemoteBufferCache>();
+}
+
+std::tuple<RdmaRemoteBufferPtr, error> RdmaRemoteBufferCache::GetOrImport(const RdmaEndpointId & endpointId,
+                                                                          std::uint64_t generation,
+                                                                          std::uint64_t offset, std::uint64_t length,
+                                                                          const std::vector<std::uint8_t> & descriptor,
+                                                                          doca::DevicePtr device)
+{
+    std::lock_guard<std::mutex> lock(this->cacheMutex);
+
+    // Cache hit: server memory was not remapped and endpoint buffer was not moved since it was imported
+    if (auto found = this->entries.find(endpointId); found != this->entries.end()) {
+        const auto & entry = found->second;
+        if (generation != 0 && entry.generation == generation && entry.offset == offset && entry.length == length) {
+            DOCA_CPP_LOG_DEBUG(std::format("Reused remote buffer of endpoint {}", endpointId));
+            return { entry.buffer, nullptr };
+        }
+        // Stale entry: its remote memory map is released with it unless other endpoints still share it
+        this->entries.erase(found);
+    }
+
+    // Cache miss: address endpoint buffer within remote memory imported from descriptor
+    auto [memoryMap, mapErr] = this->getOrImportMemoryMap(generation, descriptor, device);
+    if (mapErr) {
+        return { nullptr, errors::Wrap(mapErr, "Failed to import remote memory from descriptor") };
+    }
+
+    auto [remoteBuffer, err] = RdmaRemoteBuffer::FromRemoteMemoryMap(memoryMap, offset, length);
+    if (err) {
+        return { nullptr, errors::Wrap(err, "Failed to create remote buffer from remote memory") };
+    }
+
+    if (generation != 0) {
+        this->entries.insert_or_assign(endpointId, Entry{
+                                                       .generation = generation,
+                                                       .offset = offset,
+                                                       .length = length,
+                                                       .buffer = remoteBuffer,
+                                                   });
+        DOCA_CPP_LOG_DEBUG(std::format("Cached remote buffer of endpoint {}", endpointId));
+    }
+
+    return { remoteBuffer, nullptr };
+}
+
+void RdmaRemoteBufferCache::Invalidate(const RdmaEndpointId & endpointId)
+{
+    std::lock_guard<std::mutex> lock(this->cacheMutex);
+    this->entries.erase(endpointId);
+}
+
+void RdmaRemoteBufferCache::Clear()
+{
+    std::lock_guard<std::mutex> lock(this->cacheMutex);
+    this->entries.clear();
+    this->memoryMaps.clear();
+}
+
+std::size_t RdmaRemoteBufferCache::Size() const
+{
+    std::lock_guard<std::mutex> lock(this->cacheMutex);
+    return this->entries.size();
+}
+
+std::tuple<doca::RemoteMemoryMapPtr, error> RdmaRemoteBufferCache::getOrImportMemoryMap(
+    std::uint64_t generation, const std::vector<std::uint8_t> & descriptor, doca::DevicePtr device)
+{
+    // Forget maps released together with their last buffer
+    std::erase_if(this->memoryMaps, [](const auto & item) { return item.second.expired(); });
+
+    if (generation != 0) {
+        if (auto found = this->memoryMaps.find(generation); found != this->memoryMaps.end()) {
+            if (auto memoryMap = found->second.lock()) {
+                DOCA_CPP_LOG_DEBUG(std::format("Reused remote memory of descriptor generation {}", generation));
+                return { memoryMap, nullptr };
+            }
+        }
+    }
+
+    auto [memoryMap, err] = doca::RemoteMemoryMap::CreateFromExport(descriptor, device);
+    if (err) {
+        return { nullptr, err };
+    }
+
+    if (generation != 0) {
+        this->memoryMaps.insert_or_assign(generation, memoryMap);
+    }
+
+    return { memoryMap, nullptr };
+}
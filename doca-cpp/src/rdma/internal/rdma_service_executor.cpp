@@ -0,0 +1,259 @@
+#include "doca-cpp/rdma/internal/rdma_service_executor.hpp"
+
+using doca::rdma::RdmaServiceExecutor;
+using doca::rdma::RdmaServiceExecutorPtr;
+
+namespace
+{
+
+/// @brief Runs synchronous service handler; exception thrown by service is returned as error, since handler runs on
+/// service thread with nobody to catch it
+template <typename Handler>
+error runHandler(Handler && handler)
+{
+    try {
+        return handler();
+    } catch (const std::exception & exception) {
+        return errors::New("RDMA service threw exception: " + std::string(exception.what()));
+    } catch (...) {
+        return errors::New("RDMA service threw exception");
+    }
+}
+
+/// @brief Result of handler awaited by session; touched only on session executor
+struct HandlerCompletion {
+    explicit HandlerCompletion(asio::any_io_executor executor)
+        : timer(executor, asio::steady_timer::time_point::max())
+    {
+    }
+
+    asio::steady_timer timer;
+    error err = nullptr;
+    bool done = false;
+};
+
+}  // namespace
+
+std::tuple<RdmaServiceExecutorPtr, error> RdmaServiceExecutor::Create(const Config & config)
+{
+    if (config.maxQueuedHandlers == 0) {
+        return { nullptr, errors::New("Service queue must hold at least one handler") };
+    }
+    if (config.maxBatchSize == 0) {
+        return { nullptr, errors::New("Service batch must hold at least one buffer") };
+    }
+    const auto numThreads =
+        config.numThreads != 0 ? config.numThreads : std::max<std::size_t>(1, std::thread::hardware_concurrency());
+    return { std::make_shared<RdmaServiceExecutor>(config, numThreads), nullptr };
+}
+
+RdmaServiceExecutor::RdmaServiceExecutor(const Config & config, std::size_t numThreads)
+    : config(config), workers(numThreads)
+{
+}
+
+RdmaServiceExecutor::~RdmaServiceExecutor()
+{
+    this->Stop();
+}
+
+void RdmaServiceExecutor::Stop()
+{
+    this->workers.join();
+}
+
+asio::awaitable<error> RdmaServiceExecutor::Run(RdmaEndpointPtr endpoint, RdmaBufferPtr buffer)
+{
+    // Asynchronous service does not block, so it is awaited right on caller's executor
+    auto asyncService = std::dynamic_pointer_cast<IRdmaAsyncService>(endpoint->Service());
+    if (asyncService != nullptr) {
+        co_await this->acquireQueueSlot();
+        error err = nullptr;
+        try {
+            err = co_await asyncService->HandleAsync(buffer);
+        } catch (...) {
+            err = errors::New("Asynchronous RDMA service threw exception");
+        }
+        this->releaseQueueSlots(1);
+        co_return err;
+    }
+
+    auto executor = co_await asio::this_coro::executor;
+    auto completion = std::make_shared<HandlerCompletion>(executor);
+
+    // Result is handed back on caller's executor, so completion is never touched by two threads. Caller waits for
+    // result, so its buffer is not held back for batch window
+    auto onComplete = [executor, completion](error handlerErr) {
+        asio::post(executor, [completion, handlerErr]() {
+            completion->err = handlerErr;
+            completion->done = true;
+            completion->timer.cancel();
+        });
+    };
+    auto err = co_await this->submitHandler(endpoint, buffer, std::move(onComplete), false);
+    if (err) {
+        co_return err;
+    }
+
+    if (!completion->done) {
+        std::ignore = co_await completion->timer.async_wait(asio::as_tuple(asio::use_awaitable));
+    }
+    co_return completion->err;
+}
+
+asio::awaitable<error> RdmaServiceExecutor::Submit(RdmaEndpointPtr endpoint, RdmaBufferPtr buffer,
+                                                   CompletionCallback onComplete)
+{
+    co_return co_await this->submitHandler(endpoint, buffer, std::move(onComplete), true);
+}
+
+asio::awaitable<error> RdmaServiceExecutor::submitHandler(RdmaEndpointPtr endpoint, RdmaBufferPtr buffer,
+                                                          CompletionCallback onComplete, bool allowBatch)
+{
+    auto service = endpoint->Service();
+    if (service == nullptr) {
+        co_return errors::New("No service registered for endpoint " + doca::rdma::MakeEndpointId(endpoint));
+    }
+
+    co_await this->acquireQueueSlot();
+
+    auto asyncService = std::dynamic_pointer_cast<IRdmaAsyncService>(service);
+    if (asyncService != nullptr) {
+        asio::co_spawn(co_await asio::this_coro::executor, asyncService->HandleAsync(buffer),
+                       [this, onComplete = std::move(onComplete)](std::exception_ptr exception, error err) {
+                           if (exception) {
+                               err = errors::New("Asynchronous RDMA service threw exception");
+                           }
+                           this->releaseQueueSlots(1);
+                           if (onComplete) {
+                               onComplete(err);
+                           }
+                       });
+        co_return nullptr;
+    }
+
+    if (allowBatch && this->config.maxBatchSize > 1) {
+        this->addToBatch(endpoint, buffer, std::move(onComplete));
+        co_return nullptr;
+    }
+
+    asio::post(this->endpointExecutor(endpoint),
+               [this, service, buffer, onComplete = std::move(onComplete)]() {
+                   auto err = runHandler([&service, &buffer]() { return service->Handle(buffer); });
+                   this->releaseQueueSlots(1);
+                   if (onComplete) {
+                       onComplete(err);
+                   }
+               });
+    co_return nullptr;
+}
+
+asio::awaitable<void> RdmaServiceExecutor::acquireQueueSlot()
+{
+    // Caller waits for room in queue, so handlers falling behind slow down clients instead of piling up
+    auto executor = co_await asio::this_coro::executor;
+    auto waiter = QueueSlotWaiterPtr();
+    {
+        std::lock_guard<std::mutex> lock(this->queueMutex);
+        if (this->slotWaiters.empty() && this->queuedHandlers < this->config.maxQueuedHandlers) {
+            this->queuedHandlers++;
+        } else {
+            waiter = std::make_shared<QueueSlotWaiter>(executor);
+            this->slotWaiters.push_back(waiter);
+        }
+    }
+    if (waiter == nullptr) {
+        co_return;
+    }
+
+    // Place is handed over on waiter's executor, so it is not granted before wait starts
+    while (!waiter->granted) {
+        std::ignore = co_await waiter->timer.async_wait(asio::as_tuple(asio::use_awaitable));
+    }
+}
+
+void RdmaServiceExecutor::releaseQueueSlots(std::size_t count)
+{
+    std::vector<QueueSlotWaiterPtr> granted;
+    {
+        std::lock_guard<std::mutex> lock(this->queueMutex);
+        // Place of finished handler goes straight to first waiter, so counter stays the same
+        while (count > 0 && !this->slotWaiters.empty()) {
+            granted.push_back(std::move(this->slotWaiters.front()));
+            this->slotWaiters.pop_front();
+            count--;
+        }
+        this->queuedHandlers -= count;
+    }
+    for (auto & waiter : granted) {
+        asio::post(waiter->executor, [waiter]() {
+            waiter->granted = true;
+            waiter->timer.cancel();
+        });
+    }
+}
+
+void RdmaServiceExecutor::addToBatch(RdmaEndpointPtr endpoint, RdmaBufferPtr buffer, CompletionCallback onComplete)
+{
+    const auto endpointId = doca::rdma::MakeEndpointId(endpoint);
+
+    std::lock_guard<std::mutex> lock(this->batchesMutex);
+    auto found = this->pendingBatches.find(endpointId);
+    if (found == this->pendingBatches.end()) {
+        auto batch = std::make_shared<PendingBatch>(this->workers.get_executor());
+        batch->endpoint = endpoint;
+        batch->buffers.reserve(this->config.maxBatchSize);
+        batch->callbacks.reserve(this->config.maxBatchSize);
+
+        // Batch not filled within window is handled with buffers it has. Timer is not cancelled when batch fills up,
+        // it finds batch already dispatched instead
+        batch->timer.expires_after(this->config.batchWindow);
+        batch->timer.async_wait([this, endpointId, batch](const asio::error_code &) {
+            std::lock_guard<std::mutex> timerLock(this->batchesMutex);
+            auto pending = this->pendingBatches.find(endpointId);
+            if (pending == this->pendingBatches.end() || pending->second != batch) {
+                return;
+            }
+            this->pendingBatches.erase(pending);
+            this->dispatchBatch(batch);
+        });
+
+        found = this->pendingBatches.emplace(endpointId, batch).first;
+    }
+
+    auto batch = found->second;
+    batch->buffers.push_back(std::move(buffer));
+    batch->callbacks.push_back(std::move(onComplete));
+    if (batch->buffers.size() >= this->config.maxBatchSize) {
+        this->pendingBatches.erase(found);
+        this->dispatchBatch(batch);
+    }
+}
+
+void RdmaServiceExecutor::dispatchBatch(PendingBatchPtr batch)
+{
+    asio::post(this->endpointExecutor(batch->endpoint), [this, batch]() {
+        auto err = runHandler([&batch]() { return batch->endpoint->Service()->HandleBatch(batch->buffers); });
+        this->releaseQueueSlots(batch->buffers.size());
+        for (auto & onComplete : batch->callbacks) {
+            if (onComplete) {
+                onComplete(err);
+            }
+        }
+    });
+}
+
+asio::any_io_executor RdmaServiceExecutor::endpointExecutor(const RdmaEndpointPtr & endpoint)
+{
+    if (this->config.mode == Mode::threadPool) {
+        return this->workers.get_executor();
+    }
+
+    std::lock_guard<std::mutex> lock(this->strandsMutex);
+    const auto endpointId = doca::rdma::MakeEndpointId(endpoint);
+    auto found = this->endpointStrands.find(endpointId);
+    if (found == this->endpointStrands.end()) {
+        found = this->endpointStrands.emplace(endpointId, asio::make_strand(this->workers)).first;
+    }
+    return found->second;
+}
@@ -23,193 +23,843 @@ using doca::rdma::RdmaSessionServerPtr;
 
 using doca::rdma::RdmaEndpointStoragePtr;
 using doca::rdma::RdmaExecutorPtr;
+using doca::rdma::RdmaServiceExecutorPtr;
 
 using doca::rdma::RdmaBufferPtr;
 
 using doca::rdma::communication::Acknowledge;
+using doca::rdma::communication::Catalog;
+using doca::rdma::communication::CatalogRequest;
+using doca::rdma::communication::GroupRequest;
+using doca::rdma::communication::GroupResponce;
 using doca::rdma::communication::MessageSerializer;
+using doca::rdma::communication::MessageType;
 using doca::rdma::communication::Request;
 using doca::rdma::communication::Responce;
 
-RdmaSession::RdmaSession(asio::ip::tcp::socket socket) : socket(std::move(socket)) {};
+namespace
+{
 
-RdmaSession::~RdmaSession()
+using namespace std::chrono_literals;
+
+/// @brief Gets key of remote buffer cache entry; every slot of endpoint is separate remote buffer
+std::string remoteBufferKey(const doca::rdma::RdmaEndpointId & endpointId, std::uint32_t slotIndex)
 {
-    if (this->socket.is_open()) {
-        asio::error_code ec;
-        this->socket.shutdown(asio::ip::tcp::socket::shutdown_both, ec);
-        this->socket.close(ec);
+    return endpointId + "#" + std::to_string(slotIndex);
+}
+
+/// @brief Makes catalog of storage endpoints. Endpoints whose memory is not mapped yet are listed without location,
+/// so their descriptors are sent with first responce
+Catalog makeCatalog(RdmaEndpointStoragePtr endpointsStorage)
+{
+    Catalog catalog;
+    std::set<std::uint64_t> listedGenerations;
+
+    const auto endpointIds = endpointsStorage->ListEndpoints();
+    for (std::size_t index = 0; index < endpointIds.size(); index++) {
+        auto [endpoint, epErr] = endpointsStorage->GetEndpoint(endpointIds[index]);
+        if (epErr) {
+            continue;
+        }
+
+        Catalog::Endpoint entry;
+        entry.endpointNumber = static_cast<std::uint32_t>(index + 1);
+        entry.endpointType = endpoint->Type();
+        entry.endpointPath = endpoint->Path();
+        entry.slots.resize(endpoint->SlotCount());
+
+        if (endpointsStorage->IsEndpointMapped(endpointIds[index])) {
+            for (std::size_t slotIndex = 0; slotIndex < endpoint->SlotCount(); slotIndex++) {
+                auto slotBuffer = endpoint->SlotBuffer(slotIndex);
+                auto [descriptor, descErr] = slotBuffer->GetExportedDescriptor();
+                if (descErr) {
+                    continue;
+                }
+                auto & slot = entry.slots[slotIndex];
+                slot.descriptorGeneration = slotBuffer->DescriptorGeneration();
+                slot.memoryOffset = slotBuffer->RegionOffset();
+                slot.memoryLength = slotBuffer->MemoryRangeSize();
+
+                // Slots sharing memory region share one descriptor
+                if (listedGenerations.insert(slot.descriptorGeneration).second) {
+                    catalog.regions.push_back(Catalog::Region{
+                        .descriptorGeneration = slot.descriptorGeneration,
+                        .memoryDescriptor = descriptor,
+                    });
+                }
+            }
+        }
+
+        catalog.endpoints.push_back(std::move(entry));
     }
+
+    return catalog;
 }
 
-bool RdmaSession::IsOpen() const
+/// @brief Waits until endpoint memory is mapped by storage mapping thread. Session yields while waiting, so other
+/// sessions keep being served and only requests of this endpoint wait for its registration
+asio::awaitable<error> waitForEndpointMapping(RdmaEndpointStoragePtr endpointsStorage,
+                                              const doca::rdma::RdmaEndpointId & endpointId)
+{
+    asio::steady_timer timer(co_await asio::this_coro::executor);
+    while (true) {
+        auto [mapped, err] = endpointsStorage->RequestEndpointMapping(endpointId);
+        if (err) {
+            co_return err;
+        }
+        if (mapped) {
+            co_return nullptr;
+        }
+        timer.expires_after(doca::rdma::constants::EndpointMappingPollInterval);
+        co_await timer.async_wait(asio::use_awaitable);
+    }
+}
+
+/// @brief Request handlers spawned by server session; touched only on session strand
+struct SessionHandlers {
+    explicit SessionHandlers(asio::any_io_executor executor)
+        : timer(executor, asio::steady_timer::time_point::max())
+    {
+    }
+
+    /// @brief Cancelled when handler completes, waking session waiting for room or for all handlers
+    asio::steady_timer timer;
+    std::size_t outstanding = 0;
+    /// @brief First error of handlers; it ends session
+    error err = nullptr;
+};
+
+/// @brief RDMA operation submitted to executor with timer waking session when operation completes
+struct SubmittedOperation {
+    doca::rdma::RdmaAwaitable awaitable;
+    std::shared_ptr<asio::steady_timer> wakeTimer;
+};
+
+/// @brief Submits RDMA operation to executor. Executor posts completion to session executor, so session sleeps while
+/// operation is in flight instead of polling it
+std::tuple<std::optional<SubmittedOperation>, error> submitRdmaOperation(asio::any_io_executor sessionExecutor,
+                                                                         RdmaExecutorPtr executor,
+                                                                         doca::rdma::RdmaOperationRequest request)
 {
-    return this->socket.is_open();
+    auto wakeTimer = std::make_shared<asio::steady_timer>(sessionExecutor, asio::steady_timer::time_point::max());
+    request.onCompleted = [sessionExecutor, wakeTimer]() {
+        asio::post(sessionExecutor, [wakeTimer]() { wakeTimer->cancel(); });
+    };
+    auto [awaitable, err] = executor->SubmitOperation(std::move(request));
+    if (err) {
+        return { std::nullopt, err };
+    }
+    return { SubmittedOperation{ std::move(awaitable), wakeTimer }, nullptr };
 }
 
-RdmaSessionServerPtr RdmaSessionServer::Create(asio::ip::tcp::socket socket)
+/// @brief Waits for RDMA operation submitted to executor. Session yields while operation is in flight, so
+/// requests of other endpoints keep going on the same event loop
+asio::awaitable<error> awaitRdmaOperation(SubmittedOperation & operation)
 {
-    return std::make_shared<RdmaSessionServer>(std::move(socket));
+    // Result is set before completion is posted, so operation not ready yet always wakes timer afterwards
+    const auto deadline = std::chrono::steady_clock::now() + doca::rdma::constants::RdmaOperationTimeout;
+    while (!operation.awaitable.IsReady()) {
+        if (std::chrono::steady_clock::now() >= deadline) {
+            co_return errors::New("Task execution timed out");
+        }
+        operation.wakeTimer->expires_at(deadline);
+        std::ignore = co_await operation.wakeTimer->async_wait(asio::as_tuple(asio::use_awaitable));
+    }
+    auto [_, opErr] = operation.awaitable.Await();
+    co_return opErr;
 }
 
-RdmaSessionClientPtr RdmaSessionClient::Create(asio::ip::tcp::socket socket)
+/// @brief Calls endpoint service on client; asynchronous service is awaited, so session does not block its thread
+asio::awaitable<error> callService(doca::rdma::RdmaEndpointPtr endpoint)
 {
-    return std::make_shared<RdmaSessionClient>(std::move(socket));
+    auto service = endpoint->Service();
+    auto asyncService = std::dynamic_pointer_cast<doca::rdma::IRdmaAsyncService>(service);
+    if (asyncService != nullptr) {
+        co_return co_await asyncService->HandleAsync(endpoint->Buffer());
+    }
+    co_return service->Handle(endpoint->Buffer());
 }
 
-RdmaSessionServer::RdmaSessionServer(asio::ip::tcp::socket socket) : RdmaSession(std::move(socket)) {}
+/// @brief Gets endpoint request is addressed to, by catalog number or by path and type; also returns its ID
+std::tuple<doca::rdma::RdmaEndpointPtr, doca::rdma::RdmaEndpointId, error> resolveRequestEndpoint(
+    RdmaEndpointStoragePtr endpointsStorage, const Request & request)
+{
+    // Endpoint from catalog is requested by number
+    auto endpointId = doca::rdma::MakeEndpointId(request.endpointPath, request.endpointType);
+    if (request.endpointNumber != 0) {
+        auto [numberedId, numErr] = endpointsStorage->GetEndpointIdByNumber(request.endpointNumber);
+        // Unknown number is reported as missing endpoint
+        endpointId = numErr ? std::format("#{}", request.endpointNumber) : numberedId;
+    }
+    auto [endpoint, epErr] = endpointsStorage->GetEndpoint(endpointId);
+    return { endpoint, endpointId, epErr };
+}
 
-RdmaSessionClient::RdmaSessionClient(asio::ip::tcp::socket socket) : RdmaSession(std::move(socket)) {}
+/// @brief Fills responce with location of locked endpoint slot and memory descriptor exported for it when memory was
+/// mapped
+error describeEndpointSlot(Responce & response, doca::rdma::RdmaEndpointPtr endpoint, std::size_t slotIndex)
+{
+    auto slotBuffer = endpoint->SlotBuffer(slotIndex);
+    auto [descriptor, descErr] = slotBuffer->GetExportedDescriptor();
+    if (descErr) {
+        return errors::Wrap(descErr, "Failed to export memory descriptor");
+    }
+    response.memoryDescriptor = descriptor;
+    response.descriptorGeneration = slotBuffer->DescriptorGeneration();
+    response.memoryOffset = slotBuffer->RegionOffset();
+    response.memoryLength = slotBuffer->MemoryRangeSize();
+    response.slotIndex = static_cast<std::uint32_t>(slotIndex);
+    return nullptr;
+}
 
-asio::awaitable<error> doca::rdma::HandleServerSession(RdmaSessionServerPtr session,
-                                                       RdmaEndpointStoragePtr endpointsStorage,
-                                                       RdmaExecutorPtr executor)
+/// @brief Finishes endpoint slot after client acknowledged its transfer: data written by client is flushed and
+/// handed to service, then slot is unlocked
+asio::awaitable<void> finishEndpointSlot(RdmaEndpointStoragePtr endpointsStorage,
+                                         RdmaServiceExecutorPtr serviceExecutor, doca::rdma::RdmaEndpointPtr endpoint,
+                                         std::size_t slotIndex)
 {
-    while (session->IsOpen()) {
-        //  Receive request from client
-        auto [request, err] = co_await session->ReceiveRequest();
+    // Read endpoint was handled by service before transfer
+    if (endpoint->Type() != doca::rdma::RdmaEndpointType::write) {
+        std::ignore = endpointsStorage->UnlockEndpointSlot(endpoint->Path(), slotIndex);
+        DOCA_CPP_LOG_DEBUG("Unlocked endpoint slot");
+        co_return;
+    }
+
+    auto slotBuffer = endpoint->SlotBuffer(slotIndex);
+
+    // Client wrote data into slot's memory; file backed memory is flushed in batches
+    auto flushErr = slotBuffer->NotifyMemoryModified();
+    if (flushErr) {
+        DOCA_CPP_LOG_ERROR(std::format("Failed to flush endpoint memory: {}", flushErr->What()));
+    }
+
+    // Filled slot of multi-slot write endpoint is processed by service executor while this and other sessions hand
+    // out remaining slots; slot is unlocked once service is done with it
+    if (endpoint->SlotCount() > 1) {
+        auto submitErr = co_await serviceExecutor->Submit(
+            endpoint, slotBuffer, [endpointsStorage, endpoint, slotIndex](error srvErr) {
+                if (srvErr) {
+                    DOCA_CPP_LOG_ERROR(std::format("Service failed to process endpoint {} slot {}: {}",
+                                                   doca::rdma::MakeEndpointId(endpoint), slotIndex, srvErr->What()));
+                }
+                std::ignore = endpointsStorage->UnlockEndpointSlot(endpoint->Path(), slotIndex);
+            });
+        if (submitErr) {
+            DOCA_CPP_LOG_ERROR(std::format("Failed to pass slot to service: {}", submitErr->What()));
+            std::ignore = endpointsStorage->UnlockEndpointSlot(endpoint->Path(), slotIndex);
+        }
+        DOCA_CPP_LOG_DEBUG("Slot passed to service");
+        co_return;
+    }
+
+    // Write endpoint service is called after performing RDMA operation and receiving ack from client
+    auto srvErr = co_await serviceExecutor->Run(endpoint, slotBuffer);
+    if (srvErr) {
+        // TODO: fuuuuck again design issues: how to notify client that error occured when processing user
+        // service after RDMA send/write??? Add another TCP message???
+        // FIXME: ignored for now
+        DOCA_CPP_LOG_ERROR(std::format("Service failed to process endpoint {}: {}",
+                                       doca::rdma::MakeEndpointId(endpoint), srvErr->What()));
+    }
+
+    // Unlock slot after RDMA completion
+    std::ignore = endpointsStorage->UnlockEndpointSlot(endpoint->Path(), slotIndex);
+
+    DOCA_CPP_LOG_DEBUG("Unlocked endpoint slot");
+}
+
+/// @brief Handles one request of server session: hands out endpoint slot, waits for acknowledge and calls service
+asio::awaitable<error> handleServerRequest(RdmaSessionServerPtr session, Request request,
+                                           RdmaEndpointStoragePtr endpointsStorage, RdmaExecutorPtr executor,
+                                           RdmaServiceExecutorPtr serviceExecutor)
+{
+    DOCA_CPP_LOG_DEBUG("Received request via socket");
+
+    auto [endpoint, requestedEndpointId, epErr] = resolveRequestEndpoint(endpointsStorage, request);
+
+    DOCA_CPP_LOG_DEBUG(std::format("Requested endpoint: {}", requestedEndpointId));
+
+    // Wait for active connection
+    const auto connectionTimeout = 3000ms;
+    auto [connection, connErr] = executor->WaitForEstablishedConnection(connectionTimeout);
+    if (connErr) {
+        co_return errors::Wrap(connErr, "Failed to get active connection from executor");
+    }
+
+    Responce response;
+    response.requestId = request.requestId;
+
+    if (epErr) {
+        response.responceCode = Responce::Code ::operationEndpointNotFound;
+        auto err = co_await session->SendResponse(response);
         if (err) {
-            // Continue handle requests
-            continue;
+            co_return errors::Wrap(err, "Failed to send responce");
+        }
+        // No endpoint, continue handle other requests
+        co_return nullptr;
+    }
+
+    DOCA_CPP_LOG_DEBUG("Fetched endpoint");
+
+    // Slots are locked by path, which request by number does not carry
+    request.endpointPath = endpoint->Path();
+    request.endpointType = endpoint->Type();
+
+    // Endpoint mapped on demand or not prewarmed yet must be mapped before its descriptor is sent
+    auto mapErr = co_await waitForEndpointMapping(endpointsStorage, requestedEndpointId);
+    if (mapErr) {
+        DOCA_CPP_LOG_ERROR(std::format("Failed to map endpoint {}: {}", requestedEndpointId, mapErr->What()));
+        response.responceCode = Responce::Code::operationInternalError;
+        auto err = co_await session->SendResponse(response);
+        if (err) {
+            co_return errors::Join(mapErr, errors::Wrap(err, "Failed to send responce"));
+        }
+        // Mapping is retried on next request of endpoint, continue handle other requests
+        co_return nullptr;
+    }
+
+    // Try to lock free buffer slot of requested endpoint
+    auto [slot, lockErr] = endpointsStorage->TryLockEndpointSlot(request.endpointPath);
+    if (lockErr) {
+        response.responceCode = Responce::Code::operationInternalError;
+        auto err = co_await session->SendResponse(response);
+        if (err) {
+            co_return errors::Join(lockErr, errors::Wrap(err, "Failed to send responce"));
         }
+        co_return lockErr;
+    }
 
-        DOCA_CPP_LOG_DEBUG("Received request via socket");
+    // All slots of endpoint are locked by other sessions or being processed by service
+    if (!slot.has_value()) {
+        response.responceCode = Responce::Code::operationEndpointLocked;
+        auto err = co_await session->SendResponse(response);
+        if (err) {
+            co_return errors::Wrap(err, "Failed to send responce");
+        }
+        // Endpoint locked, continue handle other requests
+        co_return nullptr;
+    }
 
-        const auto requestedEndpointId = doca::rdma::MakeEndpointId(request.endpointPath, request.endpointType);
+    const auto slotIndex = *slot;
+    auto slotBuffer = endpoint->SlotBuffer(slotIndex);
 
-        DOCA_CPP_LOG_DEBUG(std::format("Requested endpoint: {}", requestedEndpointId));
+    DOCA_CPP_LOG_DEBUG(std::format("Endpoint slot {} locked", slotIndex));
 
-        // Wait for active connection
-        const auto connectionTimeout = 3000ms;
-        auto [connection, connErr] = executor->WaitForEstablishedConnection(connectionTimeout);
-        if (connErr) {
-            co_return errors::Wrap(connErr, "Failed to get active connection from executor");
+    auto descErr = describeEndpointSlot(response, endpoint, slotIndex);
+    if (descErr) {
+        std::ignore = endpointsStorage->UnlockEndpointSlot(request.endpointPath, slotIndex);
+        response.responceCode = Responce::Code::operationInternalError;
+        auto err = co_await session->SendResponse(response);
+        if (err) {
+            co_return errors::Join(descErr, errors::Wrap(err, "Failed to send responce"));
         }
+        co_return descErr;
+    }
 
-        Responce response;
+    DOCA_CPP_LOG_DEBUG(std::format("Descriptor generation {}", response.descriptorGeneration));
 
-        // Get requested endpoint
-        auto [endpoint, epErr] = endpointsStorage->GetEndpoint(requestedEndpointId);
-        if (epErr) {
-            response.responceCode = Responce::Code ::operationEndpointNotFound;
+    // If endpoint is read, call user service before performing RDMA operation
+    if (endpoint->Type() == doca::rdma::RdmaEndpointType::read) {
+        auto srvErr = co_await serviceExecutor->Run(endpoint, slotBuffer);
+        if (srvErr) {
+            // Service error, continue handle other requests
+            std::ignore = endpointsStorage->UnlockEndpointSlot(request.endpointPath, slotIndex);
+            response.responceCode = Responce::Code::operationServiceError;
             auto err = co_await session->SendResponse(response);
             if (err) {
                 co_return errors::Wrap(err, "Failed to send responce");
             }
-            // No endpoint, continue handle other requests
-            continue;
+            co_return nullptr;
         }
+    }
 
-        DOCA_CPP_LOG_DEBUG("Fetched endpoint");
+    response.responceCode = Responce::Code::operationPermitted;
 
-        // Export memory descriptor for endpoint's buffer
-        auto [descriptor, descErr] = endpoint->Buffer()->ExportMemoryDescriptor(executor->GetDevice());
-        if (descErr) {
-            response.responceCode = Responce::Code::operationInternalError;
-            auto err = co_await session->SendResponse(response);
-            if (err) {
-                co_return errors::Join(descErr, errors::Wrap(err, "Failed to send responce"));
-            }
-            co_return errors::Wrap(err, "Failed to export memory descriptor");
+    auto err = co_await session->SendResponse(response);
+    if (err) {
+        std::ignore = endpointsStorage->UnlockEndpointSlot(request.endpointPath, slotIndex);
+        co_return errors::Wrap(err, "Failed to send responce");
+    }
+
+    DOCA_CPP_LOG_DEBUG("Sent permission");
+
+    // Perform RDMA operation
+    err = co_await RdmaSessionServer::PerformRdmaOperation(executor, endpoint);
+    if (err) {
+        std::ignore = endpointsStorage->UnlockEndpointSlot(request.endpointPath, slotIndex);
+        co_return errors::Wrap(err, "Failed to perform RDMA operation");
+    }
+
+    DOCA_CPP_LOG_DEBUG("Performed RDMA");
+
+    // Wait for acknowledgment with timeout (5 seconds)
+    const auto ackTimeout = 5s;
+    auto [ack, ackErr] = co_await session->ReceiveAcknowledge(request.requestId, ackTimeout);
+    if (ackErr) {
+        // Acknowledge was not received, so skip calling user service and unlock
+        std::ignore = endpointsStorage->UnlockEndpointSlot(request.endpointPath, slotIndex);
+        co_return nullptr;
+    }
+
+    DOCA_CPP_LOG_DEBUG("Ack received");
+
+    co_await finishEndpointSlot(endpointsStorage, serviceExecutor, endpoint, slotIndex);
+
+    co_return nullptr;
+}
+
+/// @brief Handles group request of server session. Slots of all endpoints are locked in order of endpoint paths, so
+/// groups locking overlapping endpoints never wait for each other in a cycle; group that finds any endpoint locked
+/// releases slots it holds and is rejected as a whole. All descriptors are sent in one responce and one acknowledge
+/// finishes every slot of group
+asio::awaitable<error> handleServerGroupRequest(RdmaSessionServerPtr session, GroupRequest groupRequest,
+                                                RdmaEndpointStoragePtr endpointsStorage, RdmaExecutorPtr executor,
+                                                RdmaServiceExecutorPtr serviceExecutor)
+{
+    DOCA_CPP_LOG_DEBUG(std::format("Received group request of {} endpoints", groupRequest.requests.size()));
+
+    const auto groupSize = groupRequest.requests.size();
+
+    GroupResponce response;
+    response.requestId = groupRequest.requestId;
+    response.responces.resize(groupSize);
+    for (auto & entry : response.responces) {
+        entry.requestId = groupRequest.requestId;
+    }
+
+    // Code of entry that failed group becomes code of group; descriptors of locked slots are not handed out
+    auto rejectGroup = [&](std::size_t index, Responce::Code code) -> asio::awaitable<error> {
+        response.responceCode = code;
+        response.responces[index].responceCode = code;
+        for (auto & entry : response.responces) {
+            entry.memoryDescriptor = nullptr;
         }
-        response.memoryDescriptor = *descriptor;
+        auto err = co_await session->SendGroupResponse(response);
+        if (err) {
+            co_return errors::Wrap(err, "Failed to send group responce");
+        }
+        co_return nullptr;
+    };
 
-        DOCA_CPP_LOG_DEBUG(std::format("Descriptor created, size {}", response.memoryDescriptor.size()));
+    if (groupSize == 0) {
+        co_return co_await rejectGroup(0, Responce::Code::operationRejected);
+    }
+
+    // Wait for active connection
+    const auto connectionTimeout = 3000ms;
+    auto [connection, connErr] = executor->WaitForEstablishedConnection(connectionTimeout);
+    if (connErr) {
+        co_return errors::Wrap(connErr, "Failed to get active connection from executor");
+    }
+
+    // Get requested endpoints and make sure their memory is mapped
+    std::vector<doca::rdma::RdmaEndpointPtr> endpoints;
+    endpoints.reserve(groupSize);
+    for (std::size_t index = 0; index < groupSize; index++) {
+        auto [endpoint, endpointId, epErr] = resolveRequestEndpoint(endpointsStorage, groupRequest.requests[index]);
+        if (epErr) {
+            // No endpoint, continue handle other requests
+            co_return co_await rejectGroup(index, Responce::Code::operationEndpointNotFound);
+        }
+        auto mapErr = co_await waitForEndpointMapping(endpointsStorage, endpointId);
+        if (mapErr) {
+            DOCA_CPP_LOG_ERROR(std::format("Failed to map endpoint {}: {}", endpointId, mapErr->What()));
+            auto err = co_await rejectGroup(index, Responce::Code::operationInternalError);
+            co_return err ? errors::Join(mapErr, err) : nullptr;
+        }
+        endpoints.push_back(endpoint);
+    }
+
+    // Endpoints sharing path share slots, so group can not hold path twice
+    std::vector<std::size_t> lockOrder(groupSize);
+    std::iota(lockOrder.begin(), lockOrder.end(), 0);
+    std::ranges::sort(lockOrder, {}, [&endpoints](std::size_t index) { return endpoints[index]->Path(); });
+    for (std::size_t position = 1; position < groupSize; position++) {
+        if (endpoints[lockOrder[position]]->Path() == endpoints[lockOrder[position - 1]]->Path()) {
+            co_return co_await rejectGroup(lockOrder[position], Responce::Code::operationRejected);
+        }
+    }
+
+    std::vector<std::size_t> slots(groupSize);
+    std::vector<std::size_t> lockedIndices;
+    lockedIndices.reserve(groupSize);
+    auto unlockGroup = [&]() {
+        for (auto index : lockedIndices) {
+            std::ignore = endpointsStorage->UnlockEndpointSlot(endpoints[index]->Path(), slots[index]);
+        }
+    };
 
-        // Try to lock requested endpoint
-        auto [locked, lockErr] = endpointsStorage->TryLockEndpointsByPath(request.endpointPath);
+    for (auto index : lockOrder) {
+        auto [slot, lockErr] = endpointsStorage->TryLockEndpointSlot(endpoints[index]->Path());
         if (lockErr) {
-            response.responceCode = Responce::Code::operationInternalError;
-            auto err = co_await session->SendResponse(response);
-            if (err) {
-                co_return errors::Join(lockErr, errors::Wrap(err, "Failed to send responce"));
-            }
-            co_return lockErr;
+            unlockGroup();
+            auto err = co_await rejectGroup(index, Responce::Code::operationInternalError);
+            co_return err ? errors::Join(lockErr, err) : lockErr;
         }
 
-        // Endpoint is already locked by other session
-        if (!locked) {
-            response.responceCode = Responce::Code::operationEndpointLocked;
-            auto err = co_await session->SendResponse(response);
-            if (err) {
-                co_return errors::Wrap(err, "Failed to send responce");
-            }
-            // Endpoint locked, continue handle other requests
+        // Endpoint locked by other session; group does not wait for it while holding other slots
+        if (!slot.has_value()) {
+            unlockGroup();
+            co_return co_await rejectGroup(index, Responce::Code::operationEndpointLocked);
+        }
+
+        slots[index] = *slot;
+        lockedIndices.push_back(index);
+    }
+
+    DOCA_CPP_LOG_DEBUG(std::format("Locked slots of {} endpoints", groupSize));
+
+    for (std::size_t index = 0; index < groupSize; index++) {
+        auto descErr = describeEndpointSlot(response.responces[index], endpoints[index], slots[index]);
+        if (descErr) {
+            unlockGroup();
+            auto err = co_await rejectGroup(index, Responce::Code::operationInternalError);
+            co_return err ? errors::Join(descErr, err) : descErr;
+        }
+    }
+
+    // Read endpoints are filled by their services before client reads them
+    for (std::size_t index = 0; index < groupSize; index++) {
+        if (endpoints[index]->Type() != doca::rdma::RdmaEndpointType::read) {
             continue;
         }
+        auto srvErr = co_await serviceExecutor->Run(endpoints[index], endpoints[index]->SlotBuffer(slots[index]));
+        if (srvErr) {
+            // Service error, continue handle other requests
+            unlockGroup();
+            co_return co_await rejectGroup(index, Responce::Code::operationServiceError);
+        }
+    }
+
+    response.responceCode = Responce::Code::operationPermitted;
+    for (auto & entry : response.responces) {
+        entry.responceCode = Responce::Code::operationPermitted;
+    }
 
-        DOCA_CPP_LOG_DEBUG("Endpoint locked");
+    auto err = co_await session->SendGroupResponse(response);
+    if (err) {
+        unlockGroup();
+        co_return errors::Wrap(err, "Failed to send group responce");
+    }
 
-        // Endpoint locked successfully
+    DOCA_CPP_LOG_DEBUG("Sent group permission");
 
-        // If endpoint is read, call user service before performing RDMA operation
-        if (endpoint->Type() == RdmaEndpointType::read) {
-            auto srvErr = endpoint->Service()->Handle(endpoint->Buffer());
-            if (srvErr) {
-                response.responceCode = Responce::Code::operationServiceError;
-                auto err = co_await session->SendResponse(response);
-                if (err) {
-                    co_return errors::Wrap(err, "Failed to send responce");
-                }
-                // Service error, continue handle other requests
-                std::ignore = endpointsStorage->UnlockEndpointsByPath(request.endpointPath);
-                continue;
+    // One acknowledge is sent by client after transfers of all endpoints are done
+    const auto ackTimeout = 5s;
+    auto [ack, ackErr] = co_await session->ReceiveAcknowledge(groupRequest.requestId, ackTimeout);
+    if (ackErr || ack.ackCode != Acknowledge::Code::operationCompleted) {
+        // Acknowledge was not received or transfers of group did not complete, so skip calling user services and
+        // unlock
+        unlockGroup();
+        co_return nullptr;
+    }
+
+    DOCA_CPP_LOG_DEBUG("Group ack received");
+
+    for (std::size_t index = 0; index < groupSize; index++) {
+        co_await finishEndpointSlot(endpointsStorage, serviceExecutor, endpoints[index], slots[index]);
+    }
+
+    co_return nullptr;
+}
+
+}  // namespace
+
+RdmaSession::RdmaSession(RdmaTransportPtr transport)
+    : transport(std::move(transport)), readBuffer(constants::ReadBufferSize)
+{
+}
+
+RdmaSession::~RdmaSession()
+{
+    this->Close();
+}
+
+asio::awaitable<error> RdmaSession::Open()
+{
+    if (this->transport == nullptr) {
+        co_return errors::New("Session has no control transport");
+    }
+    co_return co_await this->transport->Open();
+}
+
+bool RdmaSession::IsOpen() const
+{
+    return this->transport != nullptr && this->transport->IsOpen();
+}
+
+void RdmaSession::Close()
+{
+    if (this->transport != nullptr) {
+        this->transport->Close();
+    }
+}
+
+asio::awaitable<error> RdmaSession::writeFrame(std::vector<std::uint8_t> frame)
+{
+    this->writeQueue.push_back(std::move(frame));
+
+    // Coroutine already writing will write this frame too
+    if (this->writeInProgress) {
+        co_return nullptr;
+    }
+
+    this->writeInProgress = true;
+    while (!this->writeQueue.empty()) {
+        // Frames queued meanwhile go to transport by one vectored write; every frame is its length and payload.
+        // Lengths are collected first so that buffers point to lengths that do not move
+        const auto batchSize = this->writeQueue.size();
+        this->frameLengths.clear();
+        for (const auto & payload : this->writeQueue) {
+            this->frameLengths.push_back(static_cast<std::uint32_t>(payload.size()));
+        }
+        this->writeBuffers.clear();
+        for (std::size_t index = 0; index < batchSize; index++) {
+            this->writeBuffers.push_back(asio::buffer(&this->frameLengths[index], sizeof(std::uint32_t)));
+            this->writeBuffers.push_back(asio::buffer(this->writeQueue[index]));
+        }
+
+        auto err = co_await this->transport->Write(this->writeBuffers);
+        for (std::size_t index = 0; index < batchSize; index++) {
+            this->releaseFrame(std::move(this->writeQueue.front()));
+            this->writeQueue.pop_front();
+        }
+        if (err) {
+            this->writeQueue.clear();
+            this->writeInProgress = false;
+            this->Close();
+            co_return errors::New("Failed to write message to transport: " + err.message());
+        }
+    }
+    this->writeInProgress = false;
+
+    co_return nullptr;
+}
+
+std::vector<std::uint8_t> RdmaSession::acquireFrame()
+{
+    if (this->freeFrames.empty()) {
+        return std::vector<std::uint8_t>(constants::FrameBufferSize);
+    }
+    auto frame = std::move(this->freeFrames.back());
+    this->freeFrames.pop_back();
+    // Whole capacity is offered to serializer; shrinking frame to message size keeps capacity
+    frame.resize(frame.capacity());
+    return frame;
+}
+
+void RdmaSession::releaseFrame(std::vector<std::uint8_t> frame)
+{
+    if (this->freeFrames.size() < constants::MaxFreeFrames) {
+        this->freeFrames.push_back(std::move(frame));
+    }
+}
+
+asio::awaitable<std::tuple<std::span<const std::uint8_t>, error>> RdmaSession::readMessage()
+{
+    using Message = std::span<const std::uint8_t>;
+
+    while (true) {
+        // Frames are parsed in place; buffer is rewound once all received bytes are taken
+        if (this->readBegin == this->readEnd) {
+            this->readBegin = 0;
+            this->readEnd = 0;
+        }
+        const auto available = this->readEnd - this->readBegin;
+
+        std::size_t frameSize = sizeof(std::uint32_t);
+        if (available >= frameSize) {
+            std::uint32_t messageLength = 0;
+            std::memcpy(&messageLength, this->readBuffer.data() + this->readBegin, sizeof(messageLength));
+            if (messageLength > communication::MaxMessageSize) {
+                co_return std::make_tuple(Message(),
+                                          errors::New(std::format("Message length {} exceeds limit", messageLength)));
+            }
+            frameSize += messageLength;
+            if (available >= frameSize) {
+                const auto message =
+                    Message(this->readBuffer.data() + this->readBegin + sizeof(messageLength), messageLength);
+                this->readBegin += frameSize;
+                co_return std::make_tuple(message, nullptr);
             }
         }
 
-        response.responceCode = Responce::Code::operationPermitted;
+        // Frame is received partially; its beginning is moved to front of buffer if frame does not fit after it
+        if (this->readBuffer.size() - this->readBegin < frameSize) {
+            std::memmove(this->readBuffer.data(), this->readBuffer.data() + this->readBegin, available);
+            this->readBegin = 0;
+            this->readEnd = available;
+            if (this->readBuffer.size() < frameSize) {
+                this->readBuffer.resize(frameSize);
+            }
+        }
 
-        err = co_await session->SendResponse(response);
+        // One read takes as many bytes as transport has, so several small frames cost one read
+        auto [bytesRead, err] = co_await this->transport->ReadSome(
+            std::span(this->readBuffer).subspan(this->readEnd));
         if (err) {
-            co_return errors::Wrap(err, "Failed to send responce");
+            // Peer closes session only between messages, so messages sent before were not served
+            const auto peerClosed =
+                available == 0 && (err == asio::error::eof || err == asio::error::connection_reset);
+            const auto message = "Failed to read message from transport: " + err.message();
+            co_return std::make_tuple(Message(), peerClosed ? errors::Wrap(ErrorTypes::RequestNotDelivered, message)
+                                                            : errors::New(message));
         }
+        this->readEnd += bytesRead;
+    }
+}
+
+RdmaSessionServerPtr RdmaSessionServer::Create(RdmaTransportPtr transport)
+{
+    return std::make_shared<RdmaSessionServer>(std::move(transport));
+}
+
+RdmaSessionClientPtr RdmaSessionClient::Create()
+{
+    return std::make_shared<RdmaSessionClient>();
+}
+
+RdmaSessionServer::RdmaSessionServer(RdmaTransportPtr transport) : RdmaSession(std::move(transport)) {}
 
-        DOCA_CPP_LOG_DEBUG("Sent permission");
+RdmaSessionClient::RdmaSessionClient() : RdmaSession(nullptr) {}
 
-        // Perform RDMA operation
-        err = co_await RdmaSessionServer::PerformRdmaOperation(executor, endpoint);
+asio::awaitable<error> doca::rdma::HandleServerSession(RdmaSessionServerPtr session,
+                                                       RdmaEndpointStoragePtr endpointsStorage,
+                                                       RdmaExecutorPtr executor,
+                                                       RdmaServiceExecutorPtr serviceExecutor)
+{
+    // Shared memory transport maps its rings here, so that slow client does not hold accepting loop
+    auto openErr = co_await session->Open();
+    if (openErr) {
+        DOCA_CPP_LOG_DEBUG(std::format("Failed to open session transport: {}", openErr->What()));
+        session->Close();
+        co_return nullptr;
+    }
+
+    // Handlers are counted, so session waits for room before reading next request and for all of them before it
+    // returns: no handler outlives session
+    auto handlers = std::make_shared<SessionHandlers>(co_await asio::this_coro::executor);
+    error sessionErr = nullptr;
+
+    while (session->IsOpen()) {
+        // Client sending requests faster than they are handled is slowed down by unread socket
+        while (handlers->outstanding >= constants::MaxSessionRequestsInFlight) {
+            std::ignore = co_await handlers->timer.async_wait(asio::as_tuple(asio::use_awaitable));
+        }
+
+        //  Receive request from client
+        auto [message, err] = co_await session->ReceiveRequest();
         if (err) {
-            co_return errors::Wrap(err, "Failed to perform RDMA operation");
+            // Client keeps session open between requests; failed read means client closed it or connection broke
+            DOCA_CPP_LOG_DEBUG(std::format("Closing session: {}", err->What()));
+            session->Close();
+            break;
         }
 
-        DOCA_CPP_LOG_DEBUG("Performed RDMA");
+        // Catalog is requested once at session start
+        if (auto * catalogRequest = std::get_if<CatalogRequest>(&message)) {
+            auto catalog = makeCatalog(endpointsStorage);
+            catalog.requestId = catalogRequest->requestId;
+            DOCA_CPP_LOG_DEBUG(std::format("Sending catalog of {} endpoints with {} descriptors",
+                                           catalog.endpoints.size(), catalog.regions.size()));
+            err = co_await session->SendCatalog(catalog);
+            if (err) {
+                session->Close();
+                sessionErr = errors::Wrap(err, "Failed to send endpoint catalog");
+                break;
+            }
+            continue;
+        }
 
-        // Wait for acknowledgment with timeout (5 seconds)
-        const auto ackTimeout = 5s;
-        auto [ack, ackErr] = co_await session->ReceiveAcknowledge(ackTimeout);
-        if (ackErr) {
-            // Acknowledge was not received, so skip calling user service and unlock
-            std::ignore = endpointsStorage->UnlockEndpointsByPath(request.endpointPath);
+        // First error of request handlers closes session; handler completes on session strand
+        handlers->outstanding++;
+        auto onHandled = [session, handlers](std::exception_ptr exception, error handleError) -> void {
+            if (exception) {
+                handleError = errors::New("Request handler threw exception");
+            }
+            if (handleError && handlers->err == nullptr) {
+                handlers->err = handleError;
+                session->Close();
+            }
+            handlers->outstanding--;
+            handlers->timer.cancel();
+        };
+
+        // Every request is handled by its own coroutine, so requests for independent endpoints overlap and are
+        // answered in order of completion
+        if (auto * groupRequest = std::get_if<GroupRequest>(&message)) {
+            asio::co_spawn(co_await asio::this_coro::executor,
+                           handleServerGroupRequest(session, std::move(*groupRequest), endpointsStorage, executor,
+                                                    serviceExecutor),
+                           onHandled);
             continue;
         }
+        const auto & request = std::get<Request>(message);
+        asio::co_spawn(co_await asio::this_coro::executor,
+                       handleServerRequest(session, request, endpointsStorage, executor, serviceExecutor), onHandled);
+    }
+
+    // Handlers still running finish their RDMA operations and release slots they locked
+    while (handlers->outstanding > 0) {
+        std::ignore = co_await handlers->timer.async_wait(asio::as_tuple(asio::use_awaitable));
+    }
+
+    if (handlers->err) {
+        sessionErr = sessionErr ? errors::Join(sessionErr, handlers->err) : handlers->err;
+    }
+    co_return sessionErr;
+}
+
+asio::awaitable<error> doca::rdma::HandleClientCatalog(RdmaSessionClientPtr session,
+                                                       RdmaEndpointStoragePtr endpointsStorage,
+                                                       RdmaExecutorPtr executor,
+                                                       RdmaRemoteBufferCachePtr remoteBufferCache)
+{
+    const auto timeout = 5s;
+    auto [catalog, err] = co_await session->RequestCatalog(timeout);
+    if (err) {
+        co_return errors::Wrap(err, "Failed to request endpoint catalog");
+    }
 
-        DOCA_CPP_LOG_DEBUG("Ack received");
+    std::map<std::uint64_t, RdmaMemoryDescriptorPtr> descriptors;
+    for (const auto & region : catalog.regions) {
+        descriptors.insert_or_assign(region.descriptorGeneration, region.memoryDescriptor);
+    }
 
-        // If endpoint is write, call user service after performing RDMA operation and receiving ack from
-        // client
-        if (endpoint->Type() == RdmaEndpointType::write) {
-            auto srvErr = endpoint->Service()->Handle(endpoint->Buffer());
-            if (srvErr) {
-                // TODO: fuuuuck again design issues: how to notify client that error occured when processing user
-                // service after RDMA send/write??? Add another TCP message???
-                // FIXME: ignored for now
-                // Service error, continue handle other requests
-                std::ignore = endpointsStorage->UnlockEndpointsByPath(request.endpointPath);
+    // Import memory of endpoints registered in client; slots sharing region share one imported memory map
+    std::size_t importedSlots = 0;
+    for (const auto & entry : catalog.endpoints) {
+        const auto endpointId = doca::rdma::MakeEndpointId(entry.endpointPath, entry.endpointType);
+        if (!endpointsStorage->Contains(endpointId)) {
+            continue;
+        }
+        for (std::uint32_t slotIndex = 0; slotIndex < entry.slots.size(); slotIndex++) {
+            const auto & slot = entry.slots[slotIndex];
+            auto descriptor = descriptors.find(slot.descriptorGeneration);
+            if (slot.descriptorGeneration == 0 || descriptor == descriptors.end() || descriptor->second == nullptr) {
+                // Memory is not mapped on server yet; descriptor comes with first responce
                 continue;
             }
+            auto [_, importErr] =
+                remoteBufferCache->GetOrImport(remoteBufferKey(endpointId, slotIndex), slot.descriptorGeneration,
+                                               slot.memoryOffset, slot.memoryLength, *descriptor->second,
+                                               executor->GetDevice());
+            if (importErr) {
+                co_return errors::Wrap(importErr, "Failed to import remote memory of endpoint " + endpointId);
+            }
+            importedSlots++;
         }
-
-        // Unlock endpoint after successful RDMA completion
-        std::ignore = endpointsStorage->UnlockEndpointsByPath(request.endpointPath);
-
-        DOCA_CPP_LOG_DEBUG("Unlocked endpoint");
     }
 
+    DOCA_CPP_LOG_DEBUG(std::format("Catalog of {} endpoints received, imported {} slots", catalog.endpoints.size(),
+                                   importedSlots));
+
     co_return nullptr;
 }
 
 asio::awaitable<error> doca::rdma::HandleClientSession(RdmaSessionClientPtr session, RdmaEndpointPtr endpoint,
-                                                       RdmaExecutorPtr executor)
+                                                       RdmaExecutorPtr executor,
+                                                       RdmaRemoteBufferCachePtr remoteBufferCache)
 {
     Request request;
     request.endpointType = endpoint->Type();
@@ -226,7 +876,12 @@ asio::awaitable<error> doca::rdma::HandleClientSession(RdmaSessionClientPtr sess
     }
 
     DOCA_CPP_LOG_DEBUG(std::format("Got responce: code {}, desc_size {}",
-                                   Responce::CodeDescription(responce.responceCode), responce.memoryDescriptor.size()));
+                                   Responce::CodeDescription(responce.responceCode),
+                                   responce.memoryDescriptor ? responce.memoryDescriptor->size() : 0));
+
+    Acknowledge ack;
+    ack.requestId = responce.requestId;
+    ack.ackCode = Acknowledge::Code::operationCanceled;
 
     // Check if operation permitted
     if (responce.responceCode != Responce::Code::operationPermitted) {
@@ -236,24 +891,31 @@ asio::awaitable<error> doca::rdma::HandleClientSession(RdmaSessionClientPtr sess
 
     DOCA_CPP_LOG_DEBUG("RDMA permitted");
 
-    // Form remote RDMA buffer from given descriptor
-    auto [remoteBuffer, rmErr] =
-        RdmaRemoteBuffer::FromExportedRemoteDescriptor(responce.memoryDescriptor, executor->GetDevice());
+    // Form remote RDMA buffer from given descriptor or reuse one imported from descriptor of the same generation.
+    // Descriptor is left out by server if it was sent earlier in session, so remote memory must be imported already
+    const auto endpointId = remoteBufferKey(doca::rdma::MakeEndpointId(endpoint), responce.slotIndex);
+    const auto noDescriptor = RdmaMemoryDescriptor();
+    const auto & descriptor = responce.memoryDescriptor ? *responce.memoryDescriptor : noDescriptor;
+    auto [remoteBuffer, rmErr] = remoteBufferCache->GetOrImport(
+        endpointId, responce.descriptorGeneration, responce.memoryOffset, responce.memoryLength, descriptor,
+        executor->GetDevice());
     if (rmErr) {
+        // Server assumes descriptors it sent are imported; new session makes it send them again
+        std::ignore = co_await session->SendAcknowledge(ack);
+        if (responce.memoryDescriptor == nullptr) {
+            session->Close();
+        }
         co_return errors::Wrap(rmErr, "Failed to make remote RDMA buffer from export descriptor");
     }
 
     DOCA_CPP_LOG_DEBUG("Made remote buffer");
 
-    Acknowledge ack;
-    ack.ackCode = Acknowledge::Code::operationCanceled;
-
     // If endpoint is write, call user service before performing RDMA operation
     if (endpoint->Type() == RdmaEndpointType::write) {
-        auto srvErr = endpoint->Service()->Handle(endpoint->Buffer());
+        auto srvErr = co_await callService(endpoint);
         if (srvErr) {
             ack.ackCode = Acknowledge::Code::operationCanceled;
-            std::ignore = co_await session->SendAcknowledge(ack, timeout);
+            std::ignore = co_await session->SendAcknowledge(ack);
             co_return errors::Wrap(srvErr, "Service handle failed");
         }
         DOCA_CPP_LOG_DEBUG("User service called");
@@ -262,16 +924,28 @@ asio::awaitable<error> doca::rdma::HandleClientSession(RdmaSessionClientPtr sess
     // Perform RDMA operation
     err = co_await RdmaSessionClient::PerformRdmaOperation(executor, endpoint, remoteBuffer);
     if (err) {
+        // Imported remote memory may be stale, import it again on next request. Server will not send descriptor it
+        // already sent in this session, so session is closed and next one gets descriptors again
+        remoteBufferCache->Invalidate(endpointId);
         ack.ackCode = Acknowledge::Code::operationFailed;
-        std::ignore = co_await session->SendAcknowledge(ack, timeout);
+        std::ignore = co_await session->SendAcknowledge(ack);
+        session->Close();
         co_return errors::Wrap(err, "Failed to perform RDMA operation");
     }
 
     DOCA_CPP_LOG_DEBUG("RDMA performed");
 
+    // Server data was read into endpoint's memory; file backed memory is flushed in batches
+    if (endpoint->Type() == RdmaEndpointType::read) {
+        auto flushErr = endpoint->Buffer()->NotifyMemoryModified();
+        if (flushErr) {
+            DOCA_CPP_LOG_ERROR(std::format("Failed to flush endpoint memory: {}", flushErr->What()));
+        }
+    }
+
     // Send acknowledge to server
     ack.ackCode = Acknowledge::Code::operationCompleted;
-    err = co_await session->SendAcknowledge(ack, timeout);
+    err = co_await session->SendAcknowledge(ack);
     if (err) {
         co_return errors::Wrap(err, "Failed to send acknowledge to server");
     }
@@ -280,7 +954,7 @@ asio::awaitable<error> doca::rdma::HandleClientSession(RdmaSessionClientPtr sess
 
     // If endpoint is read, call user service before performing RDMA operation
     if (endpoint->Type() == RdmaEndpointType::read) {
-        auto srvErr = endpoint->Service()->Handle(endpoint->Buffer());
+        auto srvErr = co_await callService(endpoint);
         if (srvErr) {
             co_return errors::Wrap(srvErr, "Service handle failed");
         }
@@ -290,95 +964,289 @@ asio::awaitable<error> doca::rdma::HandleClientSession(RdmaSessionClientPtr sess
     co_return nullptr;
 }
 
-asio::awaitable<std::tuple<Request, error>> RdmaSessionServer::ReceiveRequest()
+asio::awaitable<error> doca::rdma::HandleClientGroup(RdmaSessionClientPtr session,
+                                                     std::vector<RdmaEndpointPtr> endpoints, RdmaExecutorPtr executor,
+                                                     RdmaRemoteBufferCachePtr remoteBufferCache)
 {
-    uint32_t requestLength = 0;
-    auto [err0, _] = co_await asio::async_read(this->socket, asio::buffer(&requestLength, sizeof(requestLength)),
-                                               asio::as_tuple(asio::use_awaitable));
-    if (err0) {
-        co_return std::make_tuple(Request(),
-                                  errors::New("Failed to read request length from socket: " + err0.message()));
+    GroupRequest request;
+    request.requests.reserve(endpoints.size());
+    for (const auto & endpoint : endpoints) {
+        Request entry;
+        entry.endpointType = endpoint->Type();
+        entry.endpointPath = endpoint->Path();
+        request.requests.push_back(std::move(entry));
+    }
+
+    DOCA_CPP_LOG_DEBUG(std::format("Requested group of {} endpoints", endpoints.size()));
+
+    // Send group request
+    const auto timeout = 5s;
+    auto [responce, err] = co_await session->SendGroupRequest(request, timeout);
+    if (err) {
+        co_return errors::Wrap(err, "Failed to send group request via socket");
+    }
+
+    // Check if operation permitted; code of every entry tells which endpoint failed group
+    if (responce.responceCode != Responce::Code::operationPermitted) {
+        auto status = Responce::CodeDescription(responce.responceCode);
+        for (std::size_t index = 0; index < responce.responces.size() && index < endpoints.size(); index++) {
+            const auto entryCode = responce.responces[index].responceCode;
+            if (entryCode != Responce::Code::operationPermitted) {
+                status += std::format("; {}: {}", doca::rdma::MakeEndpointId(endpoints[index]),
+                                      Responce::CodeDescription(entryCode));
+            }
+        }
+        co_return errors::New("Group operation was not permitted by server; responce message: " + status);
+    }
+
+    Acknowledge ack;
+    ack.requestId = responce.requestId;
+    ack.ackCode = Acknowledge::Code::operationCanceled;
+
+    if (responce.responces.size() != endpoints.size()) {
+        std::ignore = co_await session->SendAcknowledge(ack);
+        co_return errors::New("Group responce does not match group request");
+    }
+
+    DOCA_CPP_LOG_DEBUG("Group RDMA permitted");
+
+    // Form remote RDMA buffers from given descriptors or reuse ones imported earlier
+    const auto noDescriptor = RdmaMemoryDescriptor();
+    std::vector<std::string> remoteBufferKeys;
+    std::vector<RdmaRemoteBufferPtr> remoteBuffers;
+    remoteBufferKeys.reserve(endpoints.size());
+    remoteBuffers.reserve(endpoints.size());
+    for (std::size_t index = 0; index < endpoints.size(); index++) {
+        const auto & entry = responce.responces[index];
+        const auto & descriptor = entry.memoryDescriptor ? *entry.memoryDescriptor : noDescriptor;
+        remoteBufferKeys.push_back(remoteBufferKey(doca::rdma::MakeEndpointId(endpoints[index]), entry.slotIndex));
+        auto [remoteBuffer, rmErr] =
+            remoteBufferCache->GetOrImport(remoteBufferKeys.back(), entry.descriptorGeneration, entry.memoryOffset,
+                                           entry.memoryLength, descriptor, executor->GetDevice());
+        if (rmErr) {
+            // Server assumes descriptors it sent are imported; new session makes it send them again
+            std::ignore = co_await session->SendAcknowledge(ack);
+            if (entry.memoryDescriptor == nullptr) {
+                session->Close();
+            }
+            co_return errors::Wrap(rmErr, "Failed to make remote RDMA buffer from export descriptor");
+        }
+        remoteBuffers.push_back(remoteBuffer);
+    }
+
+    // Write endpoints are filled by their services before transfers start
+    for (const auto & endpoint : endpoints) {
+        if (endpoint->Type() != RdmaEndpointType::write) {
+            continue;
+        }
+        auto srvErr = co_await callService(endpoint);
+        if (srvErr) {
+            std::ignore = co_await session->SendAcknowledge(ack);
+            co_return errors::Wrap(srvErr, "Service handle failed");
+        }
+    }
+
+    // All operations are submitted before any is awaited; executor keeps up to its in-flight limit of them on
+    // connection at once, so transfers of group overlap
+    error opErr = nullptr;
+    const auto sessionExecutor = co_await asio::this_coro::executor;
+    std::vector<SubmittedOperation> operations;
+    operations.reserve(endpoints.size());
+    for (std::size_t index = 0; index < endpoints.size(); index++) {
+        auto operation = RdmaOperationRequest{
+            .type = endpoints[index]->Type() == RdmaEndpointType::write ? RdmaOperationType::write
+                                                                         : RdmaOperationType::read,
+            .localBuffer = endpoints[index]->Buffer(),
+            .remoteBuffer = remoteBuffers[index],
+            .responcePromise = std::make_shared<std::promise<RdmaOperationResponce>>(),
+        };
+        auto [submitted, subErr] = submitRdmaOperation(sessionExecutor, executor, operation);
+        if (subErr) {
+            opErr = errors::Wrap(subErr, "Failed to submit operation");
+            break;
+        }
+        operations.push_back(std::move(*submitted));
+    }
+
+    // Operations already submitted are awaited even if later ones failed, so no operation outlives group
+    for (auto & operation : operations) {
+        auto awaitErr = co_await awaitRdmaOperation(operation);
+        if (awaitErr) {
+            opErr = opErr ? errors::Join(opErr, awaitErr) : awaitErr;
+        }
     }
 
-    std::vector<uint8_t> requestBuffer(requestLength);
-    auto [err1, __] =
-        co_await asio::async_read(this->socket, asio::buffer(requestBuffer), asio::as_tuple(asio::use_awaitable));
-    if (err1) {
-        co_return std::make_tuple(Request(),
-                                  errors::New("Failed to read request payload from socket: " + err1.message()));
+    if (opErr) {
+        // Imported remote memory may be stale, import it again on next request. Server will not send descriptors it
+        // already sent in this session, so session is closed and next one gets descriptors again
+        for (const auto & key : remoteBufferKeys) {
+            remoteBufferCache->Invalidate(key);
+        }
+        ack.ackCode = Acknowledge::Code::operationFailed;
+        std::ignore = co_await session->SendAcknowledge(ack);
+        session->Close();
+        co_return errors::Wrap(opErr, "Failed to perform RDMA operations of group");
     }
 
-    Request request = MessageSerializer::DeserializeRequest(requestBuffer);
+    DOCA_CPP_LOG_DEBUG("Group RDMA performed");
+
+    // Server data was read into endpoints' memory; file backed memory is flushed in batches
+    for (const auto & endpoint : endpoints) {
+        if (endpoint->Type() != RdmaEndpointType::read) {
+            continue;
+        }
+        auto flushErr = endpoint->Buffer()->NotifyMemoryModified();
+        if (flushErr) {
+            DOCA_CPP_LOG_ERROR(std::format("Failed to flush endpoint memory: {}", flushErr->What()));
+        }
+    }
 
-    co_return std::make_tuple(request, nullptr);
+    // One acknowledge finishes whole group on server
+    ack.ackCode = Acknowledge::Code::operationCompleted;
+    err = co_await session->SendAcknowledge(ack);
+    if (err) {
+        co_return errors::Wrap(err, "Failed to send acknowledge to server");
+    }
+
+    // Read endpoints are handled by their services after data arrived
+    error srvErrs = nullptr;
+    for (const auto & endpoint : endpoints) {
+        if (endpoint->Type() != RdmaEndpointType::read) {
+            continue;
+        }
+        auto srvErr = co_await callService(endpoint);
+        if (srvErr) {
+            srvErr = errors::Wrap(srvErr, "Service handle failed for endpoint " + doca::rdma::MakeEndpointId(endpoint));
+            srvErrs = srvErrs ? errors::Join(srvErrs, srvErr) : srvErr;
+        }
+    }
+
+    co_return srvErrs;
 }
 
-asio::awaitable<error> RdmaSessionServer::SendResponse(const Responce & response)
+asio::awaitable<std::tuple<std::variant<Request, CatalogRequest, GroupRequest>, error>>
+RdmaSessionServer::ReceiveRequest()
 {
-    auto responseBuffer = MessageSerializer::SerializeResponse(response);
-    uint32_t responseLength = static_cast<uint32_t>(responseBuffer.size());
+    using ReceivedRequest = std::variant<Request, CatalogRequest, GroupRequest>;
+
+    while (true) {
+        auto [message, err] = co_await this->readMessage();
+        if (err) {
+            // Nobody will acknowledge requests of broken session
+            this->pendingAcknowledges.FailAll(err);
+            co_return std::make_tuple(ReceivedRequest(), err);
+        }
 
-    auto [err0, _] = co_await asio::async_write(this->socket, asio::buffer(&responseLength, sizeof(responseLength)),
-                                                asio::as_tuple(asio::use_awaitable));
-    if (err0) {
-        co_return errors::New("Failed to write responce length to socket: " + err0.message());
+        auto [type, typeErr] = MessageSerializer::GetMessageType(message);
+        if (typeErr) {
+            co_return std::make_tuple(ReceivedRequest(), errors::Wrap(typeErr, "Failed to parse message"));
+        }
+
+        switch (type) {
+            case MessageType::request:
+                {
+                    auto [request, reqErr] = MessageSerializer::DeserializeRequest(message);
+                    co_return std::make_tuple(ReceivedRequest(std::move(request)), reqErr);
+                }
+            case MessageType::catalogRequest:
+                {
+                    auto [catalogRequest, reqErr] = MessageSerializer::DeserializeCatalogRequest(message);
+                    co_return std::make_tuple(ReceivedRequest(catalogRequest), reqErr);
+                }
+            case MessageType::groupRequest:
+                {
+                    auto [groupRequest, reqErr] = MessageSerializer::DeserializeGroupRequest(message);
+                    co_return std::make_tuple(ReceivedRequest(std::move(groupRequest)), reqErr);
+                }
+            case MessageType::acknowledge:
+                {
+                    // Acknowledge of request that stopped waiting for it is dropped
+                    auto [ack, ackErr] = MessageSerializer::DeserializeAcknowledge(message);
+                    if (ackErr) {
+                        co_return std::make_tuple(ReceivedRequest(), ackErr);
+                    }
+                    if (!this->pendingAcknowledges.Deliver(ack)) {
+                        DOCA_CPP_LOG_DEBUG(std::format("Dropped acknowledge of request {}", ack.requestId));
+                    }
+                    break;
+                }
+            default:
+                co_return std::make_tuple(ReceivedRequest(), errors::New("Unexpected message type from client"));
+        }
     }
+}
+
+asio::awaitable<error> RdmaSessionServer::SendResponse(const Responce & response)
+{
+    // Acknowledge may be received as soon as responce is sent, so it is expected beforehand
+    if (response.responceCode == Responce::Code::operationPermitted) {
+        this->pendingAcknowledges.Expect(response.requestId, co_await asio::this_coro::executor);
+    }
+
+    auto message = response;
+    this->omitSentDescriptor(message);
 
-    auto [err1, __] =
-        co_await asio::async_write(this->socket, asio::buffer(responseBuffer), asio::as_tuple(asio::use_awaitable));
-    if (err1) {
-        co_return errors::New("Failed to write responce payload to socket: " + err1.message());
+    auto err = co_await this->writeMessage(message);
+    if (err) {
+        this->pendingAcknowledges.Discard(response.requestId);
+        co_return errors::Wrap(err, "Failed to write responce");
     }
 
     co_return nullptr;
 }
 
-asio::awaitable<std::tuple<Acknowledge, error>> RdmaSessionServer::ReceiveAcknowledge(std::chrono::seconds timeout)
+asio::awaitable<error> RdmaSessionServer::SendGroupResponse(const GroupResponce & response)
 {
-    // Timer for async operation timeout
-    auto executor = co_await asio::this_coro::executor;
-    asio::steady_timer timer(executor, timeout);
+    // Whole group is closed by one acknowledge
+    if (response.responceCode == Responce::Code::operationPermitted) {
+        this->pendingAcknowledges.Expect(response.requestId, co_await asio::this_coro::executor);
+    }
 
-    Acknowledge ack;
+    auto message = response;
+    for (auto & entry : message.responces) {
+        this->omitSentDescriptor(entry);
+    }
 
-    // Error to return in case of timeout or fail
-    error err = nullptr;
+    auto err = co_await this->writeMessage(message);
+    if (err) {
+        this->pendingAcknowledges.Discard(response.requestId);
+        co_return errors::Wrap(err, "Failed to write group responce");
+    }
 
-    auto readAck = [&]() -> asio::awaitable<void> {
-        uint32_t ackLength = 0;
-        auto [err0, _] = co_await asio::async_read(this->socket, asio::buffer(&ackLength, sizeof(ackLength)),
-                                                   asio::as_tuple(asio::use_awaitable));
-        if (err0) {
-            err = errors::New("Failed to read acknowledge length from socket: " + err0.message());
-            co_return;
-        }
+    co_return nullptr;
+}
 
-        std::vector<uint8_t> ackBuffer(ackLength);
-        auto [err1, __] =
-            co_await asio::async_read(this->socket, asio::buffer(ackBuffer), asio::as_tuple(asio::use_awaitable));
-        if (err1) {
-            err = errors::New("Failed to read acknowledge payload from socket: " + err0.message());
-            co_return;
+void RdmaSessionServer::omitSentDescriptor(Responce & response)
+{
+    // Client imported memory of descriptors sent earlier in session, so only location is sent
+    if (response.memoryDescriptor != nullptr && response.responceCode == Responce::Code::operationPermitted) {
+        if (!this->sentGenerations.insert(response.descriptorGeneration).second) {
+            response.memoryDescriptor = nullptr;
         }
+    }
+}
 
-        ack = MessageSerializer::DeserializeAcknowledge(ackBuffer);
-        co_return;
-    };
-
-    auto timeoutHandler = [&]() -> asio::awaitable<void> {
-        co_await timer.async_wait(asio::use_awaitable);
-        DOCA_CPP_LOG_DEBUG("Asio timer finished");
+asio::awaitable<error> RdmaSessionServer::SendCatalog(const Catalog & catalog)
+{
+    for (const auto & region : catalog.regions) {
+        this->sentGenerations.insert(region.descriptorGeneration);
+    }
 
-        err = ErrorTypes::TimeoutExpired;
-    };
+    auto err = co_await this->writeMessage(catalog);
+    if (err) {
+        co_return errors::Wrap(err, "Failed to write catalog");
+    }
 
-    // Wait for either ack read or timeout
-    co_await (readAck() || timeoutHandler());
+    co_return nullptr;
+}
 
-    co_return std::make_tuple(ack, err);
+asio::awaitable<std::tuple<Acknowledge, error>> RdmaSessionServer::ReceiveAcknowledge(
+    communication::RequestId requestId, std::chrono::seconds timeout)
+{
+    co_return co_await this->pendingAcknowledges.Wait(requestId, timeout);
 }
 
-asio::awaitable<error> RdmaSessionClient::Connect(const std::string & serverAddress, uint16_t serverPort)
+asio::awaitable<error> RdmaSessionClient::Connect(const RdmaControlAddress & address)
 {
     const auto connectionTimeout = 5s;
     auto executor = co_await asio::this_coro::executor;
@@ -389,20 +1257,13 @@ asio::awaitable<error> RdmaSessionClient::Connect(const std::string & serverAddr
     bool connected = false;
 
     auto doConnect = [&]() -> asio::awaitable<void> {
-        asio::ip::tcp::resolver resolver(executor);
-        auto [err0, peers] = co_await resolver.async_resolve(serverAddress, std::to_string(serverPort),
-                                                             asio::as_tuple(asio::use_awaitable));
-        if (err0) {
-            connectionError = errors::New("Failed to resolve remote connection: " + err0.message());
-            co_return;
-        }
-        DOCA_CPP_LOG_DEBUG("Address resolved");
-        auto [err1, _] = co_await asio::async_connect(this->socket, peers, asio::as_tuple(asio::use_awaitable));
-        if (err1) {
-            connectionError = errors::New("Failed to connect to remote peer via socket: " + err1.message());
+        auto [transport, err] = co_await ConnectTransport(address);
+        if (err) {
+            connectionError = err;
             co_return;
         }
-        DOCA_CPP_LOG_DEBUG("Connected to peer");
+        DOCA_CPP_LOG_DEBUG(std::format("Connected to peer via {}", address.ToString()));
+        this->transport = transport;
         connected = true;
     };
 
@@ -417,121 +1278,193 @@ asio::awaitable<error> RdmaSessionClient::Connect(const std::string & serverAddr
     co_await (doConnect() || timeout());
 
     if (connectionError) {
+        this->Close();
         co_return errors::Wrap(connectionError, "Failed to connect to remote peer");
     }
 
-    this->socket.set_option(asio::socket_base::keep_alive(true));
-
     this->isConnected = true;
+
+    // Responces are read by one coroutine and delivered to requests waiting for them
+    asio::co_spawn(executor, RdmaSessionClient::readResponces(this->shared_from_this()), asio::detached);
+
+    co_return nullptr;
 }
 
 asio::awaitable<std::tuple<Responce, error>> RdmaSessionClient::SendRequest(const Request & request,
                                                                             const std::chrono::seconds & timeout)
 {
-    if (!this->isConnected) {
+    if (!this->isConnected || !this->IsOpen()) {
         co_return std::make_tuple(Responce(), errors::New("No session with server via socket; connect first"));
     }
 
-    auto executor = co_await asio::this_coro::executor;
-    asio::steady_timer timer(executor, timeout);
+    auto message = request;
+    message.requestId = this->nextRequestId++;
+    this->addressByNumber(message);
 
-    Responce response;
+    // Responce may be read while request is still being written, so it is expected beforehand
+    this->pendingResponces.Expect(message.requestId, co_await asio::this_coro::executor);
 
-    error requestError = nullptr;
-
-    auto doRequest = [&]() -> asio::awaitable<void> {
-        auto requestBuffer = MessageSerializer::SerializeRequest(request);
-        uint32_t requestLength = static_cast<uint32_t>(requestBuffer.size());
+    auto err = co_await this->writeMessage(message);
+    if (err) {
+        this->pendingResponces.Discard(message.requestId);
+        co_return std::make_tuple(Responce(), errors::Wrap(ErrorTypes::RequestNotDelivered, err->What()));
+    }
 
-        auto [err0, _] = co_await asio::async_write(this->socket, asio::buffer(&requestLength, sizeof(requestLength)),
-                                                    asio::as_tuple(asio::use_awaitable));
-        if (err0) {
-            requestError = errors::New("Failed to write request length to socket: " + err0.message());
-            co_return;
-        }
+    auto [responce, respErr] = co_await this->pendingResponces.Wait(message.requestId, timeout);
+    if (respErr) {
+        co_return std::make_tuple(Responce(), errors::Wrap(respErr, "Failed to execute request via socket"));
+    }
 
-        auto [err1, __] =
-            co_await asio::async_write(this->socket, asio::buffer(requestBuffer), asio::as_tuple(asio::use_awaitable));
-        if (err1) {
-            requestError = errors::New("Failed to write request payload to socket: " + err1.message());
-            co_return;
-        }
+    co_return std::make_tuple(responce, nullptr);
+}
 
-        uint32_t responseLength = 0;
-        auto [err2, ___] = co_await asio::async_read(
-            this->socket, asio::buffer(&responseLength, sizeof(responseLength)), asio::as_tuple(asio::use_awaitable));
-        if (err2) {
-            requestError = errors::New("Failed to read responce length from socket: " + err2.message());
-            co_return;
-        }
+asio::awaitable<std::tuple<GroupResponce, error>> RdmaSessionClient::SendGroupRequest(
+    const GroupRequest & request, const std::chrono::seconds & timeout)
+{
+    if (!this->isConnected || !this->IsOpen()) {
+        co_return std::make_tuple(GroupResponce(), errors::New("No session with server via socket; connect first"));
+    }
 
-        std::vector<uint8_t> responseBuffer(responseLength);
-        auto [err3, ____] =
-            co_await asio::async_read(this->socket, asio::buffer(responseBuffer), asio::as_tuple(asio::use_awaitable));
-        if (err3) {
-            requestError = errors::New("Failed to read responce payload from socket: " + err3.message());
-            co_return;
-        }
+    auto message = request;
+    message.requestId = this->nextRequestId++;
+    for (auto & entry : message.requests) {
+        this->addressByNumber(entry);
+    }
 
-        response = MessageSerializer::DeserializeResponse(responseBuffer);
-    };
+    this->pendingGroupResponces.Expect(message.requestId, co_await asio::this_coro::executor);
 
-    auto reqTimeout = [&]() -> asio::awaitable<void> {
-        co_await timer.async_wait(asio::use_awaitable);
-        DOCA_CPP_LOG_DEBUG("Asio timer finished");
-        requestError = ErrorTypes::TimeoutExpired;
-    };
+    auto err = co_await this->writeMessage(message);
+    if (err) {
+        this->pendingGroupResponces.Discard(message.requestId);
+        co_return std::make_tuple(GroupResponce(), errors::Wrap(ErrorTypes::RequestNotDelivered, err->What()));
+    }
 
-    co_await (doRequest() || reqTimeout());
-    if (requestError) {
-        co_return std::make_tuple(Responce(), errors::Wrap(requestError, "Failed to execute request via socket"));
+    auto [responce, respErr] = co_await this->pendingGroupResponces.Wait(message.requestId, timeout);
+    if (respErr) {
+        co_return std::make_tuple(GroupResponce(),
+                                  errors::Wrap(respErr, "Failed to execute group request via socket"));
     }
 
-    co_return std::make_tuple(response, nullptr);
+    co_return std::make_tuple(responce, nullptr);
 }
 
-asio::awaitable<error> RdmaSessionClient::SendAcknowledge(const Acknowledge & ack, const std::chrono::seconds & timeout)
+void RdmaSessionClient::addressByNumber(Request & request) const
 {
-    if (!this->isConnected) {
+    // Endpoint listed in catalog is addressed by number instead of path
+    auto number = this->endpointNumbers.find(doca::rdma::MakeEndpointId(request.endpointPath, request.endpointType));
+    if (number != this->endpointNumbers.end()) {
+        request.endpointNumber = number->second;
+        request.endpointPath.clear();
+    }
+}
+
+asio::awaitable<error> RdmaSessionClient::SendAcknowledge(const Acknowledge & ack)
+{
+    if (!this->isConnected || !this->IsOpen()) {
         co_return errors::New("No session with server via socket; connect first");
     }
 
-    auto executor = co_await asio::this_coro::executor;
-    asio::steady_timer timer(executor, timeout);
+    auto err = co_await this->writeMessage(ack);
+    if (err) {
+        co_return errors::Wrap(err, "Failed to send acknowledge via socket");
+    }
 
-    error ackError = nullptr;
+    co_return nullptr;
+}
+
+asio::awaitable<std::tuple<Catalog, error>> RdmaSessionClient::RequestCatalog(const std::chrono::seconds & timeout)
+{
+    if (!this->isConnected || !this->IsOpen()) {
+        co_return std::make_tuple(Catalog(), errors::New("No session with server via socket; connect first"));
+    }
+
+    CatalogRequest request;
+    request.requestId = this->nextRequestId++;
+
+    this->pendingCatalogs.Expect(request.requestId, co_await asio::this_coro::executor);
 
-    auto doAck = [&]() -> asio::awaitable<void> {
-        auto ackBuffer = MessageSerializer::SerializeAcknowledge(ack);
-        uint32_t ackLength = static_cast<uint32_t>(ackBuffer.size());
+    auto err = co_await this->writeMessage(request);
+    if (err) {
+        this->pendingCatalogs.Discard(request.requestId);
+        co_return std::make_tuple(Catalog(), errors::Wrap(err, "Failed to send catalog request via socket"));
+    }
+
+    auto [catalog, catErr] = co_await this->pendingCatalogs.Wait(request.requestId, timeout);
+    if (catErr) {
+        co_return std::make_tuple(Catalog(), errors::Wrap(catErr, "Failed to receive catalog via socket"));
+    }
 
-        auto [err0, _] = co_await asio::async_write(this->socket, asio::buffer(&ackLength, sizeof(ackLength)),
-                                                    asio::as_tuple(asio::use_awaitable));
-        if (err0) {
-            ackError = errors::New("Failed to write acknowledge length to socket: " + err0.message());
+    for (const auto & entry : catalog.endpoints) {
+        this->endpointNumbers.insert_or_assign(doca::rdma::MakeEndpointId(entry.endpointPath, entry.endpointType),
+                                               entry.endpointNumber);
+    }
+
+    co_return std::make_tuple(catalog, nullptr);
+}
+
+asio::awaitable<void> RdmaSessionClient::readResponces(RdmaSessionClientPtr session)
+{
+    // Requests of failed session are not answered, so all of them are failed
+    auto failSession = [&session](error err) {
+        session->pendingResponces.FailAll(err);
+        session->pendingCatalogs.FailAll(err);
+        session->pendingGroupResponces.FailAll(err);
+        session->Close();
+    };
+
+    while (session->IsOpen()) {
+        auto [message, err] = co_await session->readMessage();
+        if (err) {
+            DOCA_CPP_LOG_DEBUG(std::format("Closing session: {}", err->What()));
+            failSession(err);
             co_return;
         }
 
-        auto [err1, __] =
-            co_await asio::async_write(this->socket, asio::buffer(ackBuffer), asio::as_tuple(asio::use_awaitable));
-        if (err1) {
-            ackError = errors::New("Failed to write acknowledge payload to socket: " + err1.message());
+        auto [type, typeErr] = MessageSerializer::GetMessageType(message);
+        if (typeErr ||
+            (type != MessageType::responce && type != MessageType::catalog && type != MessageType::groupResponce)) {
+            DOCA_CPP_LOG_ERROR("Unexpected message from server");
+            failSession(errors::New("Unexpected message from server"));
             co_return;
         }
-    };
 
-    auto ackTimeout = [&]() -> asio::awaitable<void> {
-        co_await timer.async_wait(asio::use_awaitable);
-        DOCA_CPP_LOG_DEBUG("Asio timer finished");
-        ackError = ErrorTypes::TimeoutExpired;
-    };
+        if (type == MessageType::catalog) {
+            auto [catalog, catErr] = MessageSerializer::DeserializeCatalog(message);
+            if (catErr) {
+                DOCA_CPP_LOG_ERROR(std::format("Malformed catalog from server: {}", catErr->What()));
+                failSession(catErr);
+                co_return;
+            }
+            if (!session->pendingCatalogs.Deliver(catalog)) {
+                DOCA_CPP_LOG_DEBUG(std::format("Dropped catalog of request {}", catalog.requestId));
+            }
+            continue;
+        }
 
-    co_await (doAck() || ackTimeout());
-    if (ackError) {
-        co_return errors::Wrap(ackError, "Failed to send acknowledge via socket");
-    }
+        if (type == MessageType::groupResponce) {
+            auto [groupResponce, groupErr] = MessageSerializer::DeserializeGroupResponce(message);
+            if (groupErr) {
+                DOCA_CPP_LOG_ERROR(std::format("Malformed group responce from server: {}", groupErr->What()));
+                failSession(groupErr);
+                co_return;
+            }
+            if (!session->pendingGroupResponces.Deliver(groupResponce)) {
+                DOCA_CPP_LOG_DEBUG(std::format("Dropped group responce of request {}", groupResponce.requestId));
+            }
+            continue;
+        }
 
-    co_return nullptr;
+        // Responce of request that stopped waiting for it is dropped
+        auto [responce, respErr] = MessageSerializer::DeserializeResponse(message);
+        if (respErr) {
+            DOCA_CPP_LOG_ERROR(std::format("Malformed responce from server: {}", respErr->What()));
+            failSession(respErr);
+            co_return;
+        }
+        if (!session->pendingResponces.Deliver(responce)) {
+            DOCA_CPP_LOG_DEBUG(std::format("Dropped responce of request {}", responce.requestId));
+        }
+    }
 }
 
 asio::awaitable<error> RdmaSessionServer::PerformRdmaOperation(RdmaExecutorPtr executor, RdmaEndpointPtr endpoint)
@@ -588,14 +1521,12 @@ asio::awaitable<error> RdmaSessionClient::PerformRdmaWrite(RdmaExecutorPtr execu
         .responcePromise = std::make_shared<std::promise<RdmaOperationResponce>>(),
     };
 
-    auto [awaitable, err] = executor->SubmitOperation(operation);
+    auto [submitted, err] = submitRdmaOperation(co_await asio::this_coro::executor, executor, operation);
     if (err) {
         co_return errors::Wrap(err, "Failed to submit operation");
     }
 
-    auto [_, opErr] = awaitable.AwaitWithTimeout(constants::RdmaOperationTimeout);
-
-    co_return opErr;
+    co_return co_await awaitRdmaOperation(*submitted);
 }
 
 asio::awaitable<error> RdmaSessionClient::PerformRdmaRead(RdmaExecutorPtr executor, RdmaEndpointPtr endpoint,
@@ -608,12 +1539,10 @@ asio::awaitable<error> RdmaSessionClient::PerformRdmaRead(RdmaExecutorPtr execut
         .responcePromise = std::make_shared<std::promise<RdmaOperationResponce>>(),
     };
 
-    auto [awaitable, err] = executor->SubmitOperation(operation);
+    auto [submitted, err] = submitRdmaOperation(co_await asio::this_coro::executor, executor, operation);
     if (err) {
         co_return errors::Wrap(err, "Failed to submit operation");
     }
 
-    auto [_, opErr] = awaitable.AwaitWithTimeout(constants::RdmaOperationTimeout);
-
-    co_return opErr;
+    co_return co_await awaitRdmaOperation(*submitted);
 }
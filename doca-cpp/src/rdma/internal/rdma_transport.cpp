@@ -0,0 +1,527 @@
+#include "doca-cpp/rdma/internal/rdma_transport.hpp"
+
+#include "doca-cpp/logging/logging.hpp"
+
+#ifdef DOCA_CPP_ENABLE_LOGGING
+namespace
+{
+inline const auto loggerConfig = doca::logging::GetDefaultLoggerConfig();
+inline const auto loggerContext = kvalog::Logger::Context{
+    .appName = "doca-cpp",
+    .moduleName = "transport",
+};
+}  // namespace
+DOCA_CPP_DEFINE_LOGGER(loggerConfig, loggerContext)
+#endif
+
+using doca::rdma::RdmaControlAddress;
+using doca::rdma::RdmaSharedMemoryTransport;
+using doca::rdma::RdmaTcpTransport;
+using doca::rdma::RdmaTransport;
+using doca::rdma::RdmaTransportListener;
+using doca::rdma::RdmaTransportListenerPtr;
+using doca::rdma::RdmaTransportPtr;
+using doca::rdma::RdmaUnixTransport;
+
+namespace
+{
+
+/// @brief Marks shared memory segment created by this library
+constexpr std::uint64_t sharedMemoryMagic = 0x646f63612d73686d;
+
+/// @brief Byte acknowledging that server mapped shared memory segment
+constexpr std::uint8_t sharedMemoryMapped = 1;
+
+/// @brief Byte waking reader of shared memory ring
+constexpr std::uint8_t sharedMemoryWakeUp = 1;
+
+/// @brief Distinguishes shared memory segments created by one process
+std::atomic<std::uint64_t> sharedMemorySegmentCounter = 0;
+
+/// @brief Formats errno as error message
+std::string errnoMessage()
+{
+    return std::string(std::strerror(errno));
+}
+
+/// @brief Splits address after scheme prefix; returns false if address has other scheme
+bool stripScheme(const std::string & address, std::string_view scheme, std::string & rest)
+{
+    if (!address.starts_with(scheme)) {
+        return false;
+    }
+    rest = address.substr(scheme.size());
+    return true;
+}
+
+}  // namespace
+
+std::tuple<RdmaControlAddress, error> RdmaControlAddress::Parse(const std::string & address)
+{
+    auto parsed = RdmaControlAddress{};
+    std::string rest;
+
+    if (stripScheme(address, "unix://", rest) || stripScheme(address, "shm://", rest)) {
+        parsed.scheme = address.starts_with("unix://") ? Scheme::unixSocket : Scheme::sharedMemory;
+        if (rest.empty() || rest.front() != '/') {
+            return { RdmaControlAddress{}, errors::New("Control address must have absolute socket path: " + address) };
+        }
+        parsed.path = rest;
+        return { parsed, nullptr };
+    }
+
+    if (!stripScheme(address, "tcp://", rest)) {
+        if (address.find("://") != std::string::npos) {
+            return { RdmaControlAddress{}, errors::New("Unknown control address scheme: " + address) };
+        }
+        rest = address;
+    }
+
+    // Port is optional; it follows last colon
+    const auto colon = rest.rfind(':');
+    parsed.host = rest.substr(0, colon);
+    if (colon != std::string::npos) {
+        const auto portString = rest.substr(colon + 1);
+        unsigned long port = 0;
+        try {
+            port = std::stoul(portString);
+        } catch (const std::exception &) {
+            return { RdmaControlAddress{}, errors::New("Invalid port in control address: " + address) };
+        }
+        if (port == 0 || port > std::numeric_limits<std::uint16_t>::max()) {
+            return { RdmaControlAddress{}, errors::New("Invalid port in control address: " + address) };
+        }
+        parsed.port = static_cast<std::uint16_t>(port);
+    }
+    return { parsed, nullptr };
+}
+
+std::string RdmaControlAddress::ToString() const
+{
+    switch (this->scheme) {
+        case Scheme::unixSocket:
+            return "unix://" + this->path;
+        case Scheme::sharedMemory:
+            return "shm://" + this->path;
+        case Scheme::tcp:
+        default:
+            return std::format("tcp://{}:{}", this->host, this->port);
+    }
+}
+
+asio::awaitable<error> RdmaTransport::Open()
+{
+    co_return nullptr;
+}
+
+RdmaSharedMemoryTransport::RdmaSharedMemoryTransport(asio::local::stream_protocol::socket socket, Role role)
+    : socket(std::move(socket)), role(role)
+{
+}
+
+RdmaSharedMemoryTransport::~RdmaSharedMemoryTransport()
+{
+    this->Close();
+    if (this->segment != nullptr) {
+        munmap(this->segment, this->segmentSize);
+    }
+}
+
+asio::awaitable<error> RdmaSharedMemoryTransport::Open()
+{
+    if (this->role == Role::client) {
+        const auto name = std::format("/doca-cpp-{}-{}", getpid(), sharedMemorySegmentCounter.fetch_add(1));
+        const auto fd = shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+        if (fd < 0) {
+            co_return errors::New(std::format("Failed to create shared memory {}: {}", name, errnoMessage()));
+        }
+        auto err = this->mapSegment(fd, true);
+        close(fd);
+        if (err) {
+            shm_unlink(name.c_str());
+            co_return errors::Wrap(err, "Failed to create shared memory rings");
+        }
+
+        // Name is unlinked once server mapped segment, so segment is released when both sides unmap it
+        const auto nameLength = static_cast<std::uint32_t>(name.size());
+        const auto nameBuffers = std::array<asio::const_buffer, 2>{
+            asio::buffer(&nameLength, sizeof(nameLength)),
+            asio::buffer(name),
+        };
+        auto [writeErr, _] =
+            co_await asio::async_write(this->socket, nameBuffers, asio::as_tuple(asio::use_awaitable));
+        auto mapped = std::uint8_t{ 0 };
+        auto readErr = writeErr;
+        if (!writeErr) {
+            std::tie(readErr, std::ignore) = co_await asio::async_read(
+                this->socket, asio::buffer(&mapped, sizeof(mapped)), asio::as_tuple(asio::use_awaitable));
+        }
+        shm_unlink(name.c_str());
+        if (readErr || mapped != sharedMemoryMapped) {
+            co_return errors::New("Server did not map shared memory rings: " + readErr.message());
+        }
+
+        DOCA_CPP_LOG_DEBUG(std::format("Shared memory rings {} are mapped by server", name));
+        co_return nullptr;
+    }
+
+    auto nameLength = std::uint32_t{ 0 };
+    auto [lengthErr, lengthBytes] = co_await asio::async_read(
+        this->socket, asio::buffer(&nameLength, sizeof(nameLength)), asio::as_tuple(asio::use_awaitable));
+    if (lengthErr) {
+        co_return errors::New("Failed to receive shared memory name: " + lengthErr.message());
+    }
+    if (nameLength == 0 || nameLength > constants::SharedMemoryNameMaxLength) {
+        co_return errors::New(std::format("Shared memory name length {} is invalid", nameLength));
+    }
+    auto name = std::string(nameLength, '\0');
+    auto [nameErr, nameBytes] =
+        co_await asio::async_read(this->socket, asio::buffer(name), asio::as_tuple(asio::use_awaitable));
+    if (nameErr) {
+        co_return errors::New("Failed to receive shared memory name: " + nameErr.message());
+    }
+
+    const auto fd = shm_open(name.c_str(), O_RDWR, 0);
+    if (fd < 0) {
+        co_return errors::New(std::format("Failed to open shared memory {}: {}", name, errnoMessage()));
+    }
+    auto err = this->mapSegment(fd, false);
+    close(fd);
+    if (err) {
+        co_return errors::Wrap(err, "Failed to map shared memory rings");
+    }
+
+    auto [ackErr, ackBytes] = co_await asio::async_write(this->socket,
+                                                         asio::buffer(&sharedMemoryMapped, sizeof(sharedMemoryMapped)),
+                                                         asio::as_tuple(asio::use_awaitable));
+    if (ackErr) {
+        co_return errors::New("Failed to acknowledge shared memory rings: " + ackErr.message());
+    }
+
+    DOCA_CPP_LOG_DEBUG(std::format("Mapped shared memory rings {}", name));
+    co_return nullptr;
+}
+
+error RdmaSharedMemoryTransport::mapSegment(int fd, bool create)
+{
+    static_assert(std::has_single_bit(constants::SharedMemoryRingCapacity),
+                  "Shared memory ring capacity must be power of two");
+
+    const auto size = sizeof(SharedHeader) + 2 * constants::SharedMemoryRingCapacity;
+    if (create) {
+        if (ftruncate(fd, static_cast<off_t>(size)) != 0) {
+            return errors::New(std::format("Failed to resize shared memory: {}", errnoMessage()));
+        }
+    } else {
+        struct stat status {};
+        if (fstat(fd, &status) != 0) {
+            return errors::New(std::format("Failed to stat shared memory: {}", errnoMessage()));
+        }
+        if (static_cast<std::size_t>(status.st_size) != size) {
+            return errors::New(std::format("Shared memory size {} does not match expected {}", status.st_size, size));
+        }
+    }
+
+    auto * address = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (address == MAP_FAILED) {
+        return errors::New(std::format("Failed to map shared memory: {}", errnoMessage()));
+    }
+
+    SharedHeader * header = nullptr;
+    if (create) {
+        header = new (address) SharedHeader{};
+        header->magic = sharedMemoryMagic;
+        header->ringCapacity = constants::SharedMemoryRingCapacity;
+    } else {
+        header = static_cast<SharedHeader *>(address);
+        if (header->magic != sharedMemoryMagic || header->ringCapacity != constants::SharedMemoryRingCapacity) {
+            munmap(address, size);
+            return errors::New("Shared memory was not created by compatible client");
+        }
+    }
+    this->segment = address;
+    this->segmentSize = size;
+
+    // Ring 0 goes from client to server, ring 1 from server to client
+    auto * data = static_cast<std::uint8_t *>(address) + sizeof(SharedHeader);
+    const auto clientSide = this->role == Role::client;
+    this->outgoing = &header->rings[clientSide ? 0 : 1];
+    this->incoming = &header->rings[clientSide ? 1 : 0];
+    this->outgoingData = data + (clientSide ? 0 : constants::SharedMemoryRingCapacity);
+    this->incomingData = data + (clientSide ? constants::SharedMemoryRingCapacity : 0);
+
+    return nullptr;
+}
+
+std::tuple<std::size_t, asio::error_code> RdmaSharedMemoryTransport::writeRing(std::span<const std::uint8_t> bytes)
+{
+    constexpr auto capacity = constants::SharedMemoryRingCapacity;
+
+    const auto writePosition = this->outgoing->writePosition.load(std::memory_order_relaxed);
+    const auto readPosition = this->outgoing->readPosition.load(std::memory_order_acquire);
+    // Peer may not read more than was written; otherwise free space would be computed beyond ring
+    const auto used = writePosition - readPosition;
+    if (used > capacity) {
+        DOCA_CPP_LOG_ERROR("Shared memory peer moved read position beyond written bytes, closing transport");
+        this->Close();
+        return { 0, asio::error_code(EPROTO, asio::system_category()) };
+    }
+    const auto length = std::min<std::size_t>(bytes.size(), capacity - used);
+    if (length == 0) {
+        return { 0, asio::error_code() };
+    }
+
+    const auto offset = writePosition & (capacity - 1);
+    const auto firstPart = std::min(length, capacity - offset);
+    std::memcpy(this->outgoingData + offset, bytes.data(), firstPart);
+    std::memcpy(this->outgoingData, bytes.data() + firstPart, length - firstPart);
+
+    // Sequentially consistent store pairs with reader setting waiting flag and then checking ring again
+    this->outgoing->writePosition.store(writePosition + length, std::memory_order_seq_cst);
+    return { length, asio::error_code() };
+}
+
+std::tuple<std::size_t, asio::error_code> RdmaSharedMemoryTransport::readRing(std::span<std::uint8_t> bytes)
+{
+    constexpr auto capacity = constants::SharedMemoryRingCapacity;
+
+    const auto readPosition = this->incoming->readPosition.load(std::memory_order_relaxed);
+    const auto writePosition = this->incoming->writePosition.load(std::memory_order_seq_cst);
+    // Peer may not write more than ring holds; otherwise bytes would be copied from beyond ring
+    const auto available = writePosition - readPosition;
+    if (available > capacity) {
+        DOCA_CPP_LOG_ERROR("Shared memory peer moved write position beyond ring capacity, closing transport");
+        this->Close();
+        return { 0, asio::error_code(EPROTO, asio::system_category()) };
+    }
+    const auto length = std::min<std::size_t>(bytes.size(), available);
+    if (length == 0) {
+        return { 0, asio::error_code() };
+    }
+
+    const auto offset = readPosition & (capacity - 1);
+    const auto firstPart = std::min(length, capacity - offset);
+    std::memcpy(bytes.data(), this->incomingData + offset, firstPart);
+    std::memcpy(bytes.data() + firstPart, this->incomingData, length - firstPart);
+
+    this->incoming->readPosition.store(readPosition + length, std::memory_order_release);
+    return { length, asio::error_code() };
+}
+
+asio::awaitable<std::tuple<std::size_t, asio::error_code>> RdmaSharedMemoryTransport::ReadSome(
+    std::span<std::uint8_t> buffer)
+{
+    if (this->segment == nullptr) {
+        co_return std::make_tuple(std::size_t{ 0 }, asio::error_code(asio::error::not_connected));
+    }
+
+    while (true) {
+        auto [bytesRead, ringErr] = this->readRing(buffer);
+        if (bytesRead > 0 || ringErr || buffer.empty()) {
+            co_return std::make_tuple(bytesRead, ringErr);
+        }
+
+        // Writer checks flag after publishing bytes, so bytes written before flag is set are seen by second check
+        this->incoming->readerWaiting.store(1, std::memory_order_seq_cst);
+        std::tie(bytesRead, ringErr) = this->readRing(buffer);
+        if (bytesRead > 0 || ringErr) {
+            this->incoming->readerWaiting.store(0, std::memory_order_relaxed);
+            co_return std::make_tuple(bytesRead, ringErr);
+        }
+
+        auto [err, _] = co_await this->socket.async_read_some(asio::buffer(this->wakeUpBytes),
+                                                              asio::as_tuple(asio::use_awaitable));
+        if (err) {
+            // Peer may have written last bytes right before closing socket
+            std::tie(bytesRead, ringErr) = this->readRing(buffer);
+            co_return std::make_tuple(bytesRead, bytesRead > 0 || ringErr ? ringErr : err);
+        }
+    }
+}
+
+asio::awaitable<asio::error_code> RdmaSharedMemoryTransport::Write(std::span<const asio::const_buffer> buffers)
+{
+    if (this->segment == nullptr) {
+        co_return asio::error_code(asio::error::not_connected);
+    }
+
+    auto executor = co_await asio::this_coro::executor;
+    asio::steady_timer fullRingTimer(executor);
+
+    for (const auto & buffer : buffers) {
+        auto bytes = std::span(static_cast<const std::uint8_t *>(buffer.data()), buffer.size());
+        while (!bytes.empty()) {
+            if (!this->IsOpen()) {
+                co_return asio::error_code(asio::error::broken_pipe);
+            }
+
+            const auto [bytesWritten, ringErr] = this->writeRing(bytes);
+            if (ringErr) {
+                co_return ringErr;
+            }
+            if (bytesWritten == 0) {
+                // Reader is busy draining ring, so it is not woken; space is polled instead
+                fullRingTimer.expires_after(constants::SharedMemoryFullPollInterval);
+                std::ignore = co_await fullRingTimer.async_wait(asio::as_tuple(asio::use_awaitable));
+                continue;
+            }
+            bytes = bytes.subspan(bytesWritten);
+
+            if (this->outgoing->readerWaiting.exchange(0, std::memory_order_seq_cst) != 0) {
+                const auto wakeUp = asio::buffer(&sharedMemoryWakeUp, sizeof(sharedMemoryWakeUp));
+                auto [err, _] =
+                    co_await asio::async_write(this->socket, wakeUp, asio::as_tuple(asio::use_awaitable));
+                if (err) {
+                    co_return err;
+                }
+            }
+        }
+    }
+    co_return asio::error_code();
+}
+
+bool RdmaSharedMemoryTransport::IsOpen() const
+{
+    return this->socket.is_open();
+}
+
+void RdmaSharedMemoryTransport::Close()
+{
+    if (this->socket.is_open()) {
+        asio::error_code ec;
+        this->socket.shutdown(asio::local::stream_protocol::socket::shutdown_both, ec);
+        this->socket.close(ec);
+    }
+}
+
+std::tuple<RdmaTransportListenerPtr, error> RdmaTransportListener::Create(asio::io_context & ioContext,
+                                                                          const RdmaControlAddress & address)
+{
+    auto listener = std::make_shared<RdmaTransportListener>(address);
+    asio::error_code ec;
+
+    if (address.scheme == RdmaControlAddress::Scheme::tcp) {
+        auto endpoint = asio::ip::tcp::endpoint(asio::ip::tcp::v4(), address.port);
+        if (!address.host.empty()) {
+            endpoint.address(asio::ip::make_address(address.host, ec));
+            if (ec) {
+                return { nullptr, errors::New("Invalid control listen address: " + ec.message()) };
+            }
+        }
+        listener->tcpAcceptor = std::make_unique<asio::ip::tcp::acceptor>(ioContext);
+        std::ignore = listener->tcpAcceptor->open(endpoint.protocol(), ec);
+        if (!ec) {
+            std::ignore = listener->tcpAcceptor->set_option(asio::socket_base::reuse_address(true), ec);
+        }
+        if (!ec) {
+            std::ignore = listener->tcpAcceptor->bind(endpoint, ec);
+        }
+        if (!ec) {
+            std::ignore = listener->tcpAcceptor->listen(asio::socket_base::max_listen_connections, ec);
+        }
+    } else {
+        // Socket file left by server that exited is replaced
+        unlink(address.path.c_str());
+        auto endpoint = asio::local::stream_protocol::endpoint(address.path);
+        listener->unixAcceptor = std::make_unique<asio::local::stream_protocol::acceptor>(ioContext);
+        std::ignore = listener->unixAcceptor->open(endpoint.protocol(), ec);
+        if (!ec) {
+            std::ignore = listener->unixAcceptor->bind(endpoint, ec);
+        }
+        if (!ec) {
+            std::ignore = listener->unixAcceptor->listen(asio::socket_base::max_listen_connections, ec);
+        }
+    }
+
+    if (ec) {
+        return { nullptr, errors::New(std::format("Failed to listen on {}: {}", address.ToString(), ec.message())) };
+    }
+    return { listener, nullptr };
+}
+
+RdmaTransportListener::RdmaTransportListener(const RdmaControlAddress & address) : address(address) {}
+
+RdmaTransportListener::~RdmaTransportListener()
+{
+    this->Close();
+    if (this->unixAcceptor) {
+        unlink(this->address.path.c_str());
+    }
+}
+
+asio::awaitable<std::tuple<RdmaTransportPtr, error>> RdmaTransportListener::Accept()
+{
+    if (this->tcpAcceptor) {
+        auto [err, socket] = co_await this->tcpAcceptor->async_accept(asio::as_tuple(asio::use_awaitable));
+        if (err) {
+            co_return std::make_tuple(nullptr, errors::New("Failed to accept control connection: " + err.message()));
+        }
+        co_return std::make_tuple(std::make_shared<RdmaTcpTransport>(std::move(socket)), nullptr);
+    }
+
+    auto [err, socket] = co_await this->unixAcceptor->async_accept(asio::as_tuple(asio::use_awaitable));
+    if (err) {
+        co_return std::make_tuple(nullptr, errors::New("Failed to accept control connection: " + err.message()));
+    }
+    if (this->address.scheme == RdmaControlAddress::Scheme::sharedMemory) {
+        co_return std::make_tuple(
+            std::make_shared<RdmaSharedMemoryTransport>(std::move(socket), RdmaSharedMemoryTransport::Role::server),
+            nullptr);
+    }
+    co_return std::make_tuple(std::make_shared<RdmaUnixTransport>(std::move(socket)), nullptr);
+}
+
+void RdmaTransportListener::Close()
+{
+    asio::error_code ec;
+    if (this->tcpAcceptor) {
+        std::ignore = this->tcpAcceptor->close(ec);
+    }
+    if (this->unixAcceptor) {
+        std::ignore = this->unixAcceptor->close(ec);
+    }
+}
+
+asio::awaitable<std::tuple<RdmaTransportPtr, error>> doca::rdma::ConnectTransport(const RdmaControlAddress & address)
+{
+    using Result = std::tuple<RdmaTransportPtr, error>;
+
+    auto executor = co_await asio::this_coro::executor;
+
+    if (address.scheme == RdmaControlAddress::Scheme::tcp) {
+        asio::ip::tcp::resolver resolver(executor);
+        auto [resolveErr, peers] = co_await resolver.async_resolve(address.host, std::to_string(address.port),
+                                                                   asio::as_tuple(asio::use_awaitable));
+        if (resolveErr) {
+            co_return Result(nullptr, errors::New("Failed to resolve remote connection: " + resolveErr.message()));
+        }
+        DOCA_CPP_LOG_DEBUG("Address resolved");
+
+        asio::ip::tcp::socket socket(executor);
+        auto [connectErr, _] = co_await asio::async_connect(socket, peers, asio::as_tuple(asio::use_awaitable));
+        if (connectErr) {
+            const auto message = "Failed to connect to remote peer via socket: " + connectErr.message();
+            co_return Result(nullptr, errors::New(message));
+        }
+        co_return Result(std::make_shared<RdmaTcpTransport>(std::move(socket)), nullptr);
+    }
+
+    asio::local::stream_protocol::socket socket(executor);
+    auto [connectErr] = co_await socket.async_connect(asio::local::stream_protocol::endpoint(address.path),
+                                                      asio::as_tuple(asio::use_awaitable));
+    if (connectErr) {
+        co_return Result(nullptr, errors::New(std::format("Failed to connect to {}: {}", address.ToString(),
+                                                          connectErr.message())));
+    }
+    if (address.scheme == RdmaControlAddress::Scheme::unixSocket) {
+        co_return Result(std::make_shared<RdmaUnixTransport>(std::move(socket)), nullptr);
+    }
+
+    auto transport =
+        std::make_shared<RdmaSharedMemoryTransport>(std::move(socket), RdmaSharedMemoryTransport::Role::client);
+    auto err = co_await transport->Open();
+    if (err) {
+        co_return Result(nullptr, errors::Wrap(err, "Failed to open shared memory transport"));
+    }
+    co_return Result(transport, nullptr);
+}
@@ -1,6 +1,12 @@
 #include "doca-cpp/rdma/rdma_buffer.hpp"
 
+using doca::AccessFlags;
 using doca::DevicePtr;
+using doca::MappedFile;
+using doca::MappedFilePtr;
+using doca::MemoryAllocation;
+using doca::MemoryAllocationPtr;
+using doca::MemoryAllocatorPtr;
 using doca::MemoryMap;
 using doca::MemoryMapPtr;
 using doca::MemoryRange;
@@ -14,6 +20,27 @@ using doca::rdma::RdmaBufferPtr;
 using doca::rdma::RdmaRemoteBuffer;
 using doca::rdma::RdmaRemoteBufferPtr;
 
+namespace
+{
+
+/// @brief Gets next memory descriptor generation. Generations start from random value so that descriptors exported
+/// by restarted process do not match generations cached by peers
+std::uint64_t nextDescriptorGeneration()
+{
+    static std::atomic<std::uint64_t> generation = []() {
+        std::random_device randomDevice;
+        return (static_cast<std::uint64_t>(randomDevice()) << 32) | randomDevice();
+    }();
+    auto nextGeneration = generation.fetch_add(1, std::memory_order_relaxed);
+    if (nextGeneration == 0) {
+        // Zero is reserved for unmapped memory
+        nextGeneration = generation.fetch_add(1, std::memory_order_relaxed);
+    }
+    return nextGeneration;
+}
+
+}  // namespace
+
 std::tuple<RdmaBufferPtr, error> RdmaBuffer::FromMemoryRange(doca::MemoryRangePtr memoryRange)
 {
     auto buffer = std::make_shared<RdmaBuffer>();
@@ -24,28 +51,128 @@ std::tuple<RdmaBufferPtr, error> RdmaBuffer::FromMemoryRange(doca::MemoryRangePt
     return { buffer, nullptr };
 }
 
+std::tuple<RdmaBufferPtr, error> RdmaBuffer::FromAllocator(MemoryAllocatorPtr allocator, std::size_t size)
+{
+    if (allocator == nullptr) {
+        return { nullptr, errors::New("Memory allocator is null") };
+    }
+
+    auto [allocation, allocErr] = allocator->Allocate(size);
+    if (allocErr) {
+        return { nullptr, errors::Wrap(allocErr, "Failed to allocate memory with " + allocator->Description()) };
+    }
+
+    auto buffer = std::make_shared<RdmaBuffer>();
+    auto err = buffer->RegisterMemoryAllocation(allocation);
+    if (err) {
+        return { nullptr, errors::Wrap(err, "Failed to register memory allocation to buffer") };
+    }
+    return { buffer, nullptr };
+}
+
+std::tuple<RdmaBufferPtr, error> RdmaBuffer::FromExternalMemory(std::span<std::byte> memory,
+                                                                std::shared_ptr<void> lifetimeToken)
+{
+    auto buffer = std::make_shared<RdmaBuffer>();
+    auto err = buffer->RegisterExternalMemory(memory, std::move(lifetimeToken));
+    if (err) {
+        return { nullptr, errors::Wrap(err, "Failed to register external memory to buffer") };
+    }
+    return { buffer, nullptr };
+}
+
+std::tuple<RdmaBufferPtr, error> RdmaBuffer::FromMappedFile(MappedFilePtr file)
+{
+    if (file == nullptr) {
+        return { nullptr, errors::New("Mapped file is null") };
+    }
+
+    // Mapped file is lifetime token of registered memory, so file stays mapped while buffer exists
+    auto buffer = std::make_shared<RdmaBuffer>();
+    auto err = buffer->RegisterExternalMemory(std::as_writable_bytes(file->Memory()), file);
+    if (err) {
+        return { nullptr, errors::Wrap(err, "Failed to register mapped file to buffer") };
+    }
+    buffer->mappedFile = file;
+    return { buffer, nullptr };
+}
+
 error RdmaBuffer::RegisterMemoryRange(doca::MemoryRangePtr memoryRange)
 {
-    if (this->memoryRange != nullptr) {
+    if (this->memoryAllocation != nullptr) {
         return ErrorTypes::MemoryRangeAlreadyRegistered;
     }
+    if (memoryRange == nullptr) {
+        return errors::New("Memory range is null");
+    }
     this->memoryRange = memoryRange;
+    // Vector is owned by memory range, so allocation does not release memory
+    this->memoryAllocation = MemoryAllocation::Create(*memoryRange, nullptr);
     return nullptr;
 };
 
+error RdmaBuffer::RegisterMemoryAllocation(MemoryAllocationPtr allocation)
+{
+    if (this->memoryAllocation != nullptr) {
+        return ErrorTypes::MemoryRangeAlreadyRegistered;
+    }
+    if (allocation == nullptr) {
+        return errors::New("Memory allocation is null");
+    }
+    this->memoryAllocation = allocation;
+    return nullptr;
+}
+
+error RdmaBuffer::RegisterExternalMemory(std::span<std::byte> memory, std::shared_ptr<void> lifetimeToken)
+{
+    if (this->memoryAllocation != nullptr) {
+        return ErrorTypes::MemoryRangeAlreadyRegistered;
+    }
+    if (memory.empty()) {
+        return errors::New("External memory is empty");
+    }
+
+    auto memoryHandle = doca::MemoryRangeHandle(reinterpret_cast<std::uint8_t *>(memory.data()), memory.size());
+
+    // Memory is owned by caller; allocation only keeps lifetime token alive and drops it on release
+    auto releaser = [token = std::move(lifetimeToken)](doca::MemoryRangeHandle) mutable { token.reset(); };
+    this->memoryAllocation = MemoryAllocation::Create(memoryHandle, std::move(releaser));
+    return nullptr;
+}
+
 error RdmaBuffer::MapMemory(doca::DevicePtr device, doca::AccessFlags permissions)
 {
+    // Buffer shared by several clients may be mapped by all of them at once; only first one maps it
+    std::lock_guard<std::mutex> lock(this->mappingMutex);
     if (this->memoryMap != nullptr) {
         return nullptr;  // Already mapped so do nothing
     }
 
-    if (this->memoryRange == nullptr) {
+    if (this->memoryAllocation == nullptr) {
         return ErrorTypes::MemoryRangeNotRegistered;
     }
 
+    const auto writeAccess = AccessFlags::localReadWrite | AccessFlags::rdmaWrite;
+    if (this->IsReadOnly() && static_cast<uint32_t>(permissions & writeAccess) != 0) {
+        return errors::Wrap(ErrorTypes::MemoryRangeReadOnly, "Write access requested for read-only memory");
+    }
+
+    // Buffer carved from arena shares memory map of whole arena, which is mapped once for all its buffers
+    if (this->arenaRegion != nullptr) {
+        auto err = this->arenaRegion->MapMemory(device, permissions);
+        if (err) {
+            return errors::Wrap(err, "Failed to map arena memory");
+        }
+        std::lock_guard<std::mutex> regionLock(this->arenaRegion->mappingMutex);
+        this->memoryMap = this->arenaRegion->memoryMap;
+        this->mappedRegion = this->arenaRegion->mappedRegion;
+        this->device = device;
+        return nullptr;
+    }
+
     auto [mmap, err] = doca::MemoryMap::Create()
                            .AddDevice(device)
-                           .SetMemoryRange(this->memoryRange)
+                           .SetMemoryRange(this->memoryAllocation->Memory())
                            .SetPermissions(permissions)
                            .Start();
     if (err) {
@@ -54,58 +181,195 @@ error RdmaBuffer::MapMemory(doca::DevicePtr device, doca::AccessFlags permission
 
     // Store memory map and device
     this->memoryMap = mmap;
+    this->mappedRegion = this->memoryAllocation->Memory();
     this->device = device;
+    this->descriptorGeneration = nextDescriptorGeneration();
+    this->exportedDescriptor = nullptr;
+
+    return nullptr;
+}
+
+error RdmaBuffer::MapMemory(doca::MemoryRegistrationCachePtr registrationCache, doca::AccessFlags permissions)
+{
+    std::lock_guard<std::mutex> lock(this->mappingMutex);
+    if (this->memoryMap != nullptr) {
+        return nullptr;  // Already mapped so do nothing
+    }
+
+    if (this->memoryAllocation == nullptr) {
+        return ErrorTypes::MemoryRangeNotRegistered;
+    }
+
+    if (registrationCache == nullptr) {
+        return errors::New("Registration cache is null");
+    }
+
+    const auto writeAccess = AccessFlags::localReadWrite | AccessFlags::rdmaWrite;
+    if (this->IsReadOnly() && static_cast<uint32_t>(permissions & writeAccess) != 0) {
+        return errors::Wrap(ErrorTypes::MemoryRangeReadOnly, "Write access requested for read-only memory");
+    }
+
+    if (this->arenaRegion != nullptr) {
+        auto err = this->arenaRegion->MapMemory(registrationCache, permissions);
+        if (err) {
+            return errors::Wrap(err, "Failed to map arena memory");
+        }
+        std::lock_guard<std::mutex> regionLock(this->arenaRegion->mappingMutex);
+        this->memoryMap = this->arenaRegion->memoryMap;
+        this->mappedRegion = this->arenaRegion->mappedRegion;
+        return nullptr;
+    }
+
+    auto [registration, err] =
+        registrationCache->Acquire(this->memoryAllocation->Memory(), permissions, this->memoryAllocation);
+    if (err) {
+        return errors::Wrap(err, "Failed to acquire memory registration");
+    }
+
+    // Store registration lease and its memory map
+    this->memoryRegistration = registration;
+    this->memoryMap = registration->GetMemoryMap();
+    this->mappedRegion = registration->GetRegisteredRange();
+    this->descriptorGeneration = nextDescriptorGeneration();
+    this->exportedDescriptor = nullptr;
 
     return nullptr;
 }
 
 std::tuple<doca::MemoryMapPtr, error> RdmaBuffer::GetMemoryMap()
 {
+    std::lock_guard<std::mutex> lock(this->mappingMutex);
     if (this->memoryMap == nullptr) {
         return { nullptr, errors::New("Memory map is null") };
     }
     return { this->memoryMap, nullptr };
 }
 
+bool RdmaBuffer::IsMapped() const
+{
+    std::lock_guard<std::mutex> lock(this->mappingMutex);
+    return this->memoryMap != nullptr;
+}
+
 std::tuple<MemoryRangePtr, error> RdmaBuffer::ExportMemoryDescriptor(doca::DevicePtr device)
 {
+    auto [descriptor, err] = this->GetExportedDescriptor();
+    if (err) {
+        return { nullptr, err };
+    }
+
+    // Copy descriptor data to new MemoryRange
+    auto descriptorData = std::make_shared<doca::MemoryRange>(descriptor->begin(), descriptor->end());
+
+    return { descriptorData, nullptr };
+}
+
+std::tuple<doca::rdma::RdmaMemoryDescriptorPtr, error> RdmaBuffer::GetExportedDescriptor()
+{
+    // Buffers carved from arena share descriptor of whole arena
+    if (this->arenaRegion != nullptr) {
+        if (!this->IsMapped()) {
+            return { nullptr, errors::New("Memory map is null") };
+        }
+        return this->arenaRegion->GetExportedDescriptor();
+    }
+
+    std::lock_guard<std::mutex> lock(this->mappingMutex);
     if (this->memoryMap == nullptr) {
         return { nullptr, errors::New("Memory map is null") };
     }
 
+    if (this->exportedDescriptor != nullptr) {
+        return { this->exportedDescriptor, nullptr };
+    }
+
     // Export memory descriptor from memory map
     auto [descriptor, err] = this->memoryMap->ExportRdma();
     if (err) {
         return { nullptr, errors::Wrap(err, "Failed to export memory descriptor") };
     }
+    this->exportedDescriptor = std::make_shared<const RdmaMemoryDescriptor>(std::move(descriptor));
 
-    // Copy descriptor data to new MemoryRange
-    auto descriptorData = std::make_shared<doca::MemoryRange>(descriptor.size());
-    std::ignore = std::copy(descriptor.begin(), descriptor.end(), descriptorData->begin());
-
-    return { descriptorData, nullptr };
+    return { this->exportedDescriptor, nullptr };
 }
 
 std::tuple<MemoryRangePtr, error> RdmaBuffer::GetMemoryRange()
 {
-    if (this->memoryRange == nullptr) {
+    if (this->memoryAllocation == nullptr) {
         return { nullptr, ErrorTypes::MemoryRangeNotRegistered };
     }
+    if (this->memoryRange == nullptr) {
+        return { nullptr, ErrorTypes::MemoryRangeNotVectorBacked };
+    }
     return { this->memoryRange, nullptr };
 }
 
+std::tuple<doca::MemoryRangeHandle, error> RdmaBuffer::GetMemorySpan()
+{
+    if (this->memoryAllocation == nullptr) {
+        return { {}, ErrorTypes::MemoryRangeNotRegistered };
+    }
+    return { this->memoryAllocation->Memory(), nullptr };
+}
+
+MemoryAllocationPtr RdmaBuffer::GetMemoryAllocation() const
+{
+    return this->memoryAllocation;
+}
+
 std::size_t RdmaBuffer::MemoryRangeSize() const
 {
-    if (this->memoryRange == nullptr) {
+    if (this->memoryAllocation == nullptr) {
         return 0;
     }
-    return this->memoryRange->size();
+    return this->memoryAllocation->Size();
+}
+
+bool RdmaBuffer::IsReadOnly() const
+{
+    return this->mappedFile != nullptr && this->mappedFile->AccessMode() == MappedFile::Mode::readOnly;
+}
+
+MappedFilePtr RdmaBuffer::GetMappedFile() const
+{
+    return this->mappedFile;
+}
+
+error RdmaBuffer::NotifyMemoryModified()
+{
+    if (this->mappedFile == nullptr) {
+        return nullptr;  // Only file backed memory needs flushing
+    }
+    return this->mappedFile->MarkModified();
+}
+
+std::uint64_t RdmaBuffer::DescriptorGeneration() const
+{
+    if (this->arenaRegion != nullptr) {
+        return this->arenaRegion->DescriptorGeneration();
+    }
+    std::lock_guard<std::mutex> lock(this->mappingMutex);
+    return this->descriptorGeneration;
+}
+
+std::size_t RdmaBuffer::RegionOffset() const
+{
+    std::lock_guard<std::mutex> lock(this->mappingMutex);
+    if (this->memoryAllocation == nullptr || this->mappedRegion.empty()) {
+        return 0;
+    }
+    return static_cast<std::size_t>(this->memoryAllocation->Memory().data() - this->mappedRegion.data());
+}
+
+RdmaBufferPtr RdmaBuffer::GetArenaRegion() const
+{
+    return this->arenaRegion;
 }
 
 RdmaRemoteBuffer::RdmaRemoteBuffer(RemoteMemoryMapPtr remoteMemoryMap) : memoryMap(remoteMemoryMap) {}
 
 std::tuple<RdmaRemoteBufferPtr, error> RdmaRemoteBuffer::FromExportedRemoteDescriptor(
-    std::vector<uint8_t> & descPayload, doca::DevicePtr device)
+    const std::vector<uint8_t> & descPayload, doca::DevicePtr device)
 {
     // Create memory map from exported descriptor
     auto [remoteMmap, mapErr] = doca::RemoteMemoryMap::CreateFromExport(descPayload, device);
@@ -131,6 +395,40 @@ std::tuple<RdmaRemoteBufferPtr, error> RdmaRemoteBuffer::FromExportedRemoteDescr
     return { remoteBuffer, nullptr };
 }
 
+std::tuple<RdmaRemoteBufferPtr, error> RdmaRemoteBuffer::FromRemoteMemoryMap(RemoteMemoryMapPtr remoteMemoryMap,
+                                                                            std::size_t offset, std::size_t length)
+{
+    if (remoteMemoryMap == nullptr) {
+        return { nullptr, errors::New("Remote memory map is null") };
+    }
+
+    auto [remoteMemrange, rgnErr] = remoteMemoryMap->GetRemoteMemoryRange();
+    if (rgnErr) {
+        return { nullptr, errors::Wrap(rgnErr, "Failed to get memory range from remote memory map") };
+    }
+
+    if (offset > remoteMemrange.size()) {
+        return { nullptr, errors::New(std::format("Offset {} is out of remote memory region of {} bytes", offset,
+                                                  remoteMemrange.size())) };
+    }
+    if (length == 0) {
+        length = remoteMemrange.size() - offset;
+    }
+    if (length > remoteMemrange.size() - offset) {
+        return { nullptr, errors::New(std::format("Range of {} bytes at offset {} is out of remote memory region of "
+                                                  "{} bytes",
+                                                  length, offset, remoteMemrange.size())) };
+    }
+
+    auto remoteBuffer = std::make_shared<RdmaRemoteBuffer>(remoteMemoryMap);
+    auto err = remoteBuffer->RegisterRemoteMemoryRange(remoteMemrange.subspan(offset, length));
+    if (err) {
+        return { nullptr, errors::Wrap(err, "Failed to register memory range to remote buffer") };
+    }
+
+    return { remoteBuffer, nullptr };
+}
+
 error RdmaRemoteBuffer::RegisterRemoteMemoryRange(RemoteMemoryRangeHandle memoryRange)
 {
     if (this->memoryRange != nullptr) {
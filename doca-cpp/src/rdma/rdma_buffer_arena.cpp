@@ -0,0 +1,136 @@
+#include "doca-cpp/rdma/rdma_buffer_arena.hpp"
+
+using doca::MemoryAllocation;
+using doca::MemoryRangeHandle;
+using doca::rdma::RdmaBuffer;
+using doca::rdma::RdmaBufferArena;
+using doca::rdma::RdmaBufferArenaPtr;
+using doca::rdma::RdmaBufferPtr;
+
+namespace constants
+{
+/// @brief Alignment of slot offsets within arena; keeps buffers of page aligned arena from sharing cache lines
+constexpr std::size_t slotAlignment = 64;
+}  // namespace constants
+
+std::tuple<RdmaBufferArenaPtr, error> RdmaBufferArena::Create(const Config & config)
+{
+    if (config.capacity == 0) {
+        return { nullptr, errors::New("Arena capacity is zero") };
+    }
+    if (config.sizeClasses.empty()) {
+        return { nullptr, errors::New("Arena has no size classes") };
+    }
+
+    auto sizeClasses = config.sizeClasses;
+    std::ranges::sort(sizeClasses);
+    for (const auto sizeClass : sizeClasses) {
+        if (sizeClass == 0 || sizeClass % constants::slotAlignment != 0) {
+            return { nullptr, errors::New(std::format("Size class {} is not multiple of slot alignment {}", sizeClass,
+                                                      constants::slotAlignment)) };
+        }
+    }
+
+    auto allocator = config.allocator;
+    if (allocator == nullptr) {
+        auto [alignedAllocator, allocatorErr] = doca::AlignedMemoryAllocator::Create({});
+        if (allocatorErr) {
+            return { nullptr, errors::Wrap(allocatorErr, "Failed to create arena memory allocator") };
+        }
+        allocator = alignedAllocator;
+    }
+
+    auto [region, err] = RdmaBuffer::FromAllocator(allocator, config.capacity);
+    if (err) {
+        return { nullptr, errors::Wrap(err, "Failed to allocate arena memory") };
+    }
+
+    return { std::make_shared<RdmaBufferArena>(std::move(sizeClasses), region), nullptr };
+}
+
+RdmaBufferArena::RdmaBufferArena(std::vector<std::size_t> initialSizeClasses, RdmaBufferPtr initialRegion)
+    : sizeClasses(std::move(initialSizeClasses)), region(initialRegion), freeSlots(this->sizeClasses.size())
+{
+}
+
+std::tuple<RdmaBufferPtr, error> RdmaBufferArena::Allocate(std::size_t size)
+{
+    if (size == 0) {
+        return { nullptr, errors::New("Requested buffer size is zero") };
+    }
+
+    // Find smallest size class fitting requested size
+    const auto sizeClass = std::ranges::lower_bound(this->sizeClasses, size);
+    if (sizeClass == this->sizeClasses.end()) {
+        return { nullptr, errors::New(std::format("Requested buffer size {} exceeds largest size class {}", size,
+                                                  this->sizeClasses.back())) };
+    }
+    const auto sizeClassIndex = static_cast<std::size_t>(sizeClass - this->sizeClasses.begin());
+
+    auto [regionMemory, memErr] = this->region->GetMemorySpan();
+    if (memErr) {
+        return { nullptr, errors::Wrap(memErr, "Failed to get arena memory") };
+    }
+
+    // Reuse freed slot of the same size class or carve new one from untouched memory
+    std::size_t offset = 0;
+    {
+        std::lock_guard<std::mutex> lock(this->arenaMutex);
+        auto & freeList = this->freeSlots[sizeClassIndex];
+        if (!freeList.empty()) {
+            offset = freeList.back();
+            freeList.pop_back();
+        } else {
+            if (*sizeClass > regionMemory.size() - this->carvedBytes) {
+                const auto message =
+                    std::format("Arena is exhausted: {} of {} bytes carved", this->carvedBytes, regionMemory.size());
+                return { nullptr, errors::New(message) };
+            }
+            offset = this->carvedBytes;
+            this->carvedBytes += *sizeClass;
+        }
+        this->buffersInUse++;
+    }
+
+    // Allocation gives slot back to arena when buffer is destroyed; it keeps arena and its memory alive until then
+    auto releaser = [arena = this->shared_from_this(), sizeClassIndex, offset](MemoryRangeHandle) {
+        arena->releaseSlot(sizeClassIndex, offset);
+    };
+    auto allocation = MemoryAllocation::Create(regionMemory.subspan(offset, size), std::move(releaser));
+
+    auto buffer = std::make_shared<RdmaBuffer>();
+    auto err = buffer->RegisterMemoryAllocation(allocation);
+    if (err) {
+        return { nullptr, errors::Wrap(err, "Failed to register arena slot to buffer") };
+    }
+    buffer->arenaRegion = this->region;
+
+    return { buffer, nullptr };
+}
+
+RdmaBufferPtr RdmaBufferArena::Region() const
+{
+    return this->region;
+}
+
+RdmaBufferArena::Statistics RdmaBufferArena::GetStatistics() const
+{
+    std::lock_guard<std::mutex> lock(this->arenaMutex);
+
+    auto statistics = Statistics{
+        .capacity = this->region->MemoryRangeSize(),
+        .carvedBytes = this->carvedBytes,
+        .buffersInUse = this->buffersInUse,
+    };
+    for (const auto & freeList : this->freeSlots) {
+        statistics.freeSlots += freeList.size();
+    }
+    return statistics;
+}
+
+void RdmaBufferArena::releaseSlot(std::size_t sizeClassIndex, std::size_t offset)
+{
+    std::lock_guard<std::mutex> lock(this->arenaMutex);
+    this->freeSlots[sizeClassIndex].push_back(offset);
+    this->buffersInUse--;
+}
@@ -16,6 +16,7 @@ DOCA_CPP_DEFINE_LOGGER(loggerConfig, loggerContext)
 
 using doca::rdma::RdmaEndpointId;
 using doca::rdma::RdmaEndpointPath;
+using doca::rdma::RdmaEndpointPtr;
 using doca::rdma::RdmaEndpointType;
 
 using doca::rdma::RdmaClient;
@@ -23,6 +24,9 @@ using doca::rdma::RdmaClientPtr;
 
 using doca::rdma::RdmaBufferPtr;
 
+using doca::rdma::RdmaControlAddress;
+using doca::rdma::RdmaSessionClientPtr;
+
 // ----------------------------------------------------------------------------
 // RdmaClient
 // ----------------------------------------------------------------------------
@@ -40,6 +44,20 @@ std::tuple<RdmaClientPtr, error> doca::rdma::RdmaClient::Create(doca::DevicePtr
 
 RdmaClient::RdmaClient(doca::DevicePtr initialDevice) : device(initialDevice) {}
 
+RdmaClient::~RdmaClient()
+{
+    this->stopEventLoop();
+
+    // Let session reader see closed socket and release session before event loop is destroyed
+    if (this->session != nullptr) {
+        this->session->Close();
+    }
+    if (this->ioContext != nullptr) {
+        this->ioContext->restart();
+        this->ioContext->poll();
+    }
+}
+
 error RdmaClient::Connect(const std::string & serverAddress, uint16_t serverPort)
 
 {
@@ -49,12 +67,26 @@ error RdmaClient::Connect(const std::string & serverAddress, uint16_t serverPort
     }
 
     // Map all buffers in endpoints before serving
-    auto mapErr = this->endpointsStorage->MapEndpointsMemory(this->device);
+    auto mapErr = this->endpointsStorage->MapEndpointsMemory(this->device, this->mappingConfig);
     if (mapErr) {
         return errors::Wrap(mapErr, "Failed to map endpoints memory");
     }
 
-    DOCA_CPP_LOG_DEBUG("Mapped all endpoint buffers");
+    const auto mappingReport = this->endpointsStorage->GetMappingReport();
+    if (this->mappingConfig.policy != RdmaEndpointStorage::MappingPolicy::eager) {
+        // Memory is mapped in background, so timing is not known yet
+        DOCA_CPP_LOG_INFO(std::format("Mapping {} endpoint buffers in background", mappingReport.endpoints.size()));
+    } else {
+        DOCA_CPP_LOG_INFO(std::format("Mapped {} endpoint buffers in {} us using {} threads",
+                                      mappingReport.endpoints.size(), mappingReport.totalTime.count(),
+                                      mappingReport.numThreads));
+    }
+    for (const auto & endpointTime : mappingReport.endpoints) {
+        DOCA_CPP_LOG_DEBUG(std::format("Endpoint {} slot {}: {} bytes, prefault {} us, registration {} us{}",
+                                       endpointTime.endpointId, endpointTime.slotIndex, endpointTime.bytes,
+                                       endpointTime.prefaultTime.count(), endpointTime.registrationTime.count(),
+                                       endpointTime.sharedMapping ? ", shared mapping" : ""));
+    }
 
     // Create Executor
     auto [executor, err] = RdmaExecutor::Create(this->device);
@@ -83,6 +115,28 @@ error RdmaClient::Connect(const std::string & serverAddress, uint16_t serverPort
 
     this->serverAddress = serverAddress;
 
+    // Remote memory imported from previous server connection is not valid anymore
+    this->remoteBufferCache = RdmaRemoteBufferCache::Create();
+
+    // Session of previous connection belongs to previous event loop
+    this->stopEventLoop();
+    if (this->session != nullptr) {
+        this->session->Close();
+        this->session = nullptr;
+    }
+
+    // Open control session once; requests reuse it instead of connecting every time
+    err = this->startEventLoop();
+    if (err) {
+        return errors::Wrap(err, "Failed to start client event loop");
+    }
+    err = this->runOnEventLoop(this->openSession());
+    if (err) {
+        return errors::Wrap(err, "Failed to open control session");
+    }
+
+    DOCA_CPP_LOG_INFO("Client opened control session");
+
     return nullptr;
 }
 
@@ -104,76 +158,403 @@ error RdmaClient::RegisterEndpoints(std::vector<RdmaEndpointPtr> & endpoints)
     return nullptr;
 }
 
+error RdmaClient::SetControlAddress(const std::string & address)
+{
+    auto [controlAddress, err] = RdmaControlAddress::Parse(address);
+    if (err) {
+        return errors::Wrap(err, "Invalid control address");
+    }
+    this->controlAddress = controlAddress;
+    return nullptr;
+}
+
+void RdmaClient::SetEndpointMapping(const RdmaEndpointStorage::MappingConfig & config)
+{
+    this->mappingConfig = config;
+}
+
 error RdmaClient::RequestEndpointProcessing(const RdmaEndpointId & endpointId)
+{
+    return this->RequestEndpointProcessingAsync(endpointId).get();
+}
+
+std::future<error> RdmaClient::RequestEndpointProcessingAsync(const RdmaEndpointId & endpointId)
 {
     DOCA_CPP_LOG_DEBUG("Endpoint processing requested");
 
+    auto [endpoint, epErr] = this->prepareEndpoint(endpointId);
+    if (epErr) {
+        std::promise<error> rejected;
+        rejected.set_value(epErr);
+        return rejected.get_future();
+    }
+
+    return this->submitEndpoint(endpoint);
+}
+
+error RdmaClient::RequestEndpointsProcessing(const std::vector<RdmaEndpointId> & endpointIds)
+{
+    DOCA_CPP_LOG_DEBUG(std::format("Processing of {} endpoints requested", endpointIds.size()));
+
+    // Every endpoint has one local buffer, so it can not be in flight twice
+    auto uniqueIds = endpointIds;
+    std::ranges::sort(uniqueIds);
+    if (std::ranges::adjacent_find(uniqueIds) != uniqueIds.end()) {
+        return errors::New("Endpoint is requested more than once");
+    }
+
+    std::vector<RdmaEndpointPtr> endpoints;
+    endpoints.reserve(endpointIds.size());
+    for (const auto & endpointId : endpointIds) {
+        auto [endpoint, epErr] = this->prepareEndpoint(endpointId);
+        if (epErr) {
+            return epErr;
+        }
+        endpoints.push_back(endpoint);
+    }
+
+    // All requests are outstanding in session at once; server answers them in order of completion
+    std::vector<std::future<error>> results;
+    results.reserve(endpoints.size());
+    for (auto & endpoint : endpoints) {
+        results.push_back(this->submitEndpoint(endpoint));
+    }
+
+    error requestsErr = nullptr;
+    for (auto & result : results) {
+        auto err = result.get();
+        if (err) {
+            requestsErr = requestsErr ? errors::Join(requestsErr, err) : err;
+        }
+    }
+    if (requestsErr) {
+        return errors::Wrap(requestsErr, "Failed to process endpoints");
+    }
+    return nullptr;
+}
+
+error RdmaClient::RequestEndpointGroupProcessing(const std::vector<RdmaEndpointId> & endpointIds)
+{
+    return this->RequestEndpointGroupProcessingAsync(endpointIds).get();
+}
+
+std::future<error> RdmaClient::RequestEndpointGroupProcessingAsync(const std::vector<RdmaEndpointId> & endpointIds)
+{
+    DOCA_CPP_LOG_DEBUG(std::format("Processing of group of {} endpoints requested", endpointIds.size()));
+
+    auto reject = [](error err) {
+        std::promise<error> rejected;
+        rejected.set_value(err);
+        return rejected.get_future();
+    };
+
+    if (endpointIds.empty()) {
+        return reject(errors::New("Endpoint group is empty"));
+    }
+
+    std::vector<RdmaEndpointPtr> endpoints;
+    endpoints.reserve(endpointIds.size());
+    for (const auto & endpointId : endpointIds) {
+        auto [endpoint, epErr] = this->prepareEndpoint(endpointId);
+        if (epErr) {
+            return reject(epErr);
+        }
+        endpoints.push_back(endpoint);
+    }
+
+    // Server locks one slot per path, so group can not hold path twice
+    std::vector<RdmaEndpointPath> paths;
+    paths.reserve(endpoints.size());
+    for (const auto & endpoint : endpoints) {
+        paths.push_back(endpoint->Path());
+    }
+    std::ranges::sort(paths);
+    if (std::ranges::adjacent_find(paths) != paths.end()) {
+        return reject(errors::New("Endpoints of group must have different paths"));
+    }
+
+    // Group is in flight as a whole, so none of its endpoints can be in flight already
+    {
+        std::lock_guard<std::mutex> lock(this->inflightMutex);
+        for (const auto & endpointId : endpointIds) {
+            if (this->inflightEndpoints.contains(endpointId)) {
+                return reject(errors::New("Endpoint " + endpointId + " is already in flight"));
+            }
+        }
+        this->inflightEndpoints.insert(endpointIds.begin(), endpointIds.end());
+    }
+    return this->spawnOnEventLoop(this->processGroup(std::move(endpoints)));
+}
+
+std::future<error> RdmaClient::submitEndpoint(RdmaEndpointPtr endpoint)
+{
+    const auto endpointId = doca::rdma::MakeEndpointId(endpoint);
+    {
+        std::lock_guard<std::mutex> lock(this->inflightMutex);
+        if (!this->inflightEndpoints.insert(endpointId).second) {
+            std::promise<error> rejected;
+            rejected.set_value(errors::New("Endpoint " + endpointId + " is already in flight"));
+            return rejected.get_future();
+        }
+    }
+    return this->spawnOnEventLoop(this->processEndpoint(endpoint));
+}
+
+asio::awaitable<error> RdmaClient::processEndpoint(RdmaEndpointPtr endpoint)
+{
+    const auto endpointId = doca::rdma::MakeEndpointId(endpoint);
+    auto inflightDeferred = defer::MakeDefer([this, endpointId]() {
+        std::lock_guard<std::mutex> lock(this->inflightMutex);
+        this->inflightEndpoints.erase(endpointId);
+    });
+
+    // Closed session is reopened; request that did not reach server over reused session is sent again
+    for (std::size_t attempt = 1;; attempt++) {
+        auto [session, sessionErr] = co_await this->acquireSession();
+        if (sessionErr) {
+            co_return errors::Wrap(sessionErr, "Failed to reopen control session");
+        }
+
+        auto err =
+            co_await doca::rdma::HandleClientSession(session, endpoint, this->executor, this->remoteBufferCache);
+        if (err && errors::Is(err, ErrorTypes::RequestNotDelivered) && attempt < constants::RequestDeliveryAttempts) {
+            DOCA_CPP_LOG_DEBUG(std::format("Request was not delivered, retrying: {}", err->What()));
+            continue;
+        }
+        if (err) {
+            DOCA_CPP_LOG_ERROR(std::format("Session ended with failure: {}", err->What()));
+            co_return errors::Wrap(err, "Failed to process endpoint " + endpointId);
+        }
+        co_return nullptr;
+    }
+}
+
+asio::awaitable<error> RdmaClient::processGroup(std::vector<RdmaEndpointPtr> endpoints)
+{
+    auto inflightDeferred = defer::MakeDefer([this, &endpoints]() {
+        std::lock_guard<std::mutex> lock(this->inflightMutex);
+        for (const auto & endpoint : endpoints) {
+            this->inflightEndpoints.erase(doca::rdma::MakeEndpointId(endpoint));
+        }
+    });
+
+    // Closed session is reopened; group that did not reach server over reused session is sent again
+    for (std::size_t attempt = 1;; attempt++) {
+        auto [session, sessionErr] = co_await this->acquireSession();
+        if (sessionErr) {
+            co_return errors::Wrap(sessionErr, "Failed to reopen control session");
+        }
+
+        auto err = co_await doca::rdma::HandleClientGroup(session, endpoints, this->executor, this->remoteBufferCache);
+        if (err && errors::Is(err, ErrorTypes::RequestNotDelivered) && attempt < constants::RequestDeliveryAttempts) {
+            DOCA_CPP_LOG_DEBUG(std::format("Group request was not delivered, retrying: {}", err->What()));
+            continue;
+        }
+        if (err) {
+            DOCA_CPP_LOG_ERROR(std::format("Group session ended with failure: {}", err->What()));
+            co_return errors::Wrap(err, "Failed to process endpoint group");
+        }
+        co_return nullptr;
+    }
+}
+
+std::tuple<RdmaEndpointPtr, error> RdmaClient::prepareEndpoint(const RdmaEndpointId & endpointId)
+{
     if (this->executor == nullptr) {
-        return errors::New("RDMA executor is null");
+        return { nullptr, errors::New("RDMA executor is null") };
+    }
+    if (this->ioContext == nullptr) {
+        return { nullptr, errors::New("Client is not connected to server; connect first") };
     }
 
     // Check if there are registered endpoints
     if (this->endpointsStorage == nullptr || this->endpointsStorage->Empty()) {
-        return errors::New("No endpoints to process; register endpoints before serving");
+        return { nullptr, errors::New("No endpoints to process; register endpoints before serving") };
     }
 
     // Try get endpoint from storage
     auto [endpoint, epErr] = this->endpointsStorage->GetEndpoint(endpointId);
     if (epErr) {
-        return errors::New("Endpoint with given ID is not registered in client");
+        return { nullptr, errors::New("Endpoint with given ID is not registered in client") };
     }
 
     DOCA_CPP_LOG_DEBUG("Fetched endpoint from storage");
 
-    // Create Asio io_context (event loop)
-    asio::io_context ioContext;
+    // Endpoint mapped on demand or not prewarmed yet is mapped now; other endpoints are not waited for
+    auto mapErr = this->endpointsStorage->EnsureEndpointMapped(endpointId);
+    if (mapErr) {
+        return { nullptr, errors::Wrap(mapErr, "Failed to map endpoint memory") };
+    }
 
-    // Create communication session
-    auto session = RdmaSessionClient::Create(std::move(asio::ip::tcp::socket{ ioContext }));
+    return { endpoint, nullptr };
+}
 
-    DOCA_CPP_LOG_DEBUG("Created communication session via socket");
+asio::awaitable<error> RdmaClient::openSession()
+{
+    if (this->session != nullptr) {
+        this->session->Close();
+    }
+    auto session = RdmaSessionClient::Create();
+    this->session = session;
 
-    // Capture required variables
-    auto rdmaExecutor = this->executor;
+    auto address = this->controlAddress.value_or(RdmaControlAddress{});
+    if (address.scheme == RdmaControlAddress::Scheme::tcp && address.host.empty()) {
+        address.host = this->serverAddress;
+    }
+    auto err = co_await session->Connect(address);
+    if (err) {
+        co_return errors::Wrap(err, "Failed to connect to server via control channel " + address.ToString());
+    }
 
-    error processingError = nullptr;
+    // Descriptors are exchanged once per session, so requests carry only endpoint number and slot location
+    err = co_await doca::rdma::HandleClientCatalog(session, this->endpointsStorage, this->executor,
+                                                   this->remoteBufferCache);
+    if (err) {
+        session->Close();
+        co_return errors::Wrap(err, "Failed to fetch server endpoint catalog");
+    }
+    co_return nullptr;
+}
 
-    // Spawn coroutine to connect to server and start performing request
-    asio::co_spawn(
-        ioContext,
-        [&]() -> asio::awaitable<void> {
-            // Connect to server via TCP
-            auto err = co_await session->Connect(this->serverAddress, communication::Port);
-            if (err) {
-                processingError = errors::Wrap(err, "Failed to connect to server via TCP communication channel");
-                co_return;
-            }
+asio::awaitable<std::tuple<RdmaSessionClientPtr, error>> RdmaClient::acquireSession()
+{
+    // Coroutines run on one event loop thread, so session state needs no lock, only waiting for reopening
+    while (this->sessionOpening) {
+        std::ignore = co_await this->sessionOpenedTimer->async_wait(asio::as_tuple(asio::use_awaitable));
+    }
+    if (this->session != nullptr && this->session->IsOpen()) {
+        co_return std::make_tuple(this->session, error{ nullptr });
+    }
 
-            DOCA_CPP_LOG_DEBUG("Connected to communication session");
+    this->sessionOpening = true;
+    auto err = co_await this->openSession();
+    this->sessionOpening = false;
+    this->sessionOpenedTimer->cancel();
+    if (err) {
+        co_return std::make_tuple(RdmaSessionClientPtr{ nullptr }, err);
+    }
 
-            // Spawn session handler for RDMA performing
-            asio::co_spawn(
-                co_await asio::this_coro::executor, doca::rdma::HandleClientSession(session, endpoint, rdmaExecutor),
-                [&processingError](std::exception_ptr exception, error handleError) -> void {
-                    processingError = handleError;
-                    if (processingError) {
-                        DOCA_CPP_LOG_ERROR(std::format("Session ended with failure: {}", processingError->What()));
-                    }
-                });
-        },
-        asio::detached);
+    DOCA_CPP_LOG_DEBUG("Reopened control session");
+    co_return std::make_tuple(this->session, error{ nullptr });
+}
+
+std::future<error> RdmaClient::spawnOnEventLoop(asio::awaitable<error> task)
+{
+    auto promise = std::make_shared<std::promise<error>>();
+    auto future = promise->get_future();
+
+    asio::co_spawn(*this->ioContext, std::move(task), [promise](std::exception_ptr exception, error err) -> void {
+        if (exception) {
+            err = errors::New("Control session coroutine threw exception");
+        }
+        promise->set_value(err);
+    });
+    return future;
+}
 
-    DOCA_CPP_LOG_DEBUG("Spawned handling coroutine");
+error RdmaClient::runOnEventLoop(asio::awaitable<error> task)
+{
+    std::vector<asio::awaitable<error>> tasks;
+    tasks.push_back(std::move(task));
+    return this->runOnEventLoop(std::move(tasks));
+}
 
-    while (!ioContext.stopped()) {
-        this->executor->Progress();
-        ioContext.poll();
+error RdmaClient::runOnEventLoop(std::vector<asio::awaitable<error>> tasks)
+{
+    std::vector<std::future<error>> results;
+    results.reserve(tasks.size());
+    for (auto & task : tasks) {
+        results.push_back(this->spawnOnEventLoop(std::move(task)));
     }
 
-    if (processingError) {
-        DOCA_CPP_LOG_ERROR("Endpoint processing failed");
-        return errors::Wrap(processingError, "Failed to process endpoint");
+    error tasksErr = nullptr;
+    for (auto & result : results) {
+        auto err = result.get();
+        if (err) {
+            tasksErr = tasksErr ? errors::Join(tasksErr, err) : err;
+        }
     }
+    return tasksErr;
+}
 
+error RdmaClient::startEventLoop()
+{
+    // Timer and work guard refer to event loop, so they go before it
+    this->sessionOpenedTimer = nullptr;
+    this->workGuard.reset();
+
+    this->ioContext = std::make_unique<asio::io_context>();
+    this->workGuard.emplace(this->ioContext->get_executor());
+    this->sessionOpenedTimer =
+        std::make_unique<asio::steady_timer>(*this->ioContext, asio::steady_timer::time_point::max());
+    this->sessionOpening = false;
+
+    // Progress engine notification handle is waited for together with control session, so idle client takes no CPU
+    auto [handle, handleErr] = this->executor->GetProgressNotificationHandle();
+    if (handleErr) {
+        return errors::Wrap(handleErr, "Failed to get progress engine notification handle");
+    }
+    this->progressNotifier.emplace(*this->ioContext, handle);
+    asio::co_spawn(*this->ioContext, this->progressOnEvents(this->executor, handle),
+                   [](std::exception_ptr exception, error progressErr) -> void {
+                       if (progressErr) {
+                           DOCA_CPP_LOG_ERROR(
+                               std::format("Stopped waiting for progress engine events: {}", progressErr->What()));
+                       }
+                   });
+
+    this->eventLoopThread = std::thread([this]() { this->runEventLoop(); });
     return nullptr;
-}
\ No newline at end of file
+}
+
+void RdmaClient::stopEventLoop()
+{
+    if (this->ioContext != nullptr) {
+        this->workGuard.reset();
+        this->ioContext->stop();
+    }
+    if (this->eventLoopThread.joinable()) {
+        this->eventLoopThread.join();
+    }
+
+    // Handle is owned by progress engine, so it is released, not closed
+    if (this->progressNotifier.has_value()) {
+        std::ignore = this->progressNotifier->release();
+        this->progressNotifier.reset();
+    }
+}
+
+void RdmaClient::runEventLoop()
+{
+    // Event loop sleeps until control session or progress engine has events
+    try {
+        this->ioContext->run();
+    } catch (const std::exception & exception) {
+        DOCA_CPP_LOG_ERROR(std::format("Caught exception in client event loop: {}", exception.what()));
+    }
+}
+
+asio::awaitable<error> RdmaClient::progressOnEvents(RdmaExecutorPtr rdmaExecutor, doca_notification_handle_t handle)
+{
+    while (true) {
+        // Events are drained before notification is armed: events already pending do not notify
+        while (rdmaExecutor->Progress() > 0) {
+        }
+        auto err = rdmaExecutor->RequestProgressNotification();
+        if (err) {
+            co_return errors::Wrap(err, "Failed to arm progress engine notification");
+        }
+
+        auto [waitErr] = co_await this->progressNotifier->async_wait(asio::posix::stream_descriptor::wait_read,
+                                                                     asio::as_tuple(asio::use_awaitable));
+        if (waitErr) {
+            // Wait is aborted when notifier is released on stop
+            co_return nullptr;
+        }
+
+        err = rdmaExecutor->ClearProgressNotification(handle);
+        if (err) {
+            co_return errors::Wrap(err, "Failed to clear progress engine notification");
+        }
+    }
+}
@@ -51,11 +51,34 @@ RdmaEndpoint::Builder & RdmaEndpoint::Builder::SetBuffer(RdmaEndpointBufferPtr b
     return *this;
 }
 
+RdmaEndpoint::Builder & RdmaEndpoint::Builder::SetSlotBuffers(std::vector<RdmaEndpointBufferPtr> buffers)
+{
+    if (buffers.empty()) {
+        this->buildErr = errors::Wrap(this->buildErr, "RDMA endpoint has no buffer slots");
+    }
+    if (std::ranges::find(buffers, nullptr) != buffers.end()) {
+        this->buildErr = errors::Wrap(this->buildErr, "RDMA buffer of endpoint slot is null");
+    }
+    this->endpointConfig.buffer = buffers.empty() ? nullptr : buffers.front();
+    this->endpointConfig.slotBuffers = std::move(buffers);
+    return *this;
+}
+
+RdmaEndpoint::Builder & RdmaEndpoint::Builder::SetMappingPriority(int priority)
+{
+    this->endpointConfig.mappingPriority = priority;
+    return *this;
+}
+
 std::tuple<RdmaEndpointPtr, error> RdmaEndpoint::Builder::Build()
 {
     if (this->buildErr) {
         return { nullptr, errors::Wrap(this->buildErr, "Failed to build RDMA endpoint") };
     }
+    // Endpoint with single buffer has one slot
+    if (this->endpointConfig.slotBuffers.empty()) {
+        this->endpointConfig.slotBuffers.push_back(this->endpointConfig.buffer);
+    }
     auto rdmaEndpoint = std::make_shared<RdmaEndpoint>(this->device, this->endpointConfig);
     return { rdmaEndpoint, nullptr };
 }
@@ -89,6 +112,24 @@ RdmaEndpointBufferPtr RdmaEndpoint::Buffer()
     return this->config.buffer;
 }
 
+RdmaEndpointBufferPtr RdmaEndpoint::SlotBuffer(std::size_t slotIndex)
+{
+    if (slotIndex >= this->config.slotBuffers.size()) {
+        return nullptr;
+    }
+    return this->config.slotBuffers[slotIndex];
+}
+
+std::size_t RdmaEndpoint::SlotCount() const
+{
+    return this->config.slotBuffers.size();
+}
+
+int RdmaEndpoint::MappingPriority() const
+{
+    return this->config.mappingPriority;
+}
+
 error RdmaEndpoint::RegisterService(RdmaServiceInterfacePtr service)
 {
     if (service == nullptr) {
@@ -164,91 +205,413 @@ error RdmaEndpointStorage::RegisterEndpoint(RdmaEndpointPtr endpoint)
 
     const RdmaEndpointId endpointId = doca::rdma::MakeEndpointId(endpoint);
 
+    std::scoped_lock lock(this->endpointsMutex, this->slotsMutex);
     if (this->endpointsMap.contains(endpointId)) {
         return errors::New("RDMA endpoint with the same ID already registered: " + endpointId);
     }
 
+    // Endpoints sharing path share slot locks, so they must have the same number of slots
+    const auto slotCount = endpoint->SlotCount();
+    auto [pathSlots, newPath] = this->slotsByPath.try_emplace(endpoint->Path());
+    if (newPath) {
+        pathSlots->second.slotLocked.assign(slotCount, false);
+    } else if (pathSlots->second.slotLocked.size() != slotCount) {
+        return errors::New(std::format("RDMA endpoint {} has {} slots while other endpoints with its path have {}",
+                                       endpointId, slotCount, pathSlots->second.slotLocked.size()));
+    }
+
     auto storedEndpoint = std::make_shared<StoredEndpoint>();
     storedEndpoint->endpoint = endpoint;
-    storedEndpoint->endpointLocked.store(false);
+    storedEndpoint->endpointNumber = static_cast<std::uint32_t>(this->endpointIdsByNumber.size() + 1);
 
     auto [_, inserted] = this->endpointsMap.emplace(endpointId, storedEndpoint);
     if (!inserted) {
         return errors::New("Failed to insert RDMA endpoint to internal storage");
     }
+    this->endpointIdsByNumber.push_back(endpointId);
 
     return nullptr;
 }
 
 std::tuple<RdmaEndpointPtr, error> RdmaEndpointStorage::GetEndpoint(const RdmaEndpointId & endpointId)
 {
-    if (!this->endpointsMap.contains(endpointId)) {
+    std::shared_lock lock(this->endpointsMutex);
+    auto found = this->endpointsMap.find(endpointId);
+    if (found == this->endpointsMap.end()) {
         return { nullptr, errors::New("RDMA endpoint with given ID is not registered: " + endpointId) };
     }
+    return { found->second->endpoint, nullptr };
+}
 
-    auto & storedEndpoint = this->endpointsMap.at(endpointId);
-    return { storedEndpoint->endpoint, nullptr };
+std::vector<RdmaEndpointId> RdmaEndpointStorage::ListEndpoints() const
+{
+    std::shared_lock lock(this->endpointsMutex);
+    return this->endpointIdsByNumber;
+}
+
+std::tuple<RdmaEndpointId, error> RdmaEndpointStorage::GetEndpointIdByNumber(std::uint32_t endpointNumber) const
+{
+    std::shared_lock lock(this->endpointsMutex);
+    if (endpointNumber == 0 || endpointNumber > this->endpointIdsByNumber.size()) {
+        return { RdmaEndpointId(),
+                 errors::New(std::format("RDMA endpoint with given number is not registered: {}", endpointNumber)) };
+    }
+    return { this->endpointIdsByNumber.at(endpointNumber - 1), nullptr };
 }
 
 bool RdmaEndpointStorage::Contains(const RdmaEndpointId & endpointId) const
 {
+    std::shared_lock lock(this->endpointsMutex);
     return this->endpointsMap.contains(endpointId);
 }
 
 bool RdmaEndpointStorage::Empty() const
 {
+    std::shared_lock lock(this->endpointsMutex);
     return this->endpointsMap.empty();
 }
 
 error RdmaEndpointStorage::MapEndpointsMemory(doca::DevicePtr device)
 {
+    return this->MapEndpointsMemory(device, MappingConfig{});
+}
+
+error RdmaEndpointStorage::MapEndpointsMemory(doca::DevicePtr device, const MappingConfig & config)
+{
+    using Clock = std::chrono::steady_clock;
+
+    const auto mappingStart = Clock::now();
+
+    // Stop mapping thread of previous call before regions are planned again
+    this->mappingThread = std::jthread();
+
+    this->mappingDevice = device;
+    this->mappingConfig = config;
     {
-        for (auto & [_, element] : this->endpointsMap) {
-            auto err = element->endpoint->Buffer()->MapMemory(
-                device, doca::AccessFlags::localReadWrite | doca::AccessFlags::rdmaRead | doca::AccessFlags::rdmaWrite);
+        std::unique_lock lock(this->endpointsMutex);
+        this->planRegions();
+    }
+
+    const auto requestedThreads = this->mappingThreads();
+    const auto numRegions = std::max<std::size_t>(1, this->regions.size());
+
+    if (config.policy != MappingPolicy::eager) {
+        {
+            std::lock_guard<std::mutex> lock(this->queueMutex);
+            this->mappingQueue.clear();
+            // On-demand policy maps only requested regions, so there is nothing to prewarm
+            this->nextPrewarmRegion = config.policy == MappingPolicy::prewarm ? 0 : this->regions.size();
+        }
+        this->mappingThread = std::jthread([this](std::stop_token stopToken) { this->runMappingThread(stopToken); });
+
+        // Mapping goes on in background, so there is no total to report; per-endpoint entries fill as regions map
+        return nullptr;
+    }
+
+    const auto numThreads = std::min(requestedThreads, numRegions);
+    // Threads left idle by few large buffers help to prefault them
+    const auto prefaultThreads = std::max<std::size_t>(1, requestedThreads / numRegions);
+
+    // Workers take regions one by one, so large and small buffers are balanced between threads
+    {
+        std::atomic_size_t nextRegion = 0;
+        auto worker = [this, &nextRegion, prefaultThreads]() {
+            for (auto index = nextRegion.fetch_add(1); index < this->regions.size(); index = nextRegion.fetch_add(1)) {
+                std::ignore = this->mapRegion(this->regions[index], prefaultThreads);
+            }
+        };
+
+        std::vector<std::jthread> threads;
+        threads.reserve(numThreads - 1);
+        for (std::size_t threadIndex = 1; threadIndex < numThreads; threadIndex++) {
+            threads.emplace_back(worker);
+        }
+        worker();
+    }
+
+    std::lock_guard<std::mutex> lock(this->reportMutex);
+
+    // Timing is reported for failed mapping too, so caller can tell how long it took to fail
+    this->mappingReport.numThreads = numThreads;
+    this->mappingReport.totalTime = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - mappingStart);
+
+    error mappingErr = nullptr;
+    for (const auto & region : this->regions) {
+        if (region->mappingErr) {
+            const auto & endpointId = this->mappingReport.endpoints.at(region->reportIndices.front()).endpointId;
+            auto err = errors::Wrap(region->mappingErr, "Endpoint " + endpointId);
+            mappingErr = mappingErr ? errors::Join(mappingErr, err) : err;
+        }
+    }
+    return mappingErr;
+}
+
+error RdmaEndpointStorage::EnsureEndpointMapped(const RdmaEndpointId & endpointId)
+{
+    auto [endpointRegions, found] = this->findEndpointRegions(endpointId);
+    if (!found) {
+        return errors::New("Memory mapping of RDMA endpoint was not started: " + endpointId);
+    }
+
+    for (auto & region : endpointRegions) {
+        if (region->mapped.load()) {
+            continue;
+        }
+        // Requested endpoint gets all mapping threads to prefault its memory
+        auto err = this->mapRegion(region, this->mappingThreads());
+        if (err) {
+            return err;
+        }
+    }
+    return nullptr;
+}
+
+bool RdmaEndpointStorage::IsEndpointMapped(const RdmaEndpointId & endpointId) const
+{
+    auto [endpointRegions, found] = this->findEndpointRegions(endpointId);
+    if (!found) {
+        return false;
+    }
+    return std::ranges::all_of(endpointRegions, [](const auto & region) { return region->mapped.load(); });
+}
+
+std::tuple<bool, error> RdmaEndpointStorage::RequestEndpointMapping(const RdmaEndpointId & endpointId)
+{
+    auto [endpointRegions, found] = this->findEndpointRegions(endpointId);
+    if (!found) {
+        return { false, errors::New("Memory mapping of RDMA endpoint was not started: " + endpointId) };
+    }
+
+    if (std::ranges::all_of(endpointRegions, [](const auto & region) { return region->mapped.load(); })) {
+        return { true, nullptr };
+    }
+
+    std::lock_guard<std::mutex> lock(this->queueMutex);
+    for (auto & region : endpointRegions) {
+        if (region->mappingErr) {
+            return { false, std::exchange(region->mappingErr, nullptr) };
+        }
+    }
+    if (!this->mappingThread.joinable()) {
+        return { false, errors::New("Background memory mapping is not running") };
+    }
+    for (auto & region : endpointRegions) {
+        if (!region->mapped.load() && !region->scheduled) {
+            region->scheduled = true;
+            this->mappingQueue.push_back(region);
+        }
+    }
+    this->queueCondVar.notify_one();
+    return { false, nullptr };
+}
+
+RdmaEndpointStorage::MappingReport RdmaEndpointStorage::GetMappingReport() const
+{
+    std::lock_guard<std::mutex> lock(this->reportMutex);
+    return this->mappingReport;
+}
+
+void RdmaEndpointStorage::planRegions()
+{
+    auto report = MappingReport{};
+    std::map<const RdmaBuffer *, RegionMappingPtr> regionByBuffer;
+
+    this->regions.clear();
+    this->regionsByEndpoint.clear();
+
+    for (auto & [endpointId, element] : this->endpointsMap) {
+        const auto & endpoint = element->endpoint;
+        auto & endpointRegions = this->regionsByEndpoint[endpointId];
+
+        for (std::size_t slotIndex = 0; slotIndex < endpoint->SlotCount(); slotIndex++) {
+            auto buffer = endpoint->SlotBuffer(slotIndex);
+            auto arenaRegion = buffer->GetArenaRegion();
+            auto mappedBuffer = arenaRegion != nullptr ? arenaRegion : buffer;
+
+            auto & region = regionByBuffer[mappedBuffer.get()];
+            const auto sharedMapping = region != nullptr;
+            if (!sharedMapping) {
+                region = std::make_shared<RegionMapping>();
+                region->buffer = mappedBuffer;
+                region->priority = endpoint->MappingPriority();
+                this->regions.push_back(region);
+            }
+            if (arenaRegion != nullptr) {
+                region->carvedBuffers.push_back(buffer);
+            }
+            region->priority = std::max(region->priority, endpoint->MappingPriority());
+            region->reportIndices.push_back(report.endpoints.size());
+            if (std::ranges::find(endpointRegions, region) == endpointRegions.end()) {
+                endpointRegions.push_back(region);
+            }
+
+            report.endpoints.push_back(EndpointMappingTime{
+                .endpointId = endpointId,
+                .slotIndex = slotIndex,
+                .bytes = buffer->MemoryRangeSize(),
+                .sharedMapping = sharedMapping,
+            });
+        }
+    }
+
+    // Regions of higher priority endpoints are prewarmed first
+    std::ranges::stable_sort(this->regions, std::ranges::greater{},
+                             [](const auto & region) { return region->priority; });
+
+    std::lock_guard<std::mutex> lock(this->reportMutex);
+    this->mappingReport = std::move(report);
+}
+
+error RdmaEndpointStorage::mapRegion(const RegionMappingPtr & region, std::size_t prefaultThreads)
+{
+    using Clock = std::chrono::steady_clock;
+    using std::chrono::duration_cast;
+    using std::chrono::microseconds;
+
+    // Concurrent callers wait here until region is mapped by whoever came first
+    std::lock_guard<std::mutex> mappingLock(region->mappingMutex);
+    if (region->mapped.load()) {
+        return nullptr;
+    }
+
+    auto mapErr = [&]() -> error {
+        const auto regionStart = Clock::now();
+
+        // Read-only memory (e.g. read-only mapped file) is exposed to peers for RDMA reads only
+        const auto readOnly = region->buffer->IsReadOnly();
+        const auto permissions =
+            readOnly ? doca::AccessFlags::localReadOnly | doca::AccessFlags::rdmaRead
+                     : doca::AccessFlags::localReadWrite | doca::AccessFlags::rdmaRead | doca::AccessFlags::rdmaWrite;
+
+        if (this->mappingConfig.prefault) {
+            auto [memory, memErr] = region->buffer->GetMemorySpan();
+            if (memErr) {
+                return errors::Wrap(memErr, "Failed to get endpoint memory");
+            }
+            // Pages of mapped file are only read, so prefault does not dirty them
+            const auto prefaultWritable = !readOnly && region->buffer->GetMappedFile() == nullptr;
+            doca::PrefaultMemory(memory, prefaultWritable, prefaultThreads);
+        }
+        const auto prefaultEnd = Clock::now();
+
+        auto err = region->buffer->MapMemory(this->mappingDevice, permissions);
+        if (err) {
+            return errors::Wrap(err, "Failed to map endpoint memory");
+        }
+        // Export descriptor once so that requests share it instead of exporting on every operation
+        auto [_, descErr] = region->buffer->GetExportedDescriptor();
+        if (descErr) {
+            return errors::Wrap(descErr, "Failed to export endpoint memory descriptor");
+        }
+        // Buffers carved from arena take memory map and descriptor of just mapped arena region
+        for (auto & carvedBuffer : region->carvedBuffers) {
+            err = carvedBuffer->MapMemory(this->mappingDevice, permissions);
             if (err) {
                 return errors::Wrap(err, "Failed to map endpoint memory");
             }
         }
+
+        std::lock_guard<std::mutex> reportLock(this->reportMutex);
+        for (const auto reportIndex : region->reportIndices) {
+            this->mappingReport.endpoints.at(reportIndex).mapped = true;
+        }
+        auto & endpointTime = this->mappingReport.endpoints.at(region->reportIndices.front());
+        endpointTime.prefaultTime = duration_cast<microseconds>(prefaultEnd - regionStart);
+        endpointTime.registrationTime = duration_cast<microseconds>(Clock::now() - prefaultEnd);
         return nullptr;
+    }();
+
+    {
+        std::lock_guard<std::mutex> queueLock(this->queueMutex);
+        region->mappingErr = mapErr;
+        region->scheduled = false;
     }
+    region->mapped.store(mapErr == nullptr);
+
+    return mapErr;
 }
 
-std::tuple<bool, error> RdmaEndpointStorage::TryLockEndpointsByPath(const RdmaEndpointPath & endpointsPath)
+void RdmaEndpointStorage::runMappingThread(std::stop_token stopToken)
 {
-    auto wasLocked = false;
-    auto pathFound = false;
-    for (auto & [endpointId, endpointPtr] : this->endpointsMap) {
-        if (endpointPtr->endpoint->Path() == endpointsPath) {
-            // If was not locked lock endpoint with path
-            std::lock_guard<std::mutex> lock(endpointPtr->endpointMutex);
-            if (!endpointPtr->endpointLocked.load()) {
-                endpointPtr->endpointLocked.store(true);
-                wasLocked = true;
+    while (!stopToken.stop_requested()) {
+        RegionMappingPtr region = nullptr;
+        {
+            std::unique_lock<std::mutex> lock(this->queueMutex);
+            this->queueCondVar.wait(lock, stopToken, [this]() {
+                return !this->mappingQueue.empty() || this->nextPrewarmRegion < this->regions.size();
+            });
+            if (stopToken.stop_requested()) {
+                return;
+            }
+            // Requested regions go ahead of prewarming
+            if (!this->mappingQueue.empty()) {
+                region = this->mappingQueue.front();
+                this->mappingQueue.pop_front();
+            } else {
+                region = this->regions[this->nextPrewarmRegion++];
             }
-            pathFound = true;
         }
+
+        // Prewarming runs on single thread so that it does not compete with serving; failed region is retried once
+        // requested
+        std::ignore = this->mapRegion(region, 1);
     }
-    if (!pathFound) {
-        return { wasLocked, errors::New("No endpoints with specified path found") };
+}
+
+std::tuple<std::vector<RdmaEndpointStorage::RegionMappingPtr>, bool> RdmaEndpointStorage::findEndpointRegions(
+    const RdmaEndpointId & endpointId) const
+{
+    std::shared_lock lock(this->endpointsMutex);
+    auto found = this->regionsByEndpoint.find(endpointId);
+    if (found == this->regionsByEndpoint.end()) {
+        return { std::vector<RegionMappingPtr>(), false };
     }
-    return { wasLocked, nullptr };
+    return { found->second, true };
 }
 
-error RdmaEndpointStorage::UnlockEndpointsByPath(const RdmaEndpointPath & endpointsPath)
+std::size_t RdmaEndpointStorage::mappingThreads() const
 {
-    auto pathFound = false;
-    for (auto & [endpointId, endpointPtr] : this->endpointsMap) {
-        if (endpointPtr->endpoint->Path() == endpointsPath) {
-            std::lock_guard<std::mutex> lock(endpointPtr->endpointMutex);
-            if (endpointPtr->endpointLocked.load()) {
-                endpointPtr->endpointLocked.store(false);
-            }
-            pathFound = true;
+    if (this->mappingConfig.numThreads != 0) {
+        return this->mappingConfig.numThreads;
+    }
+    return static_cast<std::size_t>(std::max(1u, std::thread::hardware_concurrency()));
+}
+
+std::tuple<std::optional<std::size_t>, error> RdmaEndpointStorage::TryLockEndpointSlot(
+    const RdmaEndpointPath & endpointsPath)
+{
+    std::lock_guard<std::mutex> lock(this->slotsMutex);
+
+    auto found = this->slotsByPath.find(endpointsPath);
+    if (found == this->slotsByPath.end()) {
+        return { std::nullopt, errors::New("No endpoints with specified path found") };
+    }
+
+    // Search starts after last handed out slot, so clients rotate over all slots instead of reusing the first one
+    auto & pathSlots = found->second;
+    const auto slotCount = pathSlots.slotLocked.size();
+    for (std::size_t attempt = 0; attempt < slotCount; attempt++) {
+        const auto slotIndex = (pathSlots.nextSlot + attempt) % slotCount;
+        if (!pathSlots.slotLocked[slotIndex]) {
+            pathSlots.slotLocked[slotIndex] = true;
+            pathSlots.nextSlot = (slotIndex + 1) % slotCount;
+            return { slotIndex, nullptr };
         }
     }
-    if (!pathFound) {
+    return { std::nullopt, nullptr };
+}
+
+error RdmaEndpointStorage::UnlockEndpointSlot(const RdmaEndpointPath & endpointsPath, std::size_t slotIndex)
+{
+    std::lock_guard<std::mutex> lock(this->slotsMutex);
+
+    auto found = this->slotsByPath.find(endpointsPath);
+    if (found == this->slotsByPath.end()) {
         return errors::New("No endpoints with specified path found");
     }
+    if (slotIndex >= found->second.slotLocked.size()) {
+        return errors::New(std::format("Endpoint slot {} does not exist", slotIndex));
+    }
+    found->second.slotLocked[slotIndex] = false;
     return nullptr;
-}
\ No newline at end of file
+}
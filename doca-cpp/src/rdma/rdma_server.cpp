@@ -26,6 +26,10 @@ using doca::rdma::RdmaBufferPtr;
 using doca::rdma::RdmaSession;
 using doca::rdma::RdmaSessionPtr;
 
+using doca::rdma::RdmaControlAddress;
+using doca::rdma::RdmaServiceExecutor;
+using doca::rdma::RdmaTransportListener;
+
 // ----------------------------------------------------------------------------
 // RdmaServer::Builder
 // ----------------------------------------------------------------------------
@@ -45,12 +49,56 @@ RdmaServer::Builder & RdmaServer::Builder::SetListenPort(uint16_t port)
     return *this;
 }
 
+RdmaServer::Builder & RdmaServer::Builder::SetEndpointMapping(const RdmaEndpointStorage::MappingConfig & config)
+{
+    this->mappingConfig = config;
+    return *this;
+}
+
+RdmaServer::Builder & RdmaServer::Builder::SetServiceExecutor(const RdmaServiceExecutor::Config & config)
+{
+    this->serviceConfig = config;
+    return *this;
+}
+
+RdmaServer::Builder & RdmaServer::Builder::SetBusyPolling(bool enabled, std::optional<std::size_t> cpuCore)
+{
+    this->busyPolling = enabled;
+    this->busyPollingCore = cpuCore;
+    return *this;
+}
+
+RdmaServer::Builder & RdmaServer::Builder::SetControlThreads(std::size_t numThreads)
+{
+    this->controlThreads = numThreads;
+    return *this;
+}
+
+RdmaServer::Builder & RdmaServer::Builder::SetControlAddress(const std::string & address)
+{
+    auto [controlAddress, err] = RdmaControlAddress::Parse(address);
+    if (err) {
+        this->buildErr = errors::Wrap(err, "Invalid control address");
+    }
+    this->controlAddress = controlAddress;
+    return *this;
+}
+
 std::tuple<RdmaServerPtr, error> RdmaServer::Builder::Build()
 {
+    if (this->buildErr) {
+        return { nullptr, errors::Wrap(this->buildErr, "Failed to build RDMA server") };
+    }
     if (this->device == nullptr) {
         return { nullptr, errors::New("Associated device was not set") };
     }
     auto server = std::make_shared<RdmaServer>(this->device, this->port);
+    server->mappingConfig = this->mappingConfig;
+    server->controlAddress = this->controlAddress;
+    server->controlThreads = this->controlThreads;
+    server->serviceConfig = this->serviceConfig;
+    server->busyPolling = this->busyPolling;
+    server->busyPollingCore = this->busyPollingCore;
     return { server, nullptr };
 }
 
@@ -68,7 +116,7 @@ RdmaServer::RdmaServer(doca::DevicePtr initialDevice, uint16_t port) : device(in
 RdmaServer::~RdmaServer()
 {
     DOCA_CPP_LOG_DEBUG("RDMA server destructor called, shutting down server if running");
-    this->continueServing.store(false);
+    this->requestStop();
     if (this->executor != nullptr) {
         this->executor->Stop();
     }
@@ -100,12 +148,26 @@ error RdmaServer::Serve()
     }
 
     // Map all buffers in endpoints before serving
-    auto mapErr = this->endpointsStorage->MapEndpointsMemory(this->device);
+    auto mapErr = this->endpointsStorage->MapEndpointsMemory(this->device, this->mappingConfig);
     if (mapErr) {
         return errors::Wrap(mapErr, "Failed to map endpoints memory");
     }
 
-    DOCA_CPP_LOG_DEBUG("Mapped all endpoint buffers");
+    const auto mappingReport = this->endpointsStorage->GetMappingReport();
+    if (this->mappingConfig.policy != RdmaEndpointStorage::MappingPolicy::eager) {
+        // Memory is mapped in background, so timing is not known yet
+        DOCA_CPP_LOG_INFO(std::format("Mapping {} endpoint buffers in background", mappingReport.endpoints.size()));
+    } else {
+        DOCA_CPP_LOG_INFO(std::format("Mapped {} endpoint buffers in {} us using {} threads",
+                                      mappingReport.endpoints.size(), mappingReport.totalTime.count(),
+                                      mappingReport.numThreads));
+    }
+    for (const auto & endpointTime : mappingReport.endpoints) {
+        DOCA_CPP_LOG_DEBUG(std::format("Endpoint {} slot {}: {} bytes, prefault {} us, registration {} us{}",
+                                       endpointTime.endpointId, endpointTime.slotIndex, endpointTime.bytes,
+                                       endpointTime.prefaultTime.count(), endpointTime.registrationTime.count(),
+                                       endpointTime.sharedMapping ? ", shared mapping" : ""));
+    }
 
     // Create Executor
     auto [executor, err] = RdmaExecutor::Create(this->device);
@@ -132,20 +194,44 @@ error RdmaServer::Serve()
 
     DOCA_CPP_LOG_DEBUG("Server started to listen to port");
 
+    // Services run on service executor, so they never block control threads
+    auto [serviceExecutor, serviceErr] = RdmaServiceExecutor::Create(this->serviceConfig);
+    if (serviceErr) {
+        return errors::Wrap(serviceErr, "Failed to create service executor");
+    }
     // Spawn communication server coroutines
     try {
-        // Create Asio io_context (event loop)
-        asio::io_context ioContext;
-
-        // Create acceptor to listen for incoming connections
-        auto acceptor = asio::ip::tcp::acceptor(
-            ioContext, asio::ip::tcp::endpoint(asio::ip::tcp::v4(), doca::rdma::communication::Port));
+        // Create Asio io_context (event loop) run by control threads; work guard keeps threads running between
+        // sessions
+        const auto numControlThreads = this->controlThreadsCount();
+        asio::io_context ioContext(static_cast<int>(numControlThreads));
+        auto workGuard = asio::make_work_guard(ioContext);
+
+        // Service handlers hand results back to control event loop, so service executor is stopped after control
+        // threads are joined but before event loop is destroyed
+        auto serviceExecutorDeferred = defer::MakeDefer([serviceExecutor]() { serviceExecutor->Stop(); });
+
+        // Create listener accepting control transports selected by control address
+        auto [listener, listenErr] = RdmaTransportListener::Create(ioContext, this->controlAddress);
+        if (listenErr) {
+            return errors::Wrap(listenErr, "Failed to create control channel listener");
+        }
 
         // Capture required variables
         auto rdmaEndpoints = this->endpointsStorage;
         auto rdmaExecutor = this->executor;
 
+        // Session handlers, control threads and progress report errors from any thread and wake serving thread
         error serverInternalError = nullptr;
+        auto reportError = [this, &serverInternalError](error err) {
+            {
+                std::lock_guard<std::mutex> lock(this->serveStopMutex);
+                if (serverInternalError == nullptr) {
+                    serverInternalError = err;
+                }
+            }
+            this->serveStopCondVar.notify_all();
+        };
 
         // Spawn server accept loop as coroutine
         asio::co_spawn(
@@ -153,22 +239,26 @@ error RdmaServer::Serve()
             [&]() -> asio::awaitable<void> {
                 while (this->continueServing.load()) {
                     // Accept new client
-                    asio::ip::tcp::socket socket = co_await acceptor.async_accept(asio::use_awaitable);
+                    auto [transport, acceptErr] = co_await listener->Accept();
+                    if (acceptErr) {
+                        DOCA_CPP_LOG_DEBUG(std::format("Stopped accepting: {}", acceptErr->What()));
+                        co_return;
+                    }
 
-                    DOCA_CPP_LOG_DEBUG("Accepted connection via socket");
-
-                    // Enable TCP keepalive to detect dead connections
-                    socket.set_option(asio::socket_base::keep_alive(true));
+                    DOCA_CPP_LOG_DEBUG("Accepted control connection");
 
                     // Create a new session for this client
-                    auto session = RdmaSessionServer::Create(std::move(socket));
-
-                    // Spawn session handler for this client
-                    asio::co_spawn(co_await asio::this_coro::executor,
-                                   doca::rdma::HandleServerSession(session, rdmaEndpoints, rdmaExecutor),
-                                   [&serverInternalError](std::exception_ptr exception, error handleError) -> void {
-                                       serverInternalError = handleError;
-                                       return;
+                    auto session = RdmaSessionServer::Create(transport);
+
+                    // Every session runs on its own strand: its coroutines never run concurrently, while different
+                    // sessions run on different control threads
+                    auto sessionHandler =
+                        doca::rdma::HandleServerSession(session, rdmaEndpoints, rdmaExecutor, serviceExecutor);
+                    asio::co_spawn(asio::make_strand(ioContext), std::move(sessionHandler),
+                                   [&reportError](std::exception_ptr exception, error handleError) -> void {
+                                       if (handleError) {
+                                           reportError(handleError);
+                                       }
                                    });
 
                     DOCA_CPP_LOG_DEBUG("Spawned handling coroutine");
@@ -178,33 +268,83 @@ error RdmaServer::Serve()
 
         DOCA_CPP_LOG_DEBUG("Spawned coroutine with sessions management");
 
-        DOCA_CPP_LOG_INFO("Server is now listening for incoming requests");
-
-        // Run event loop iteration
-        while (this->continueServing.load()) {
-            if (serverInternalError) {
-                DOCA_CPP_LOG_ERROR("Server got internal error in session handler");
-                acceptor.close();
-                ioContext.stop();
-                return errors::Wrap(serverInternalError, "Server internal error");
+        // Progress engine notification handle is waited for by control event loop together with sessions, so idle
+        // server takes no CPU. Handle is owned by progress engine and is released, not closed
+        std::optional<asio::posix::stream_descriptor> progressNotifier;
+        auto progressNotifierDeferred = defer::MakeDefer([&progressNotifier]() {
+            if (progressNotifier.has_value()) {
+                std::ignore = progressNotifier->release();
             }
-            this->executor->Progress();
-            ioContext.poll();
+        });
+        if (!this->busyPolling) {
+            auto [handle, handleErr] = this->executor->GetProgressNotificationHandle();
+            if (handleErr) {
+                return errors::Wrap(handleErr, "Failed to get progress engine notification handle");
+            }
+            progressNotifier.emplace(ioContext, handle);
+            asio::co_spawn(ioContext, this->progressOnEvents(*progressNotifier, handle),
+                           [&reportError](std::exception_ptr exception, error progressErr) -> void {
+                               if (progressErr) {
+                                   reportError(progressErr);
+                               }
+                           });
         }
 
-        DOCA_CPP_LOG_INFO("Shutting down server");
+        // Control threads run sessions and progress engine events
+        std::vector<std::thread> controlThreads;
+        auto controlThreadsDeferred = defer::MakeDefer([&]() {
+            workGuard.reset();
+            ioContext.stop();
+            for (auto & thread : controlThreads) {
+                thread.join();
+            }
+            listener->Close();
+        });
+        for (std::size_t index = 0; index < numControlThreads; index++) {
+            controlThreads.emplace_back([&ioContext, &reportError]() {
+                try {
+                    ioContext.run();
+                } catch (const std::exception & exception) {
+                    reportError(errors::New("Caught exception in control thread: " + std::string(exception.what())));
+                }
+            });
+        }
 
-        // Shutdown process began: run io context to process remaining events till shutdown is forced
-        acceptor.close();
-        ioContext.stop();
-        while (!this->shutdownForced.load()) {
-            if (ioContext.stopped()) {
-                break;
+        // Dedicated thread busy-polls progress engine for lowest latency
+        std::atomic_bool progressRunning = true;
+        std::thread progressThread;
+        auto progressThreadDeferred = defer::MakeDefer([&progressRunning, &progressThread]() {
+            progressRunning.store(false);
+            if (progressThread.joinable()) {
+                progressThread.join();
             }
-            ioContext.poll();
-            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        });
+        if (this->busyPolling) {
+            progressThread = std::thread([this, &progressRunning, &reportError]() {
+                auto progressErr = this->progressBusyPolling(progressRunning);
+                if (progressErr) {
+                    reportError(progressErr);
+                }
+            });
         }
 
+        DOCA_CPP_LOG_INFO(std::format("Server is now listening for incoming requests with {} control threads{}",
+                                      numControlThreads, this->busyPolling ? " and busy-polling progress" : ""));
+
+        // Serving thread sleeps until server is shut down or fails
+        error stopErr = nullptr;
+        {
+            std::unique_lock<std::mutex> lock(this->serveStopMutex);
+            this->serveStopCondVar.wait(
+                lock, [&]() { return !this->continueServing.load() || serverInternalError != nullptr; });
+            stopErr = serverInternalError;
+        }
+        if (stopErr) {
+            DOCA_CPP_LOG_ERROR("Server got internal error in session handler");
+            return errors::Wrap(stopErr, "Server internal error");
+        }
+
+        DOCA_CPP_LOG_INFO("Shutting down server");
     } catch (const std::exception & exception) {
         DOCA_CPP_LOG_ERROR("Server got exception");
         return errors::New("Caught exception from communication handler: " + std::string(exception.what()));
@@ -215,6 +355,71 @@ error RdmaServer::Serve()
     return nullptr;
 }
 
+asio::awaitable<error> RdmaServer::progressOnEvents(asio::posix::stream_descriptor & notifier,
+                                                    doca_notification_handle_t handle)
+{
+    while (this->continueServing.load()) {
+        // Events are drained before notification is armed: events already pending do not notify
+        while (this->executor->Progress() > 0) {
+        }
+        auto err = this->executor->RequestProgressNotification();
+        if (err) {
+            co_return errors::Wrap(err, "Failed to arm progress engine notification");
+        }
+
+        auto [waitErr] = co_await notifier.async_wait(asio::posix::stream_descriptor::wait_read,
+                                                      asio::as_tuple(asio::use_awaitable));
+        if (waitErr) {
+            // Wait is aborted when control event loop stops
+            co_return nullptr;
+        }
+
+        err = this->executor->ClearProgressNotification(handle);
+        if (err) {
+            co_return errors::Wrap(err, "Failed to clear progress engine notification");
+        }
+    }
+    co_return nullptr;
+}
+
+error RdmaServer::progressBusyPolling(const std::atomic_bool & progressRunning)
+{
+    if (this->busyPollingCore.has_value()) {
+        const auto cpuCore = *this->busyPollingCore;
+        cpu_set_t cpuSet;
+        CPU_ZERO(&cpuSet);
+        CPU_SET(cpuCore, &cpuSet);
+        const auto result = pthread_setaffinity_np(pthread_self(), sizeof(cpuSet), &cpuSet);
+        if (result != 0) {
+            return errors::New(
+                std::format("Failed to pin progress thread to CPU core {}: {}", cpuCore, std::strerror(result)));
+        }
+        DOCA_CPP_LOG_INFO(std::format("Progress thread pinned to CPU core {}", cpuCore));
+    }
+
+    while (progressRunning.load() && this->continueServing.load()) {
+        this->executor->Progress();
+    }
+    return nullptr;
+}
+
+void RdmaServer::requestStop()
+{
+    {
+        std::lock_guard<std::mutex> lock(this->serveStopMutex);
+        this->continueServing.store(false);
+    }
+    this->serveStopCondVar.notify_all();
+}
+
+std::size_t RdmaServer::controlThreadsCount() const
+{
+    if (this->controlThreads != 0) {
+        return this->controlThreads;
+    }
+    return std::max<std::size_t>(1, std::thread::hardware_concurrency());
+}
+
 error RdmaServer::RegisterEndpoints(std::vector<RdmaEndpointPtr> & endpoints)
 {
     if (this->endpointsStorage == nullptr) {
@@ -238,7 +443,7 @@ error RdmaServer::Shutdown(const std::chrono::milliseconds shutdownTimeout)
     DOCA_CPP_LOG_INFO("Server shutdown requested");
 
     // Signal stop serving but don't request shutdown yet
-    this->continueServing.store(false);
+    this->requestStop();
     this->shutdownForced.store(false);
 
     // Wait for Serve() to exit with timeout
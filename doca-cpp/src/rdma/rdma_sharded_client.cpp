@@ -0,0 +1,292 @@
+#include "doca-cpp/rdma/rdma_sharded_client.hpp"
+
+#include "doca-cpp/logging/logging.hpp"
+
+#ifdef DOCA_CPP_ENABLE_LOGGING
+namespace
+{
+inline const auto loggerConfig = doca::logging::GetDefaultLoggerConfig();
+inline const auto loggerContext = kvalog::Logger::Context{
+    .appName = "doca-cpp",
+    .moduleName = "sharded-client",
+};
+}  // namespace
+DOCA_CPP_DEFINE_LOGGER(loggerConfig, loggerContext)
+#endif
+
+using doca::rdma::RdmaEndpointId;
+using doca::rdma::RdmaEndpointPath;
+using doca::rdma::RdmaEndpointPtr;
+
+using doca::rdma::RdmaClient;
+using doca::rdma::RdmaClientPtr;
+using doca::rdma::RdmaShardedClient;
+using doca::rdma::RdmaShardedClientPtr;
+
+// ----------------------------------------------------------------------------
+// RdmaShardedClient
+// ----------------------------------------------------------------------------
+
+std::tuple<RdmaShardedClientPtr, error> RdmaShardedClient::Create(doca::DevicePtr device)
+{
+    if (device == nullptr) {
+        return { nullptr, errors::New("Device pointer is null") };
+    }
+
+    auto client = std::make_shared<RdmaShardedClient>(device);
+
+    return { client, nullptr };
+}
+
+RdmaShardedClient::RdmaShardedClient(doca::DevicePtr initialDevice)
+    : device(initialDevice), hashRing(RdmaHashRing::Create())
+{
+}
+
+error RdmaShardedClient::RegisterEndpoints(std::vector<RdmaEndpointPtr> & endpoints)
+{
+    std::lock_guard<std::mutex> lock(this->membershipMutex);
+    if (!this->clients.empty()) {
+        return errors::New("Endpoints must be registered before servers are added");
+    }
+
+    for (auto & endpoint : endpoints) {
+        const auto endpointId = doca::rdma::MakeEndpointId(endpoint);
+        if (!this->endpointPaths.emplace(endpointId, endpoint->Path()).second) {
+            return errors::New("Endpoint " + endpointId + " is already registered");
+        }
+        this->endpoints.push_back(endpoint);
+    }
+
+    DOCA_CPP_LOG_INFO("Registered RDMA endpoints");
+
+    return nullptr;
+}
+
+void RdmaShardedClient::SetEndpointMapping(const RdmaEndpointStorage::MappingConfig & config)
+{
+    std::lock_guard<std::mutex> lock(this->membershipMutex);
+    this->mappingConfig = config;
+}
+
+error RdmaShardedClient::AddServer(const std::string & serverAddress, uint16_t serverPort)
+{
+    const auto serverId = std::format("{}:{}", serverAddress, serverPort);
+
+    std::vector<RdmaEndpointPtr> endpoints;
+    RdmaEndpointStorage::MappingConfig mappingConfig;
+    {
+        std::lock_guard<std::mutex> lock(this->membershipMutex);
+        if (this->clients.contains(serverId)) {
+            return errors::New("Server " + serverId + " is already added");
+        }
+        if (this->endpoints.empty()) {
+            return errors::New("No endpoints to process; register endpoints before adding servers");
+        }
+        endpoints = this->endpoints;
+        mappingConfig = this->mappingConfig;
+    }
+
+    // Connecting takes a while, so requests keep going to current servers meanwhile
+    auto [client, err] = RdmaClient::Create(this->device);
+    if (err) {
+        return errors::Wrap(err, "Failed to create client of server " + serverId);
+    }
+    client->SetEndpointMapping(mappingConfig);
+    err = client->RegisterEndpoints(endpoints);
+    if (err) {
+        return errors::Wrap(err, "Failed to register endpoints in client of server " + serverId);
+    }
+    err = client->Connect(serverAddress, serverPort);
+    if (err) {
+        return errors::Wrap(err, "Failed to connect to server " + serverId);
+    }
+
+    std::lock_guard<std::mutex> lock(this->membershipMutex);
+    err = this->hashRing->AddServer(serverId);
+    if (err) {
+        return errors::Wrap(err, "Failed to add server to hash ring");
+    }
+    this->clients.emplace(serverId, client);
+    this->rebalance();
+
+    DOCA_CPP_LOG_INFO(std::format("Added server {}", serverId));
+
+    return nullptr;
+}
+
+error RdmaShardedClient::RemoveServer(const std::string & serverAddress, uint16_t serverPort)
+{
+    const auto serverId = std::format("{}:{}", serverAddress, serverPort);
+
+    // Client is disconnected outside of lock, once requests in flight release it
+    RdmaClientPtr removedClient = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(this->membershipMutex);
+        auto found = this->clients.find(serverId);
+        if (found == this->clients.end()) {
+            return errors::New("Server " + serverId + " is not added");
+        }
+        auto err = this->hashRing->RemoveServer(serverId);
+        if (err) {
+            return errors::Wrap(err, "Failed to remove server from hash ring");
+        }
+        removedClient = std::move(found->second);
+        this->clients.erase(found);
+        this->rebalance();
+    }
+
+    DOCA_CPP_LOG_INFO(std::format("Removed server {}", serverId));
+
+    return nullptr;
+}
+
+std::vector<std::string> RdmaShardedClient::ListServers() const
+{
+    std::lock_guard<std::mutex> lock(this->membershipMutex);
+    return this->hashRing->ListServers();
+}
+
+std::tuple<std::string, error> RdmaShardedClient::GetEndpointServer(const RdmaEndpointId & endpointId) const
+{
+    std::lock_guard<std::mutex> lock(this->membershipMutex);
+    auto path = this->endpointPaths.find(endpointId);
+    if (path == this->endpointPaths.end()) {
+        return { "", errors::New("Endpoint with given ID is not registered in client") };
+    }
+    auto owner = this->pathOwners.find(path->second);
+    if (owner == this->pathOwners.end()) {
+        return { "", errors::New("No servers to route endpoint to; add server first") };
+    }
+    return { owner->second, nullptr };
+}
+
+error RdmaShardedClient::RequestEndpointProcessing(const RdmaEndpointId & endpointId)
+{
+    return this->processSharded({ endpointId }, false);
+}
+
+error RdmaShardedClient::RequestEndpointsProcessing(const std::vector<RdmaEndpointId> & endpointIds)
+{
+    return this->processSharded(endpointIds, false);
+}
+
+error RdmaShardedClient::RequestEndpointGroupProcessing(const std::vector<RdmaEndpointId> & endpointIds)
+{
+    return this->processSharded(endpointIds, true);
+}
+
+error RdmaShardedClient::processSharded(const std::vector<RdmaEndpointId> & endpointIds, bool asGroups)
+{
+    auto inflightErr = this->markInflight(endpointIds);
+    if (inflightErr) {
+        return inflightErr;
+    }
+    auto inflightDeferred = defer::MakeDefer([this, &endpointIds]() { this->clearInflight(endpointIds); });
+
+    auto [shards, routeErr] = this->routeEndpoints(endpointIds);
+    if (routeErr) {
+        return routeErr;
+    }
+
+    // Requests of all servers are outstanding together; every client runs them on its own event loop
+    std::vector<std::tuple<std::string, std::future<error>>> results;
+    results.reserve(endpointIds.size());
+    for (auto & [serverId, shard] : shards) {
+        if (asGroups) {
+            results.emplace_back(serverId, shard.client->RequestEndpointGroupProcessingAsync(shard.endpointIds));
+            continue;
+        }
+        for (const auto & endpointId : shard.endpointIds) {
+            results.emplace_back(serverId, shard.client->RequestEndpointProcessingAsync(endpointId));
+        }
+    }
+
+    error requestsErr = nullptr;
+    for (auto & [serverId, result] : results) {
+        auto err = result.get();
+        if (err) {
+            err = errors::Wrap(err, "Failed to process endpoints on server " + serverId);
+            requestsErr = requestsErr ? errors::Join(requestsErr, err) : err;
+        }
+    }
+    return requestsErr;
+}
+
+std::tuple<std::map<std::string, RdmaShardedClient::Shard>, error> RdmaShardedClient::routeEndpoints(
+    const std::vector<RdmaEndpointId> & endpointIds)
+{
+    std::lock_guard<std::mutex> lock(this->membershipMutex);
+    if (this->clients.empty()) {
+        return { std::map<std::string, Shard>{}, errors::New("No servers to route endpoints to; add server first") };
+    }
+
+    std::map<std::string, Shard> shards;
+    for (const auto & endpointId : endpointIds) {
+        auto path = this->endpointPaths.find(endpointId);
+        if (path == this->endpointPaths.end()) {
+            return { std::map<std::string, Shard>{},
+                     errors::New("Endpoint " + endpointId + " is not registered in client") };
+        }
+        auto owner = this->pathOwners.find(path->second);
+        if (owner == this->pathOwners.end()) {
+            return { std::map<std::string, Shard>{},
+                     errors::New("Endpoint " + endpointId + " is not routed to any server") };
+        }
+        auto & shard = shards[owner->second];
+        shard.client = this->clients.at(owner->second);
+        shard.endpointIds.push_back(endpointId);
+    }
+    return { std::move(shards), nullptr };
+}
+
+void RdmaShardedClient::rebalance()
+{
+    // Ring gives every path the same server as before unless arc of path changed owner
+    std::map<RdmaEndpointPath, std::string> owners;
+    std::size_t movedPaths = 0;
+    for (const auto & [_, path] : this->endpointPaths) {
+        if (owners.contains(path)) {
+            continue;
+        }
+        auto [serverId, err] = this->hashRing->GetServer(path);
+        if (err) {
+            continue;
+        }
+        auto previous = this->pathOwners.find(path);
+        if (previous != this->pathOwners.end() && previous->second != serverId) {
+            movedPaths++;
+        }
+        owners.emplace(path, serverId);
+    }
+    this->pathOwners = std::move(owners);
+
+    DOCA_CPP_LOG_INFO(std::format("Rebalanced {} endpoint paths over {} servers; {} paths moved",
+                                  this->pathOwners.size(), this->clients.size(), movedPaths));
+}
+
+error RdmaShardedClient::markInflight(const std::vector<RdmaEndpointId> & endpointIds)
+{
+    std::lock_guard<std::mutex> lock(this->inflightMutex);
+
+    // Every endpoint has one local buffer, so it can not be in flight twice
+    std::set<RdmaEndpointId> requested;
+    for (const auto & endpointId : endpointIds) {
+        if (!requested.insert(endpointId).second) {
+            return errors::New("Endpoint " + endpointId + " is requested more than once");
+        }
+        if (this->inflightEndpoints.contains(endpointId)) {
+            return errors::New("Endpoint " + endpointId + " is already in flight");
+        }
+    }
+    this->inflightEndpoints.insert(requested.begin(), requested.end());
+    return nullptr;
+}
+
+void RdmaShardedClient::clearInflight(const std::vector<RdmaEndpointId> & endpointIds)
+{
+    std::lock_guard<std::mutex> lock(this->inflightMutex);
+    for (const auto & endpointId : endpointIds) {
+        this->inflightEndpoints.erase(endpointId);
+    }
+}
@@ -108,14 +108,23 @@ int main()
 
     std::println("[Client Sample] Requesting server to process every endpoint");
 
-    // Request RDMA operation for every endpoint 20 times
+    // Endpoints of one group must have different paths, so write and read endpoints are requested as separate groups
+    std::vector<doca::rdma::RdmaEndpointId> writeGroup;
+    std::vector<doca::rdma::RdmaEndpointId> readGroup;
+    for (auto & endpoint : endpoints) {
+        auto & group = endpoint->Type() == doca::rdma::RdmaEndpointType::write ? writeGroup : readGroup;
+        group.push_back(doca::rdma::MakeEndpointId(endpoint));
+    }
+
+    // Request RDMA operation for every endpoint 20 times; one request locks and completes whole group
     const auto requestsCount = 20;
     for (int i = 0; i < requestsCount; i++) {
-        for (auto & endpoint : endpoints) {
-            const auto endpointId = doca::rdma::MakeEndpointId(endpoint);
-            std::println("[Client Sample] Requesting server to process endpoint with ID: {}", endpointId);
-            // TODO: make methods for every endpoint or call by endpoint path with type
-            err = client->RequestEndpointProcessing(endpointId);
+        for (const auto & group : { writeGroup, readGroup }) {
+            if (group.empty()) {
+                continue;
+            }
+            std::println("[Client Sample] Requesting server to process group of {} endpoints", group.size());
+            err = client->RequestEndpointGroupProcessing(group);
             if (err) {
                 std::println("[Client Sample] Failed to process client's request: {}", err->What());
                 return 1;
@@ -7,10 +7,9 @@ error user::UserWriteService::Handle(doca::rdma::RdmaBufferPtr buffer)
         this->writePattern = 0x11;
     }
 
-    auto [memrange, err] = buffer->GetMemoryRange();
+    auto [memory, err] = buffer->GetMemorySpan();
     std::ignore = err;  // Unlikely in this sample
 
-    auto & memory = *memrange;
     for (int i = 0; i < memory.size(); i++) {
         memory[i] = this->writePattern;
     }
@@ -24,11 +23,9 @@ error user::UserWriteService::Handle(doca::rdma::RdmaBufferPtr buffer)
 
 error user::UserReadService::Handle(doca::rdma::RdmaBufferPtr buffer)
 {
-    auto [memrange, err] = buffer->GetMemoryRange();
+    auto [memory, err] = buffer->GetMemorySpan();
     std::ignore = err;  // Unlikely in this sample
 
-    const auto & memory = *memrange;
-
     const size_t bytesToPrint = 10;
 
     std::ostringstream outStr{};